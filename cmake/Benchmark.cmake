@@ -0,0 +1,16 @@
+include(FetchContent)
+
+FetchContent_Declare(
+        googlebenchmark
+        GIT_REPOSITORY https://github.com/google/benchmark.git
+        GIT_TAG v1.8.3
+)
+
+set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+FetchContent_MakeAvailable(googlebenchmark)
+
+macro(AddBenchmarks target)
+    target_link_libraries(${target} PRIVATE benchmark::benchmark_main)
+endmacro()
@@ -1,4 +1,5 @@
 install(TARGETS "${CMAKE_PROJECT_NAME}-runnable" RUNTIME COMPONENT runtime)
+install(TARGETS "${CMAKE_PROJECT_NAME}-sim" RUNTIME COMPONENT runtime)
 
 # CPack configuration
 set(CPACK_PACKAGE_VENDOR "Alexey Filimonov")
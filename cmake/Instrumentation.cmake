@@ -0,0 +1,8 @@
+option(CALL_CENTER_INSTRUMENTATION "Count allocations and lock waits (see /debug/instrumentation)" OFF)
+
+function(AddInstrumentation target)
+    if (CALL_CENTER_INSTRUMENTATION)
+        message("Allocation and lock-contention instrumentation is enabled for ${target}")
+        target_compile_definitions(${target} PUBLIC "CALL_CENTER_INSTRUMENTATION")
+    endif ()
+endfunction()
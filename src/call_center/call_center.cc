@@ -2,6 +2,8 @@
 
 #include <boost/uuid/uuid_io.hpp>
 #include <chrono>
+#include <cstdint>
+#include <mutex>
 
 namespace call_center {
 
@@ -43,13 +45,33 @@ CallCenter::CallCenter(
       task_manager_(std::move(task_manager)),
       configuration_(std::move(configuration)),
       logger_(logger_provider.Get("CallCenter")),
-      metrics_(std::move(metrics)) {
+      metrics_(std::move(metrics)),
+      events_(configuration_->GetNumber<size_t>(
+          kEventsBufferSizeKey, kDefaultEventsBufferSize_, 1, kMaxEventsBufferSize_
+      )) {
   metrics_->Start();
 }
 
+const CallCenter::EventRing &CallCenter::GetEvents() const {
+  return events_;
+}
+
+bool CallCenter::IsOverloaded() const {
+  const auto calls_in_system = calls_in_system_.load(std::memory_order_relaxed);
+  if (calls_in_system == 0) {
+    return false;
+  }
+  const auto capacity = calls_->GetCapacity();
+  const auto operator_count = operators_->GetSize();
+  // емкость очереди может быть задана максимальным значением size_t
+  return capacity <= SIZE_MAX - operator_count && calls_in_system >= capacity + operator_count;
+}
+
 void CallCenter::PushCall(const CallPtr &call) {
   call->SetArrivalTime();
+  calls_in_system_.fetch_add(1, std::memory_order_relaxed);
   metrics_->RecordRequestArrival(call);
+  PublishEvent(CallEventType::kArrived, call);
   // try to bypass the queue
   const auto started = StartCallProcessingIfPossible(call);
   if (started)
@@ -58,6 +80,7 @@ void CallCenter::PushCall(const CallPtr &call) {
   const auto result = calls_->PushToQueue(call);
   switch (result) {
     case CallQueue::PushResult::kOk: {
+      PublishEvent(CallEventType::kQueued, call);
       PerformCallProcessingIteration();
       break;
     }
@@ -69,6 +92,65 @@ void CallCenter::PushCall(const CallPtr &call) {
       RejectCall(call, CallStatus::kOverload);
       break;
     }
+    case CallQueue::PushResult::kProcessing: {
+      // возвращается только при добавлении пакета
+      break;
+    }
+  }
+}
+
+CallDetailedRecord::Id CallCenter::Submit(
+    const PhoneNumber caller_phone_number, CallDetailedRecord::OnFinish on_finish
+) {
+  const auto call =
+      CallDetailedRecord::Create(caller_phone_number, configuration_, std::move(on_finish));
+  const auto id = call->GetId();
+  PushCall(call);
+  return id;
+}
+
+void CallCenter::PushCalls(const std::vector<CallPtr> &calls) {
+  for (const auto &call : calls) {
+    call->SetArrivalTime();
+    metrics_->RecordRequestArrival(call);
+    PublishEvent(CallEventType::kArrived, call);
+  }
+  calls_in_system_.fetch_add(calls.size(), std::memory_order_relaxed);
+
+  // операторы нужны, только если пакет может миновать очередь
+  auto free_operators = operators_->EraseFree(calls_->QueueIsEmpty() ? calls.size() : 0);
+  const auto results = calls_->PushBatch(calls, free_operators.size());
+
+  size_t queued_count = 0;
+  for (size_t i = 0; i < calls.size(); ++i) {
+    switch (results[i]) {
+      case CallQueue::PushResult::kProcessing: {
+        StartCallProcessing(calls[i], free_operators.back());
+        free_operators.pop_back();
+        break;
+      }
+      case CallQueue::PushResult::kOk: {
+        PublishEvent(CallEventType::kQueued, calls[i]);
+        ++queued_count;
+        break;
+      }
+      case CallQueue::PushResult::kAlreadyInQueue: {
+        RejectCall(calls[i], CallStatus::kAlreadyInQueue);
+        break;
+      }
+      case CallQueue::PushResult::kOverload: {
+        RejectCall(calls[i], CallStatus::kOverload);
+        break;
+      }
+    }
+  }
+  // операторы остаются, если часть пакета отклонена как повторные вызовы
+  for (const auto &op : free_operators) {
+    operators_->InsertFree(op);
+  }
+  // как при последовательном добавлении: по итерации обработки на каждый вызов в очереди
+  for (size_t i = 0; i < queued_count; ++i) {
+    PerformCallProcessingIteration();
   }
 }
 
@@ -99,7 +181,8 @@ void CallCenter::StartCallProcessing(const CallPtr &call, const OperatorPtr &op)
   logger_->Debug() << "Start call (" << boost::uuids::to_string(call->GetId()) << ") processing";
   call->StartService(op->GetId());
   metrics_->RecordServiceStart(call);
-  op->HandleCall(call, [call, op, call_center = shared_from_this()]() {
+  PublishEvent(CallEventType::kStarted, call);
+  op->HandleCall(call, [call, call_center = shared_from_this()](const OperatorPtr &op) {
     call_center->FinishCallProcessing(call, op);
   });
 }
@@ -126,9 +209,13 @@ void CallCenter::FinishCallProcessing(const CallPtr &call, const OperatorPtr &op
   logger_->Debug() << "Finish call processing (" << boost::uuids::to_string(call->GetId()) << ")";
   call->CompleteService(CallStatus::kOk);
   metrics_->RecordServiceComplete(call, op);
+  PublishEvent(CallEventType::kFinished, call);
   calls_->EraseFromProcessing(call);
   operators_->InsertFree(op);
-  journal_->AddRecord(*call);
+  if (journal_) {
+    journal_->AddRecord(*call);
+  }
+  ReleaseCall();
 
   // now there is at least one free operator
   if (!calls_->QueueIsEmpty()) {
@@ -139,20 +226,23 @@ void CallCenter::FinishCallProcessing(const CallPtr &call, const OperatorPtr &op
 void CallCenter::ScheduleCallProcessingIteration(const CallDetailedRecord::TimePoint &time_point) {
   logger_->Debug() << "Add task to call processing at: " << time_point;
 
-  const auto task = [call_center = shared_from_this()]() {
+  task_manager_->PostTaskAt(time_point, [call_center = shared_from_this()]() {
     call_center->PerformCallProcessingIteration();
-  };
-  task_manager_->PostTaskAt(time_point, task);
+  });
 }
 
-void CallCenter::RejectCall(const CallPtr &call, const CallStatus reason) const {
+void CallCenter::RejectCall(const CallPtr &call, const CallStatus reason) {
   logger_->Info() << "Reject call (" << boost::uuids::to_string(call->GetId()) << ") - " << reason;
   call->CompleteService(reason);
   metrics_->RecordRequestDropout(call);
-  journal_->AddRecord(*call);
+  PublishEvent(CallEventType::kRejected, call);
+  if (journal_) {
+    journal_->AddRecord(*call);
+  }
+  ReleaseCall();
 }
 
-void CallCenter::RejectAllTimeoutCalls() const {
+void CallCenter::RejectAllTimeoutCalls() {
   auto to_reject = calls_->EraseTimeoutCallFromQueue();
   while (to_reject) {
     RejectCall(to_reject, CallStatus::kTimeout);
@@ -160,4 +250,12 @@ void CallCenter::RejectAllTimeoutCalls() const {
   }
 }
 
+void CallCenter::PublishEvent(const CallEventType type, const CallPtr &call) {
+  events_.Publish(CallEvent::Make(type, *call));
+}
+
+void CallCenter::ReleaseCall() {
+  calls_in_system_.fetch_sub(1, std::memory_order_relaxed);
+}
+
 }  // namespace call_center
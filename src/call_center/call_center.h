@@ -1,11 +1,18 @@
 #ifndef CALL_CENTER_SRC_CALL_CENTER_CALL_CENTER_H_
 #define CALL_CENTER_SRC_CALL_CENTER_CALL_CENTER_H_
 
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <atomic>
 #include <chrono>
+#include <vector>
 
 #include "call_detailed_record.h"
+#include "call_event.h"
 #include "call_queue.h"
 #include "configuration/configuration.h"
+#include "core/containers/broadcast_ring.h"
 #include "core/containers/concurrent_hash_set.h"
 #include "core/queueing_system/metrics/queueing_system_metrics.h"
 #include "core/tasks/task_manager.h"
@@ -28,7 +35,18 @@ class CallCenter : public std::enable_shared_from_this<CallCenter> {
  public:
   using CallPtr = std::shared_ptr<CallDetailedRecord>;
   using OperatorPtr = std::shared_ptr<Operator>;
+  /// Сигнатура завершения асинхронной обработки вызова, см. @link Process @endlink.
+  using ProcessSignature = void(std::shared_ptr<const CallDetailedRecord>);
+  /// Сигнатура завершения асинхронной обработки пакета вызовов, см. @link ProcessBatch @endlink.
+  using ProcessBatchSignature = void(std::vector<std::shared_ptr<const CallDetailedRecord>>);
+  using EventRing = containers::BroadcastRing<CallEvent>;
 
+  /// Ключ в конфигурации, соответствующий количеству хранимых событий обработки вызовов.
+  static constexpr auto kEventsBufferSizeKey = "call_events_buffer_size";
+
+  /**
+   * @param journal журнал вызовов (может быть nullptr, тогда вызовы не журналируются)
+   */
   static std::shared_ptr<CallCenter> Create(
       std::unique_ptr<Journal> journal,
       std::shared_ptr<config::Configuration> configuration,
@@ -47,6 +65,66 @@ class CallCenter : public std::enable_shared_from_this<CallCenter> {
    * @brief Поместить новый вызов в очередь на выполнение.
    */
   void PushCall(const CallPtr &call);
+  /**
+   * @brief Поместить пакет новых вызовов в очередь на выполнение.
+   *
+   * В отличие от последовательных вызовов @link PushCall @endlink, свободные операторы и место в
+   * очереди выделяются всему пакету под одной блокировкой множества операторов и одной блокировкой
+   * очереди.
+   */
+  void PushCalls(const std::vector<CallPtr> &calls);
+  /**
+   * @brief Обработать новый вызов от заданного номера.
+   *
+   * Асинхронная операция Boost.Asio: завершается обработанным вызовом и может использоваться как с
+   * обратным вызовом, так и в сопрограмме:
+   * @code
+   * const auto cdr = co_await call_center->Process(phone, net::use_awaitable);
+   * @endcode
+   * Обработчик завершения выполняется в связанном с ним исполнителе.
+   * @param caller_phone_number номер инициатора вызова
+   * @param token признак завершения (completion token)
+   */
+  template <typename CompletionToken>
+  auto Process(PhoneNumber caller_phone_number, CompletionToken &&token);
+  /**
+   * @brief Принять новый вызов от заданного номера, не дожидаясь его обработки.
+   * @param on_finish обратный вызов при завершении обработки, может быть вызван до возврата из
+   * метода, если вызов сразу отклонен
+   * @return идентификатор вызова
+   */
+  CallDetailedRecord::Id Submit(
+      PhoneNumber caller_phone_number, CallDetailedRecord::OnFinish on_finish
+  );
+  /**
+   * @brief Обработать пакет новых вызовов (см. @link PushCalls @endlink).
+   *
+   * Асинхронная операция Boost.Asio: завершается, когда обработаны все вызовы пакета, записями о
+   * вызовах в порядке номеров.
+   * @param caller_phone_numbers номера инициаторов вызовов
+   * @param token признак завершения (completion token)
+   */
+  template <typename CompletionToken>
+  auto ProcessBatch(std::vector<PhoneNumber> caller_phone_numbers, CompletionToken &&token);
+  /**
+   * @brief Перегружена ли система: новый вызов был бы отклонен с результатом 'overload'.
+   *
+   * Проверка не захватывает блокировок и используется для отклонения запросов до создания записи о
+   * вызове. Количество вызовов в системе сравнивается с суммой емкости очереди и количества
+   * операторов, которые обновляются без блокировок при их изменении, поэтому результат
+   * приблизительный: окончательное решение по-прежнему принимает @link CallQueue @endlink. Пустая
+   * система никогда не считается перегруженной, чтобы первый вызов обновил емкость очереди после
+   * изменения конфигурации.
+   */
+  [[nodiscard]] bool IsOverloaded() const;
+  /**
+   * @brief События обработки вызовов: поступление, постановка в очередь, начало и завершение
+   * обслуживания, отклонение.
+   *
+   * Читатели не захватывают блокировок и не задерживают обработку вызовов: отставший читатель
+   * пропускает перезаписанные события.
+   */
+  [[nodiscard]] const EventRing &GetEvents() const;
 
  protected:
   CallCenter(
@@ -60,6 +138,9 @@ class CallCenter : public std::enable_shared_from_this<CallCenter> {
   );
 
  private:
+  static constexpr size_t kDefaultEventsBufferSize_ = 4096;
+  static constexpr size_t kMaxEventsBufferSize_ = 1 << 20;
+
   const std::unique_ptr<Journal> journal_;
   const std::unique_ptr<OperatorSet> operators_;
   const std::unique_ptr<CallQueue> calls_;
@@ -67,6 +148,9 @@ class CallCenter : public std::enable_shared_from_this<CallCenter> {
   const std::shared_ptr<config::Configuration> configuration_;
   const std::unique_ptr<log::Logger> logger_;
   const std::shared_ptr<qs::metrics::QueueingSystemMetrics> metrics_;
+  /// Количество вызовов, поступивших в систему и еще не завершенных (в очереди и на обслуживании).
+  std::atomic_size_t calls_in_system_ = 0;
+  EventRing events_;
 
   /**
    * @brief Выполнить очередную итерацию обработки вызовов в очереди.
@@ -108,13 +192,96 @@ class CallCenter : public std::enable_shared_from_this<CallCenter> {
    * @param call отклоненный вызов
    * @param reason причина отклонения
    */
-  void RejectCall(const CallPtr &call, CallStatus reason) const;
+  void RejectCall(const CallPtr &call, CallStatus reason);
   /**
    * @brief Отклонить все вызовы, время ожидания которых истекло.
    */
-  void RejectAllTimeoutCalls() const;
+  void RejectAllTimeoutCalls();
+  /**
+   * @brief Добавить событие обработки вызова.
+   */
+  void PublishEvent(CallEventType type, const CallPtr &call);
+  /**
+   * @brief Учесть завершение вызова в количестве вызовов в системе.
+   */
+  void ReleaseCall();
 };
 
+template <typename CompletionToken>
+auto CallCenter::Process(PhoneNumber caller_phone_number, CompletionToken &&token) {
+  namespace net = boost::asio;
+
+  auto initiation = [self = shared_from_this()](auto handler, PhoneNumber phone_number) {
+    auto on_finish = [handler = std::move(handler)](const CallDetailedRecord &cdr) mutable {
+      const auto executor = net::get_associated_executor(handler);
+      net::dispatch(
+          executor,
+          [handler = std::move(handler), cdr = cdr.shared_from_this()]() mutable {
+            std::move(handler)(std::move(cdr));
+          }
+      );
+    };
+    self->PushCall(CallDetailedRecord::Create(
+        phone_number, self->configuration_, std::move(on_finish)
+    ));
+  };
+  return net::async_initiate<CompletionToken, ProcessSignature>(
+      std::move(initiation), token, caller_phone_number
+  );
+}
+
+template <typename CompletionToken>
+auto CallCenter::ProcessBatch(
+    std::vector<PhoneNumber> caller_phone_numbers, CompletionToken &&token
+) {
+  namespace net = boost::asio;
+
+  auto initiation = [self = shared_from_this()](
+                        auto handler, std::vector<PhoneNumber> phone_numbers
+                    ) {
+    using Cdrs = std::vector<std::shared_ptr<const CallDetailedRecord>>;
+    if (phone_numbers.empty()) {
+      const auto executor = net::get_associated_executor(handler);
+      net::dispatch(executor, [handler = std::move(handler)]() mutable {
+        std::move(handler)(Cdrs());
+      });
+      return;
+    }
+
+    // состояние пакета разделяется обратными вызовами вызовов, последний завершенный вызов
+    // передает записи обработчику, после чего записи больше не ссылаются на состояние
+    struct Batch {
+      decltype(handler) handler;
+      Cdrs cdrs;
+      std::atomic_size_t remaining;
+    };
+    const auto batch = std::make_shared<Batch>(
+        std::move(handler), Cdrs(phone_numbers.size()), phone_numbers.size()
+    );
+    std::vector<CallPtr> calls;
+    calls.reserve(phone_numbers.size());
+    for (size_t i = 0; i < phone_numbers.size(); ++i) {
+      auto on_finish = [batch, i](const CallDetailedRecord &cdr) {
+        batch->cdrs[i] = cdr.shared_from_this();
+        if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+          return;
+        }
+        const auto executor = net::get_associated_executor(batch->handler);
+        net::dispatch(executor, [batch]() mutable {
+          std::move(batch->handler)(std::move(batch->cdrs));
+        });
+      };
+      calls.push_back(CallDetailedRecord::Create(
+          phone_numbers[i], self->configuration_, std::move(on_finish)
+      ));
+    }
+    self->PushCalls(calls);
+  };
+  return net::async_initiate<CompletionToken, ProcessBatchSignature>(
+      std::move(initiation), token, std::move(caller_phone_numbers)
+  );
+}
+
 }  // namespace call_center
 
 #endif  // CALL_CENTER_SRC_CALL_CENTER_CALL_CENTER_H_
@@ -2,19 +2,38 @@
 
 #include <utility>
 
+#include "core/memory/pool_allocator.h"
+
 using namespace std::chrono_literals;
 namespace uuids = boost::uuids;
 
 namespace call_center {
 
+std::shared_ptr<CallDetailedRecord> CallDetailedRecord::Create(
+    PhoneNumber caller_phone_number,
+    std::shared_ptr<config::Configuration> configuration,
+    OnFinish on_finish,
+    std::shared_ptr<const core::ClockAdapter> clock
+) {
+  return std::allocate_shared<CallDetailedRecord>(
+      core::memory::PoolAllocator<CallDetailedRecord>(),
+      caller_phone_number,
+      std::move(configuration),
+      std::move(on_finish),
+      std::move(clock)
+  );
+}
+
 CallDetailedRecord::CallDetailedRecord(
-    std::string caller_phone_number,
+    PhoneNumber caller_phone_number,
     std::shared_ptr<config::Configuration> configuration,
-    OnFinish on_finish
+    OnFinish on_finish,
+    std::shared_ptr<const core::ClockAdapter> clock
 )
     : configuration_(std::move(configuration)),
-      caller_phone_number_(std::move(caller_phone_number)),
-      on_finish_(std::move(on_finish)) {
+      caller_phone_number_(caller_phone_number),
+      on_finish_(std::move(on_finish)),
+      clock_(std::move(clock)) {
   max_wait_ = WaitingDuration(ReadMaxWait());
 }
 
@@ -22,7 +41,7 @@ void CallDetailedRecord::StartService(uuids::uuid operator_id) {
   std::lock_guard lock(mutex_);
   assert(WasArrived_() && !WasFinished_());
   operator_id_ = operator_id;
-  start_service_time_ = time_point_cast<Duration>(Clock::now());
+  start_service_time_ = Now();
 }
 
 void CallDetailedRecord::CompleteService(CallStatus status) {
@@ -30,7 +49,7 @@ void CallDetailedRecord::CompleteService(CallStatus status) {
     std::lock_guard lock(mutex_);
     assert(WasArrived_() && !WasFinished_());
     status_ = status;
-    complete_service_time_ = time_point_cast<Duration>(Clock::now());
+    complete_service_time_ = Now();
   }
   on_finish_(*this);
 }
@@ -65,7 +84,7 @@ std::optional<CallDetailedRecord::TimePoint> CallDetailedRecord::GetServiceStart
   return start_service_time_;
 }
 
-const std::string &CallDetailedRecord::GetCallerPhoneNumber() const {
+PhoneNumber CallDetailedRecord::GetCallerPhoneNumber() const {
   return caller_phone_number_;
 }
 
@@ -74,6 +93,16 @@ std::optional<CallStatus> CallDetailedRecord::GetStatus() const {
   return status_;
 }
 
+CallDetailedRecord::Progress CallDetailedRecord::GetProgress() const {
+  std::shared_lock lock(mutex_);
+  return {
+      .arrival_time = arrival_time_,
+      .service_start_time = start_service_time_,
+      .service_complete_time = complete_service_time_,
+      .status = status_
+  };
+}
+
 std::optional<uuids::uuid> CallDetailedRecord::GetOperatorId() const {
   std::shared_lock lock(mutex_);
   return operator_id_;
@@ -95,11 +124,15 @@ CallDetailedRecord::WaitingDuration CallDetailedRecord::GetMaxWait() const {
 bool CallDetailedRecord::IsTimeout() const {
   std::shared_lock lock(mutex_);
   if (WasArrived_())
-    return Clock::now() >= timeout_point_;
+    return Now() >= timeout_point_;
   else
     return false;
 }
 
+CallDetailedRecord::TimePoint CallDetailedRecord::Now() const {
+  return time_point_cast<Duration>(clock_->Now());
+}
+
 uint64_t CallDetailedRecord::ReadMaxWait() const {
   return configuration_->GetProperty<uint64_t>(kMaxWaitKey, max_wait_.count());
 }
@@ -136,7 +169,7 @@ std::optional<CallDetailedRecord::Duration> CallDetailedRecord::GetTotalTime() c
 void CallDetailedRecord::SetArrivalTime() {
   std::lock_guard lock(mutex_);
   assert(!WasArrived_());
-  arrival_time_ = time_point_cast<Duration>(Clock::now());
+  arrival_time_ = Now();
   timeout_point_ = *arrival_time_ + max_wait_;
 }
 
@@ -3,11 +3,15 @@
 
 #include <boost/uuid/uuid.hpp>
 #include <chrono>
-#include <functional>
+#include <memory>
 
 #include "call_status.h"
 #include "configuration/configuration.h"
+#include "core/clock_adapter.h"
+#include "core/instrumentation/instrumented_mutex.h"
 #include "core/queueing_system/request.h"
+#include "core/utils/functional.h"
+#include "phone_number.h"
 
 namespace call_center {
 
@@ -15,20 +19,52 @@ namespace call_center {
  * @brief В центре обработки вызовов каждый запрос представлен экземпляром данного класса.
  *
  * Помимо различных моментов времени, связанных с обслуживанием вызова, содержит обратный вызов при
- * завершении обработки, а также результат обслуживания.
+ * завершении обработки, а также результат обслуживания. Экземпляры должны создаваться в
+ * std::shared_ptr, чтобы в обратном вызове можно было продлить время жизни записи.
  */
-class CallDetailedRecord : public core::qs::Request {
+class CallDetailedRecord : public core::qs::Request,
+                           public std::enable_shared_from_this<CallDetailedRecord> {
  public:
   /// Обратный вызов при завершении обслуживания.
-  using OnFinish = std::function<void(const CallDetailedRecord &cdr)>;
+  using OnFinish = core::utils::functional::UniqueFunction<void(const CallDetailedRecord &cdr)>;
 
   /// Ключ в конфигурации, соответствующий значению максимального времени ожидания в секундах.
   static constexpr auto kMaxWaitKey = "call_max_wait";
+  /// Максимальное время ожидания, если оно не задано в конфигурации.
+  static constexpr WaitingDuration kDefaultMaxWait{30};
 
+  /**
+   * @brief Моменты обслуживания и результат вызова, прочитанные одновременно.
+   */
+  struct Progress {
+    std::optional<TimePoint> arrival_time;
+    std::optional<TimePoint> service_start_time;
+    std::optional<TimePoint> service_complete_time;
+    std::optional<CallStatus> status;
+  };
+
+  /**
+   * @brief Создать запись в @link core::memory::BlockPool пуле@endlink.
+   *
+   * Запись и блок управления std::shared_ptr размещаются в одном блоке пула, который
+   * переиспользуется после освобождения последней ссылки на запись (после записи в журнал и
+   * отправки ответа).
+   */
+  static std::shared_ptr<CallDetailedRecord> Create(
+      PhoneNumber caller_phone_number,
+      std::shared_ptr<config::Configuration> configuration,
+      OnFinish on_finish,
+      std::shared_ptr<const core::ClockAdapter> clock = core::ClockAdapter::default_clock
+  );
+
+  /**
+   * @param clock часы, по которым фиксируются моменты обслуживания вызова
+   */
   CallDetailedRecord(
-      std::string caller_phone_number,
+      PhoneNumber caller_phone_number,
       std::shared_ptr<config::Configuration> configuration,
-      OnFinish on_finish
+      OnFinish on_finish,
+      std::shared_ptr<const core::ClockAdapter> clock = core::ClockAdapter::default_clock
   );
   ~CallDetailedRecord() override = default;
 
@@ -60,12 +96,17 @@ class CallDetailedRecord : public core::qs::Request {
   /**
    * @brief Номер инициатора вызова.
    */
-  [[nodiscard]] virtual const std::string &GetCallerPhoneNumber() const;
+  [[nodiscard]] virtual PhoneNumber GetCallerPhoneNumber() const;
   /**
    * @brief Результат обработки вызова.
    * @return std::nullopt - если обслуживание не было завершено.
    */
   [[nodiscard]] virtual std::optional<CallStatus> GetStatus() const;
+  /**
+   * @brief Моменты обслуживания и результат под одной блокировкой, в отличие от отдельных
+   * методов.
+   */
+  [[nodiscard]] virtual Progress GetProgress() const;
   /**
    * @brief Идентификатор оператора, который занимался обслуживанием звонка.
    * @return std::nullopt - если обслуживание так и не было начато.
@@ -82,20 +123,23 @@ class CallDetailedRecord : public core::qs::Request {
   [[nodiscard]] virtual std::optional<TimePoint> GetTimeoutPoint() const;
 
  protected:
-  static constexpr WaitingDuration kDefaultMaxWait_{30};
-
-  mutable std::shared_mutex mutex_;
+  mutable core::instrumentation::SharedMutex mutex_{"CallDetailedRecord"};
   const std::shared_ptr<config::Configuration> configuration_;
   std::optional<TimePoint> arrival_time_;
   std::optional<TimePoint> complete_service_time_;
   std::optional<TimePoint> start_service_time_;
-  WaitingDuration max_wait_ = kDefaultMaxWait_;
+  WaitingDuration max_wait_ = kDefaultMaxWait;
   std::optional<TimePoint> timeout_point_;
-  const std::string caller_phone_number_;
+  const PhoneNumber caller_phone_number_;
   std::optional<CallStatus> status_ = std::nullopt;
   std::optional<boost::uuids::uuid> operator_id_ = std::nullopt;
   const OnFinish on_finish_;
+  const std::shared_ptr<const core::ClockAdapter> clock_;
 
+  /**
+   * @brief Текущее время по часам вызова.
+   */
+  [[nodiscard]] TimePoint Now() const;
   /**
    * @brief Прочитать максимальное время ожидания из конфигурации.
    */
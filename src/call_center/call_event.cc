@@ -0,0 +1,58 @@
+#include "call_event.h"
+
+#include <stdexcept>
+
+namespace call_center {
+
+std::string to_string(const CallEventType type) {
+  switch (type) {
+    case CallEventType::kArrived: {
+      return "arrived";
+    }
+    case CallEventType::kQueued: {
+      return "queued";
+    }
+    case CallEventType::kStarted: {
+      return "started";
+    }
+    case CallEventType::kFinished: {
+      return "finished";
+    }
+    case CallEventType::kRejected: {
+      return "rejected";
+    }
+    default: {
+      throw std::runtime_error("Unhandled enum constant");
+    }
+  }
+}
+
+CallEvent CallEvent::Make(const CallEventType type, const CallDetailedRecord &cdr) {
+  const auto progress = cdr.GetProgress();
+  std::optional<CallDetailedRecord::TimePoint> time;
+  switch (type) {
+    case CallEventType::kArrived:
+    case CallEventType::kQueued: {
+      time = progress.arrival_time;
+      break;
+    }
+    case CallEventType::kStarted: {
+      time = progress.service_start_time;
+      break;
+    }
+    case CallEventType::kFinished:
+    case CallEventType::kRejected: {
+      time = progress.service_complete_time;
+      break;
+    }
+  }
+  return {
+      .type = type,
+      .call_id = cdr.GetId(),
+      .caller_phone_number = cdr.GetCallerPhoneNumber(),
+      .time = time.value_or(CallDetailedRecord::TimePoint()),
+      .status = progress.status
+  };
+}
+
+}  // namespace call_center
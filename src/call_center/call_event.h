@@ -0,0 +1,51 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CALL_EVENT_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CALL_EVENT_H_
+
+#include <optional>
+#include <string>
+
+#include "call_detailed_record.h"
+#include "call_status.h"
+#include "phone_number.h"
+
+namespace call_center {
+
+/**
+ * @brief Этап обработки вызова.
+ */
+enum class CallEventType {
+  kArrived,   ///< Вызов поступил в систему.
+  kQueued,    ///< Вызов поставлен в очередь.
+  kStarted,   ///< Оператор начал обслуживание вызова.
+  kFinished,  ///< Обслуживание вызова завершено.
+  kRejected   ///< Вызов отклонен.
+};
+
+/**
+ * @brief Текстовое представление этапа.
+ */
+std::string to_string(CallEventType type);
+
+/**
+ * @brief Событие обработки вызова.
+ *
+ * Тривиально копируемо, чтобы храниться в @link core::containers::BroadcastRing @endlink.
+ */
+struct CallEvent {
+  CallEventType type;
+  CallDetailedRecord::Id call_id;
+  PhoneNumber caller_phone_number;
+  /// Время события по записи о вызове.
+  CallDetailedRecord::TimePoint time;
+  /// Статус вызова для завершенного либо отклоненного вызова.
+  std::optional<CallStatus> status;
+
+  /**
+   * @brief Событие по текущему состоянию записи о вызове.
+   */
+  static CallEvent Make(CallEventType type, const CallDetailedRecord &cdr);
+};
+
+}  // namespace call_center
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CALL_EVENT_H_
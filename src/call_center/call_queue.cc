@@ -32,7 +32,7 @@ CallQueue::PushResult CallQueue::PushToQueue(const CallPtr &call) {
     logger_->Debug() << "Couldn't add call " << call->GetId() << ": already in queue";
     return PushResult::kAlreadyInQueue;
   }
-  if (in_receipt_order_.size() >= capacity_) {
+  if (in_receipt_order_.size() >= capacity_.load(std::memory_order_relaxed)) {
     logger_->Debug() << "Couldn't add call " << call->GetId() << ": overload";
     return PushResult::kOverload;
   }
@@ -41,6 +41,32 @@ CallQueue::PushResult CallQueue::PushToQueue(const CallPtr &call) {
   return PushResult::kOk;
 }
 
+std::vector<CallQueue::PushResult> CallQueue::PushBatch(
+    const std::vector<CallPtr> &calls, size_t free_operator_count
+) {
+  std::vector<PushResult> results;
+  results.reserve(calls.size());
+  std::lock_guard lock(queue_mutex_);
+  UpdateCapacity();
+
+  for (const auto &call : calls) {
+    if (Contains(call)) {
+      results.push_back(PushResult::kAlreadyInQueue);
+    } else if (free_operator_count > 0 && in_receipt_order_.empty()) {
+      in_processing_.emplace(call);
+      --free_operator_count;
+      results.push_back(PushResult::kProcessing);
+    } else if (in_receipt_order_.size() >= capacity_.load(std::memory_order_relaxed)) {
+      results.push_back(PushResult::kOverload);
+    } else {
+      InsertToQueue(call);
+      results.push_back(PushResult::kOk);
+    }
+  }
+  logger_->Debug() << "Add batch of " << calls.size() << " calls";
+  return results;
+}
+
 bool CallQueue::QueueIsEmpty() const {
   std::shared_lock lock(queue_mutex_);
   return in_receipt_order_.empty();
@@ -83,8 +109,7 @@ size_t CallQueue::GetSize() const {
 }
 
 size_t CallQueue::GetCapacity() const {
-  std::shared_lock lock(queue_mutex_);
-  return capacity_;
+  return capacity_.load(std::memory_order_relaxed);
 }
 
 bool CallQueue::InsertToProcessing(const CallPtr &call) {
@@ -99,7 +124,10 @@ bool CallQueue::InsertToProcessing(const CallPtr &call) {
 }
 
 void CallQueue::UpdateCapacity() {
-  capacity_ = configuration_->GetProperty(kCapacityKey, capacity_);
+  capacity_.store(
+      configuration_->GetProperty(kCapacityKey, capacity_.load(std::memory_order_relaxed)),
+      std::memory_order_relaxed
+  );
 }
 
 void CallQueue::EraseFromQueue(const CallPtr &call) {
@@ -127,7 +155,7 @@ bool CallQueue::CallEquals::operator()(const CallPtr &first, const CallPtr &seco
 }
 
 size_t CallQueue::CallHash::operator()(const CallPtr &call) const {
-  return std::hash<std::string>()(call->GetCallerPhoneNumber());
+  return std::hash<PhoneNumber>()(call->GetCallerPhoneNumber());
 }
 
 bool CallQueue::ReceiptOrder::operator()(const CallPtr &first, const CallPtr &second) const {
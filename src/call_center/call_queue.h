@@ -1,12 +1,16 @@
 #ifndef CALL_CENTER_SRC_CALL_CENTER_CALL_QUEUE_H_
 #define CALL_CENTER_SRC_CALL_CENTER_CALL_QUEUE_H_
 
+#include <atomic>
 #include <functional>
 #include <set>
 #include <unordered_set>
+#include <vector>
 
 #include "call_detailed_record.h"
 #include "configuration/configuration.h"
+#include "core/instrumentation/instrumented_mutex.h"
+#include "core/memory/pool_allocator.h"
 
 namespace call_center {
 
@@ -30,7 +34,9 @@ class CallQueue {
   enum class PushResult {
     kOk,              ///< Успешное добавление вызова.
     kAlreadyInQueue,  ///< Запрос уже находится в очереди.
-    kOverload  ///< Количество запросов в очереди достигло максимально допустимого значения.
+    kOverload,  ///< Количество запросов в очереди достигло максимально допустимого значения.
+    kProcessing  ///< Запрос минует очередь и добавлен в множество обслуживаемых (только для
+                 ///< @link PushBatch @endlink).
   };
 
   /// Ключ в конфигурации, соответствующий значению емкости очереди.
@@ -52,6 +58,16 @@ class CallQueue {
    * @brief Добавить запрос в очередь.
    */
   PushResult PushToQueue(const CallPtr &call);
+  /**
+   * @brief Добавить пакет запросов под одной блокировкой.
+   *
+   * Пока очередь пуста, первые free_operator_count уникальных запросов минуют ее и добавляются в
+   * множество обслуживаемых (@link PushResult::kProcessing @endlink), остальные добавляются в
+   * очередь так же, как в @link PushToQueue @endlink.
+   * @param free_operator_count количество свободных операторов, которым будут переданы запросы
+   * @return результаты добавления в порядке запросов
+   */
+  std::vector<PushResult> PushBatch(const std::vector<CallPtr> &calls, size_t free_operator_count);
   /**
    * @brief Содержатся ли в очереди запросы для обслуживания.
    */
@@ -85,6 +101,8 @@ class CallQueue {
   [[nodiscard]] size_t GetSize() const;
   /**
    * @brief Максимальное количество запросов, которые могут быть в очереди на обслуживание.
+   *
+   * Не захватывает блокировку: емкость обновляется из конфигурации при добавлении запросов.
    */
   [[nodiscard]] size_t GetCapacity() const;
 
@@ -111,15 +129,20 @@ class CallQueue {
     bool operator()(const CallPtr &first, const CallPtr &second) const;
   };
 
+  /// Узлы множеств выделяются из пула, т.к. добавляются и удаляются для каждого вызова.
+  using NodeAllocator = core::memory::PoolAllocator<CallPtr>;
+  template <typename Cmp>
+  using CallMultiset = std::multiset<CallPtr, Cmp, NodeAllocator>;
+
   static constexpr size_t kDefaultCapacity_ = 10;
 
-  std::unordered_set<CallPtr, CallHash, CallEquals> in_processing_;
-  std::multiset<CallPtr, TimeoutPointOrder> in_timout_point_order_;
-  std::multiset<CallPtr, ReceiptOrder> in_receipt_order_;
-  mutable std::shared_mutex queue_mutex_;
+  std::unordered_set<CallPtr, CallHash, CallEquals, NodeAllocator> in_processing_;
+  CallMultiset<TimeoutPointOrder> in_timout_point_order_;
+  CallMultiset<ReceiptOrder> in_receipt_order_;
+  mutable core::instrumentation::SharedMutex queue_mutex_{"CallQueue"};
   std::unique_ptr<log::Logger> logger_;
   const std::shared_ptr<config::Configuration> configuration_;
-  size_t capacity_ = kDefaultCapacity_;
+  std::atomic_size_t capacity_ = kDefaultCapacity_;
 
   /**
    * @brief Обновить емкость очереди, согласно значению из конфигурации.
@@ -142,19 +165,17 @@ class CallQueue {
    * переданный в аргументах запрос.
    */
   template <typename Cmp>
-  static void EraseCallFromMultiset(std::multiset<CallPtr, Cmp> &multiset, const CallPtr &call);
+  static void EraseCallFromMultiset(CallMultiset<Cmp> &multiset, const CallPtr &call);
 
   /**
    * @brief Содержит ли мультисет указанный запрос вне зависимости от компаратора.
    */
   template <typename Cmp>
-  static bool MultisetContainsCall(
-      const std::multiset<CallPtr, Cmp> &multiset, const CallPtr &call
-  );
+  static bool MultisetContainsCall(const CallMultiset<Cmp> &multiset, const CallPtr &call);
 };
 
 template <typename Cmp>
-void CallQueue::EraseCallFromMultiset(std::multiset<CallPtr, Cmp> &multiset, const CallPtr &call) {
+void CallQueue::EraseCallFromMultiset(CallMultiset<Cmp> &multiset, const CallPtr &call) {
   constexpr CallEquals equals;
   for (auto [begin, end] = multiset.equal_range(call); begin != end; ++begin) {
     if (equals(*begin, call)) {
@@ -165,9 +186,7 @@ void CallQueue::EraseCallFromMultiset(std::multiset<CallPtr, Cmp> &multiset, con
 }
 
 template <typename Cmp>
-bool CallQueue::MultisetContainsCall(
-    const std::multiset<CallPtr, Cmp> &multiset, const CallPtr &call
-) {
+bool CallQueue::MultisetContainsCall(const CallMultiset<Cmp> &multiset, const CallPtr &call) {
   constexpr CallEquals equals;
   for (auto [begin, end] = multiset.equal_range(call); begin != end; ++begin) {
     if (equals(*begin, call)) {
@@ -0,0 +1,102 @@
+#include "call_rate_limiter.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace call_center {
+
+CallRateLimiter::CallRateLimiter(
+    std::shared_ptr<config::Configuration> configuration, const log::LoggerProvider &logger_provider
+)
+    : configuration_(std::move(configuration)), logger_(logger_provider.Get("CallRateLimiter")) {
+}
+
+bool CallRateLimiter::AdmitClient(
+    const boost::asio::ip::address &client, const Clock::time_point now
+) {
+  return AdmitClient(client, 1, now) == 1;
+}
+
+size_t CallRateLimiter::AdmitClient(
+    const boost::asio::ip::address &client, const size_t count, const Clock::time_point now
+) {
+  if (!IsEnabled()) {
+    return count;
+  }
+  const auto settings =
+      ReadSettings(kClientRateKey, kDefaultClientRate_, kClientBurstKey, kDefaultClientBurst_);
+  const auto admitted = clients_.TryAcquire(MakeClientKey(client), count, settings, now);
+  if (admitted < count) {
+    logger_->Debug() << "Client rate limit exceeded: " << client.to_string() << ", rejected "
+                     << count - admitted << " of " << count << " calls";
+  }
+  return admitted;
+}
+
+bool CallRateLimiter::AdmitCaller(
+    const PhoneNumber caller_phone_number, const Clock::time_point now
+) {
+  if (!IsEnabled()) {
+    return true;
+  }
+  const auto settings =
+      ReadSettings(kCallerRateKey, kDefaultCallerRate_, kCallerBurstKey, kDefaultCallerBurst_);
+  const auto prefix_length = configuration_->GetNumber<size_t>(
+      kCallerPrefixLengthKey, kDefaultCallerPrefixLength_, 1, PhoneNumber::kMaxDigitCount
+  );
+  if (callers_.TryAcquire(MakeCallerKey(caller_phone_number, prefix_length), settings, now)) {
+    return true;
+  }
+  logger_->Debug() << "Caller rate limit exceeded: " << caller_phone_number;
+  return false;
+}
+
+uint64_t CallRateLimiter::MakeClientKey(const boost::asio::ip::address &client) {
+  if (client.is_v4()) {
+    // старший бит отделяет адреса IPv4 от сетей IPv6 8000::/1, которые не выделяются
+    return (uint64_t{1} << 63) | client.to_v4().to_uint();
+  }
+  const auto bytes = client.to_v6().to_bytes();
+  uint64_t key = 0;
+  for (size_t i = 0; i < sizeof(key); ++i) {
+    key = (key << 8) | bytes[i];
+  }
+  return key;
+}
+
+uint64_t CallRateLimiter::MakeCallerKey(
+    const PhoneNumber caller_phone_number, const size_t prefix_length
+) {
+  auto digits = caller_phone_number.GetDigits();
+  for (auto digit_count = caller_phone_number.GetDigitCount(); digit_count > prefix_length;
+       --digit_count) {
+    digits /= 10;
+  }
+  return digits;
+}
+
+bool CallRateLimiter::IsEnabled() const {
+  return configuration_->GetProperty<bool>(kEnabledKey, kDefaultEnabled_);
+}
+
+CallRateLimiter::Settings CallRateLimiter::ReadSettings(
+    const std::string &rate_key,
+    const double default_rate,
+    const std::string &burst_key,
+    const double default_burst
+) const {
+  Settings settings;
+  settings.rate = configuration_->GetNumber<double>(rate_key, default_rate, kMinRate_);
+  settings.burst = configuration_->GetNumber<double>(burst_key, default_burst, 1, kMaxBurst_);
+  const auto idle_timeout = std::chrono::seconds(
+      configuration_->GetNumber<uint64_t>(kIdleTimeoutKey, kDefaultIdleTimeout_, 1)
+  );
+  const auto refill_time = std::chrono::duration<double>(settings.burst / settings.rate);
+  settings.idle_timeout = std::max(
+      std::chrono::duration_cast<Settings::Duration>(idle_timeout),
+      std::chrono::ceil<Settings::Duration>(refill_time)
+  );
+  return settings;
+}
+
+}  // namespace call_center
@@ -0,0 +1,119 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CALL_RATE_LIMITER_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CALL_RATE_LIMITER_H_
+
+#include <boost/asio/ip/address.hpp>
+#include <memory>
+
+#include "configuration/configuration.h"
+#include "core/rate_limit/token_bucket_limiter.h"
+#include "log/logger.h"
+#include "log/logger_provider.h"
+#include "phone_number.h"
+
+namespace call_center {
+
+/**
+ * @brief Ограничение интенсивности вызовов по адресу клиента и по префиксу номера звонящего.
+ *
+ * Для каждого адреса клиента (для IPv6 - сети /64) и каждого префикса номера заведена корзина
+ * маркеров (см. @link core::rate_limit::TokenBucketLimiter @endlink), поэтому одна АТС не может
+ * занять очередь вызовами с разных номеров. Параметры читаются из конфигурации при каждой проверке,
+ * так что их можно менять без перезапуска. Пока ограничение выключено в конфигурации, все вызовы
+ * допускаются.
+ */
+class CallRateLimiter {
+ public:
+  using Clock = core::rate_limit::TokenBucketLimiter::Clock;
+
+  /// Ключ в конфигурации, включающий ограничение интенсивности.
+  static constexpr auto kEnabledKey = "rate_limit_enabled";
+  /// Ключ в конфигурации, соответствующий допустимой интенсивности вызовов с одного адреса
+  /// (вызовов в секунду).
+  static constexpr auto kClientRateKey = "rate_limit_client_rate";
+  /// Ключ в конфигурации, соответствующий количеству вызовов с одного адреса, допускаемых подряд.
+  static constexpr auto kClientBurstKey = "rate_limit_client_burst";
+  /// Ключ в конфигурации, соответствующий количеству первых цифр номера, по которым
+  /// ограничиваются вызовы.
+  static constexpr auto kCallerPrefixLengthKey = "rate_limit_caller_prefix_length";
+  /// Ключ в конфигурации, соответствующий допустимой интенсивности вызовов с одного префикса
+  /// (вызовов в секунду).
+  static constexpr auto kCallerRateKey = "rate_limit_caller_rate";
+  /// Ключ в конфигурации, соответствующий количеству вызовов с одного префикса, допускаемых подряд.
+  static constexpr auto kCallerBurstKey = "rate_limit_caller_burst";
+  /// Ключ в конфигурации, соответствующий времени в секундах без вызовов, после которого корзина
+  /// адреса или префикса удаляется.
+  static constexpr auto kIdleTimeoutKey = "rate_limit_idle_timeout";
+
+  CallRateLimiter(
+      std::shared_ptr<config::Configuration> configuration,
+      const log::LoggerProvider &logger_provider
+  );
+  CallRateLimiter(const CallRateLimiter &other) = delete;
+  CallRateLimiter &operator=(const CallRateLimiter &other) = delete;
+
+  /**
+   * @brief Допустить вызов с адреса клиента.
+   * @return false - если интенсивность вызовов с адреса превышена
+   */
+  bool AdmitClient(const boost::asio::ip::address &client, Clock::time_point now = Clock::now());
+  /**
+   * @brief Допустить count вызовов с адреса клиента, например, пакет вызовов.
+   *
+   * Каждый вызов расходует маркер корзины адреса, как отдельный запрос.
+   * @return количество первых вызовов, допущенных в пределах интенсивности вызовов с адреса
+   */
+  size_t AdmitClient(
+      const boost::asio::ip::address &client, size_t count, Clock::time_point now = Clock::now()
+  );
+  /**
+   * @brief Допустить вызов с номера.
+   * @return false - если интенсивность вызовов с префикса номера превышена
+   */
+  bool AdmitCaller(PhoneNumber caller_phone_number, Clock::time_point now = Clock::now());
+
+  /**
+   * @brief Ключ корзины адреса: адрес IPv4 либо сеть /64 адреса IPv6.
+   */
+  static uint64_t MakeClientKey(const boost::asio::ip::address &client);
+  /**
+   * @brief Ключ корзины номера: первые prefix_length цифр номера.
+   */
+  static uint64_t MakeCallerKey(PhoneNumber caller_phone_number, size_t prefix_length);
+
+ private:
+  using Settings = core::rate_limit::TokenBucketLimiter::Settings;
+
+  static constexpr bool kDefaultEnabled_ = false;
+  static constexpr double kDefaultClientRate_ = 100;
+  static constexpr double kDefaultClientBurst_ = 200;
+  static constexpr size_t kDefaultCallerPrefixLength_ = 8;
+  static constexpr double kDefaultCallerRate_ = 10;
+  static constexpr double kDefaultCallerBurst_ = 20;
+  static constexpr uint64_t kDefaultIdleTimeout_ = 60;
+  /// Пределы параметров, при которых время полного пополнения корзины не превышает 10^9 секунд.
+  static constexpr double kMinRate_ = 1e-3;
+  static constexpr double kMaxBurst_ = 1e6;
+
+  const std::shared_ptr<config::Configuration> configuration_;
+  const std::unique_ptr<log::Logger> logger_;
+  core::rate_limit::TokenBucketLimiter clients_;
+  core::rate_limit::TokenBucketLimiter callers_;
+
+  [[nodiscard]] bool IsEnabled() const;
+  /**
+   * @brief Прочитать параметры корзин из конфигурации.
+   *
+   * Время удаления корзины не меньше времени ее полного пополнения, чтобы удаление не давало
+   * дополнительных маркеров.
+   */
+  [[nodiscard]] Settings ReadSettings(
+      const std::string &rate_key,
+      double default_rate,
+      const std::string &burst_key,
+      double default_burst
+  ) const;
+};
+
+}  // namespace call_center
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CALL_RATE_LIMITER_H_
@@ -0,0 +1,52 @@
+#include "call_result_cache.h"
+
+#include <mutex>
+
+namespace call_center {
+
+CallResultCache::CallResultCache(std::shared_ptr<config::Configuration> configuration)
+    : configuration_(std::move(configuration)) {
+}
+
+void CallResultCache::AddPending(const Id &id, const PhoneNumber phone) {
+  std::lock_guard lock(mutex_);
+  if (!results_.contains(id)) {
+    Insert(id, {.phone = phone, .status = std::nullopt});
+  }
+}
+
+void CallResultCache::Complete(const Id &id, const PhoneNumber phone, const CallStatus status) {
+  std::lock_guard lock(mutex_);
+  const auto found = results_.find(id);
+  if (found == results_.end()) {
+    Insert(id, {.phone = phone, .status = status});
+  } else {
+    found->second.status = status;
+  }
+}
+
+std::optional<CallResultCache::Result> CallResultCache::Find(const Id &id) const {
+  std::lock_guard lock(mutex_);
+  const auto found = results_.find(id);
+  if (found == results_.end()) {
+    return std::nullopt;
+  }
+  return found->second;
+}
+
+size_t CallResultCache::GetSize() const {
+  std::lock_guard lock(mutex_);
+  return results_.size();
+}
+
+void CallResultCache::Insert(const Id &id, Result result) {
+  const auto capacity = configuration_->GetNumber<size_t>(kCapacityKey, kDefaultCapacity_, 1);
+  while (results_.size() >= capacity && !order_.empty()) {
+    results_.erase(order_.front());
+    order_.pop_front();
+  }
+  results_.emplace(id, result);
+  order_.push_back(id);
+}
+
+}  // namespace call_center
@@ -0,0 +1,81 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CALL_RESULT_CACHE_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CALL_RESULT_CACHE_H_
+
+#include <boost/functional/hash.hpp>
+#include <boost/uuid/uuid.hpp>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+#include "call_status.h"
+#include "configuration/configuration.h"
+#include "core/instrumentation/instrumented_mutex.h"
+#include "phone_number.h"
+
+namespace call_center {
+
+/**
+ * @brief Ограниченный кэш результатов вызовов, принятых без ожидания обработки.
+ *
+ * Хранит для каждого вызова только номер и статус, поэтому запись о вызове освобождается сразу
+ * после завершения обработки. При превышении емкости удаляются самые давно добавленные результаты,
+ * в т.ч. еще не завершенных вызовов: их статус станет недоступен, но после завершения будет
+ * добавлен снова.
+ */
+class CallResultCache {
+ public:
+  using Id = boost::uuids::uuid;
+
+  /**
+   * @brief Результат вызова.
+   */
+  struct Result {
+    PhoneNumber phone;
+    /// Статус вызова, std::nullopt - если вызов еще обрабатывается.
+    std::optional<CallStatus> status;
+  };
+
+  /// Ключ в конфигурации, соответствующий максимальному количеству хранимых результатов.
+  static constexpr auto kCapacityKey = "call_result_cache_capacity";
+
+  explicit CallResultCache(std::shared_ptr<config::Configuration> configuration);
+  CallResultCache(const CallResultCache &other) = delete;
+  CallResultCache &operator=(const CallResultCache &other) = delete;
+
+  /**
+   * @brief Добавить принятый вызов, если его результата еще нет.
+   *
+   * Вызов может быть обработан (например, отклонен) раньше, чем добавлен, тогда его результат не
+   * изменяется.
+   */
+  void AddPending(const Id &id, PhoneNumber phone);
+  /**
+   * @brief Сохранить статус обработанного вызова.
+   */
+  void Complete(const Id &id, PhoneNumber phone, CallStatus status);
+  /**
+   * @brief Результат вызова.
+   * @return std::nullopt - если вызов неизвестен либо его результат удален
+   */
+  [[nodiscard]] std::optional<Result> Find(const Id &id) const;
+  [[nodiscard]] size_t GetSize() const;
+
+ private:
+  static constexpr size_t kDefaultCapacity_ = 10'000;
+
+  const std::shared_ptr<config::Configuration> configuration_;
+  mutable core::instrumentation::Mutex mutex_{"CallResultCache"};
+  std::unordered_map<Id, Result, boost::hash<Id>> results_;
+  /// Идентификаторы в порядке добавления: в начале - самые давние.
+  std::deque<Id> order_;
+
+  /**
+   * @brief Добавить новый результат, удалив самые давние при превышении емкости.
+   */
+  void Insert(const Id &id, Result result);
+};
+
+}  // namespace call_center
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CALL_RESULT_CACHE_H_
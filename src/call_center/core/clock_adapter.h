@@ -2,6 +2,7 @@
 #define CALL_CENTER_TEST_UNIT_CALL_CENTER_FAKE_CLOCK_INTERFACE_H_
 
 #include <chrono>
+#include <memory>
 
 namespace call_center::core {
 
@@ -0,0 +1,221 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_CONTAINERS_BROADCAST_RING_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_CONTAINERS_BROADCAST_RING_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace call_center::core::containers {
+
+/**
+ * @brief Кольцевой буфер с любым количеством писателей и читателей (broadcast).
+ *
+ * Каждый элемент получает порядковый номер, читатели хранят свой курсор - номер следующего
+ * элемента - сами, поэтому буфер не знает о читателях и писатели их никогда не ждут: новый элемент
+ * перезаписывает самый старый. Читатель, отставший больше чем на емкость буфера, пропускает
+ * перезаписанные элементы и узнает их количество.
+ *
+ * Писатель получает номер атомарным увеличением счетчика, поэтому писатели не блокируют друг
+ * друга, пока пишут в разные ячейки. Ячейка защищена счетчиком версии (seqlock): писатель
+ * захватывает ее, заменяя номер на @link kWriting_ @endlink, а читатель копирует ячейку без
+ * блокировки и отбрасывает копию, если во время чтения ячейку перезаписали. Элемент хранится
+ * словами std::atomic, чтобы одновременные запись и чтение не были гонкой данных.
+ * @tparam T тривиально копируемый тип элемента
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class BroadcastRing {
+ public:
+  using Sequence = uint64_t;
+
+  /**
+   * @brief Результат чтения.
+   */
+  struct ReadResult {
+    std::vector<T> items;
+    /// Курсор для следующего чтения.
+    Sequence next = 0;
+    /// Количество перезаписанных элементов, пропущенных читателем.
+    uint64_t dropped = 0;
+  };
+
+  /**
+   * @param capacity емкость (округляется вверх до степени двойки)
+   */
+  explicit BroadcastRing(size_t capacity);
+  BroadcastRing(const BroadcastRing &other) = delete;
+  BroadcastRing &operator=(const BroadcastRing &other) = delete;
+
+  /**
+   * @brief Добавить элемент, перезаписав самый старый при заполнении.
+   *
+   * Может вызываться из нескольких потоков одновременно. Если за время записи другие писатели
+   * успели обойти буфер и записать в ту же ячейку более новый элемент, элемент не записывается и
+   * считается пропущенным читателями.
+   */
+  void Publish(const T &item);
+  /**
+   * @brief Прочитать до max_count элементов, начиная с курсора.
+   *
+   * Курсор, опередивший писателей, сдвигается к @link GetHead @endlink. Чтение останавливается на
+   * элементе, номер которого уже получен, но запись еще не завершена: он будет прочитан
+   * следующим чтением с возвращенного курсора.
+   */
+  [[nodiscard]] ReadResult Read(Sequence cursor, size_t max_count) const;
+  /**
+   * @brief Номер следующего добавляемого элемента.
+   *
+   * Элементы с меньшими номерами могут еще записываться.
+   */
+  [[nodiscard]] Sequence GetHead() const;
+  [[nodiscard]] size_t GetCapacity() const;
+
+ private:
+  static constexpr size_t kWordCount_ = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  /// Версия ячейки во время записи.
+  static constexpr Sequence kWriting_ = std::numeric_limits<Sequence>::max();
+  /// Версия ячейки, в которую еще ничего не записано.
+  static constexpr Sequence kEmpty_ = kWriting_ - 1;
+
+  using Words = std::array<uint64_t, kWordCount_>;
+  using Bytes = std::array<std::byte, sizeof(T)>;
+
+  struct Slot {
+    /// Номер элемента в ячейке либо @link kWriting_ @endlink, @link kEmpty_ @endlink.
+    std::atomic<Sequence> sequence = kEmpty_;
+    std::array<std::atomic<uint64_t>, kWordCount_> words{};
+  };
+
+  const size_t mask_;
+  const std::unique_ptr<Slot[]> slots_;
+  std::atomic<Sequence> head_ = 0;
+
+  /**
+   * @brief Скопировать элемент с заданным номером.
+   * @return std::nullopt - если ячейка перезаписана либо элемент еще не записан
+   */
+  std::optional<T> TryLoad(Sequence sequence) const;
+  /**
+   * @brief Перезаписан ли элемент с заданным номером более новым элементом.
+   */
+  bool IsOverwritten(Sequence sequence) const;
+};
+
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+BroadcastRing<T>::BroadcastRing(const size_t capacity)
+    : mask_(std::bit_ceil(std::max<size_t>(capacity, 1)) - 1),
+      slots_(std::make_unique<Slot[]>(mask_ + 1)) {
+}
+
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+void BroadcastRing<T>::Publish(const T &item) {
+  Words words{};
+  const auto bytes = std::bit_cast<Bytes>(item);
+  std::memcpy(words.data(), bytes.data(), bytes.size());
+
+  const auto sequence = head_.fetch_add(1, std::memory_order_relaxed);
+  auto &slot = slots_[sequence & mask_];
+  // ячейку может занимать писатель, отставший или опередивший на емкость буфера
+  auto current = slot.sequence.load(std::memory_order_relaxed);
+  while (true) {
+    if (current == kWriting_) {
+      std::this_thread::yield();
+      current = slot.sequence.load(std::memory_order_relaxed);
+      continue;
+    }
+    if (current != kEmpty_ && current > sequence) {
+      return;
+    }
+    if (slot.sequence.compare_exchange_weak(current, kWriting_, std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+  for (size_t i = 0; i < kWordCount_; ++i) {
+    slot.words[i].store(words[i], std::memory_order_relaxed);
+  }
+  slot.sequence.store(sequence, std::memory_order_release);
+}
+
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+typename BroadcastRing<T>::ReadResult BroadcastRing<T>::Read(
+    Sequence cursor, const size_t max_count
+) const {
+  ReadResult result;
+  const auto head = head_.load(std::memory_order_acquire);
+  const auto capacity = mask_ + 1;
+  cursor = std::min(cursor, head);
+  if (head - cursor > capacity) {
+    result.dropped = head - cursor - capacity;
+    cursor = head - capacity;
+  }
+
+  result.items.reserve(std::min<uint64_t>(head - cursor, max_count));
+  for (; cursor < head && result.items.size() < max_count; ++cursor) {
+    if (const auto item = TryLoad(cursor)) {
+      result.items.push_back(*item);
+    } else if (IsOverwritten(cursor)) {
+      ++result.dropped;
+    } else {
+      break;
+    }
+  }
+  result.next = cursor;
+  return result;
+}
+
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+std::optional<T> BroadcastRing<T>::TryLoad(const Sequence sequence) const {
+  const auto &slot = slots_[sequence & mask_];
+  if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+    return std::nullopt;
+  }
+  Words words;
+  for (size_t i = 0; i < kWordCount_; ++i) {
+    words[i] = slot.words[i].load(std::memory_order_relaxed);
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+    return std::nullopt;
+  }
+  Bytes bytes;
+  std::memcpy(bytes.data(), words.data(), bytes.size());
+  return std::bit_cast<T>(bytes);
+}
+
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+bool BroadcastRing<T>::IsOverwritten(const Sequence sequence) const {
+  const auto current = slots_[sequence & mask_].sequence.load(std::memory_order_relaxed);
+  return current != kWriting_ && current != kEmpty_ && current > sequence;
+}
+
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+typename BroadcastRing<T>::Sequence BroadcastRing<T>::GetHead() const {
+  return head_.load(std::memory_order_acquire);
+}
+
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+size_t BroadcastRing<T>::GetCapacity() const {
+  return mask_ + 1;
+}
+
+}  // namespace call_center::core::containers
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_CONTAINERS_BROADCAST_RING_H_
@@ -6,6 +6,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "core/instrumentation/instrumented_mutex.h"
 #include "core/utils/concepts.h"
 
 /// Специлизированные структуры данных.
@@ -37,7 +38,7 @@ class ConcurrentHashMap {
   std::optional<std::pair<K, V>> First() const;
 
  private:
-  mutable std::shared_mutex mutex_;
+  mutable instrumentation::SharedMutex mutex_{"ConcurrentHashMap"};
   std::unordered_map<K, V, Hash, Equal> map_{};
 };
 
@@ -1,5 +1,8 @@
 #include "http_connection.h"
 
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <boost/beast/version.hpp>
 #include <chrono>
 
@@ -9,6 +12,16 @@ using namespace std::chrono_literals;
 
 std::atomic_size_t HttpConnection::next_id_ = 0;
 
+namespace {
+
+net::ip::address GetRemoteAddress(const tcp::socket &socket) {
+  boost::system::error_code ec;
+  const auto endpoint = socket.remote_endpoint(ec);
+  return ec ? net::ip::address() : endpoint.address();
+}
+
+}  // namespace
+
 std::shared_ptr<HttpConnection> HttpConnection::Create(
     tcp::socket &&socket,
     const std::unordered_map<std::string_view, std::shared_ptr<HttpRepository>> &repositories,
@@ -27,82 +40,125 @@ HttpConnection::HttpConnection(
     : logger_(logger_provider.Get("HttpConnection (" + std::to_string(next_id_.fetch_add(1)) + ")")
       ),
       stream_(std::move(socket)),
+      client_(GetRemoteAddress(stream_.socket())),
       repositories_(repositories) {
   stream_.expires_after(30s);
 }
 
-void HttpConnection::ReadRequest() {
-  auto request = std::make_shared<HttpRepository::Request>();
-
-  http::async_read(
-      stream_,
-      buffer_,
-      *request,
-      [request,
-       conn = shared_from_this()](const beast::error_code &ec, std::size_t bytes_transferred) {
-        boost::ignore_unused(bytes_transferred);
-        conn->OnReadRequest(*request, ec);
+void HttpConnection::Start() {
+  net::co_spawn(
+      stream_.get_executor(),
+      [conn = shared_from_this()] {
+        return conn->Run();
+      },
+      [conn = shared_from_this()](const std::exception_ptr &exception) {
+        if (!exception) {
+          return;
+        }
+        try {
+          std::rethrow_exception(exception);
+        } catch (const std::exception &error) {
+          conn->logger_->Error() << "Failed on handle request: " << error.what();
+        } catch (...) {
+          conn->logger_->Error() << "Failed on handle request: unknown exception";
+        }
+        conn->Close();
       }
   );
 }
 
-void HttpConnection::OnReadRequest(
-    const HttpRepository::Request &request, const beast::error_code &ec
-) {
-  if (ec == http::error::end_of_stream) {
-    Close();
-    return;
-  }
-
-  if (ec) {
-    Close();
-    logger_->Error() << "Failed on read request: " << ec.what();
-    return;
+net::awaitable<void> HttpConnection::Run() {
+  while (true) {
+    http::request_parser<http::string_body> parser;
+    beast::error_code ec;
+    co_await http::async_read_header(
+        stream_, buffer_, parser, net::redirect_error(net::use_awaitable, ec)
+    );
+    if (ec == http::error::end_of_stream) {
+      Close();
+      co_return;
+    }
+    if (ec) {
+      Close();
+      logger_->Error() << "Failed on read request header: " << ec.what();
+      co_return;
+    }
+
+    // запрос может быть отклонен до чтения тела, тогда соединение закрывается
+    const auto repository = FindRepository(parser.get().target());
+    if (repository) {
+      if (const auto rejection = repository->AdmitRequest(parser.get(), client_)) {
+        logger_->Info() << "Request rejected before reading body: " << rejection->result();
+        co_await WriteRejection(*rejection);
+        co_return;
+      }
+    }
+
+    co_await http::async_read(stream_, buffer_, parser, net::redirect_error(net::use_awaitable, ec));
+    if (ec) {
+      Close();
+      logger_->Error() << "Failed on read request: " << ec.what();
+      co_return;
+    }
+    const auto request = parser.release();
+    logger_->Info() << "Read request: " << to_string(request.method()) << " " << request.target();
+
+    auto response = co_await HandleRequest(request, repository);
+    if (!co_await WriteResponse(std::move(response))) {
+      co_return;
+    }
   }
+}
 
-  logger_->Info() << "Read request: " << to_string(request.method()) << " " << request.target();
-
-  const auto path_root = request.target().substr(1, request.target().find_first_of("/", 1));
+std::shared_ptr<HttpRepository> HttpConnection::FindRepository(const std::string_view target
+) const {
+  const auto path_root_end = target.find_first_of("/?", 1);
+  const auto path_root = target.substr(
+      1, path_root_end == std::string_view::npos ? path_root_end : path_root_end - 1
+  );
   const auto repository = repositories_.find(path_root);
-  if (repository == repositories_.end()) {
+  return repository == repositories_.end() ? nullptr : repository->second;
+}
+
+net::awaitable<HttpRepository::Response> HttpConnection::HandleRequest(
+    const HttpRepository::Request &request, const std::shared_ptr<HttpRepository> &repository
+) {
+  if (!repository) {
     logger_->Info() << "No processing repository found";
-    WriteResponse(MakeNotFoundResponse());
-  } else {
-    logger_->Info() << "Redirect request to repository";
-    repository->second->HandleRequest(
-        request,
-        [conn = shared_from_this()](HttpRepository::Response &&response) {
-          conn->WriteResponse(std::move(response));
-        }
-    );
+    co_return MakeNotFoundResponse();
   }
+  logger_->Info() << "Redirect request to repository";
+  co_return co_await repository->HandleRequestAsync(request, client_);
 }
 
-void HttpConnection::WriteResponse(HttpRepository::Response &&response) {
+net::awaitable<bool> HttpConnection::WriteResponse(HttpRepository::Response &&response) {
   logger_->Info() << "Write response: " << response.result();
-  bool keep_alive = response.keep_alive();
-  beast::async_write(
+  const bool keep_alive = response.keep_alive();
+  beast::error_code ec;
+  co_await beast::async_write(
       stream_,
       http::message_generator{std::move(response)},
-      [conn = shared_from_this(),
-       keep_alive](const beast::error_code &ec, std::size_t bytes_transferred) {
-        boost::ignore_unused(bytes_transferred);
-        conn->OnWriteResponse(keep_alive, ec);
-      }
+      net::redirect_error(net::use_awaitable, ec)
   );
-}
-
-void HttpConnection::OnWriteResponse(const bool keep_alive, const beast::error_code &error_code) {
-  if (error_code) {
+  if (ec) {
     Close();
-    logger_->Error() << "Failed on write response: " << error_code.what();
+    logger_->Error() << "Failed on write response: " << ec.what();
+    co_return false;
   }
-
-  if (keep_alive) {
-    ReadRequest();
-  } else {
+  if (!keep_alive) {
     Close();
+    co_return false;
+  }
+  co_return true;
+}
+
+net::awaitable<void> HttpConnection::WriteRejection(const HttpRepository::Response &rejection) {
+  beast::error_code ec;
+  co_await http::async_write(stream_, rejection, net::redirect_error(net::use_awaitable, ec));
+  if (ec) {
+    logger_->Error() << "Failed on write rejection: " << ec.what();
   }
+  Close();
 }
 
 void HttpConnection::Close() {
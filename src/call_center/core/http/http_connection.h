@@ -2,7 +2,7 @@
 #define CALL_CENTER_SRC_CALL_CENTER_DATA_HTTP_CONNECTION_H_
 
 #include <atomic>
-#include <boost/asio/dispatch.hpp>
+#include <boost/asio/awaitable.hpp>
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
 #include <boost/config.hpp>
@@ -36,10 +36,10 @@ class HttpConnection : public std::enable_shared_from_this<HttpConnection> {
   HttpConnection &operator=(const HttpConnection &other) = delete;
 
   /**
-   * @brief Запустить асинхронное чтение запроса,
-   * при завершении вызовется метод @link OnReadRequest @endlink.
+   * @brief Запустить обработку запросов соединения в отдельной сопрограмме
+   * (@link Run @endlink).
    */
-  void ReadRequest();
+  void Start();
 
  private:
   HttpConnection(
@@ -55,6 +55,8 @@ class HttpConnection : public std::enable_shared_from_this<HttpConnection> {
 
   const std::unique_ptr<log::Logger> logger_;
   beast::tcp_stream stream_;
+  /// Адрес клиента, передаваемый репозиториям при допуске запросов.
+  const net::ip::address client_;
   /**
    * @brief Временный буфер, используемый при чтении запроса.
    */
@@ -69,10 +71,35 @@ class HttpConnection : public std::enable_shared_from_this<HttpConnection> {
    */
   static HttpRepository::Response MakeNotFoundResponse();
 
-  void WriteResponse(HttpRepository::Response &&response);
-  void OnWriteResponse(bool keep_alive, const beast::error_code &error_code);
+  /**
+   * @brief Цикл обработки запросов: чтение запроса, его обработка репозиторием и запись ответа,
+   * пока соединение поддерживается.
+   */
+  net::awaitable<void> Run();
+  /**
+   * @brief Найти репозиторий, соответствующий корню пути цели запроса.
+   * @return nullptr - если такого репозитория нет
+   */
+  [[nodiscard]] std::shared_ptr<HttpRepository> FindRepository(std::string_view target) const;
+  /**
+   * @brief Перенаправить запрос найденному репозиторию.
+   * @param repository репозиторий, соответствующий корню пути запроса (может быть nullptr)
+   */
+  net::awaitable<HttpRepository::Response> HandleRequest(
+      const HttpRepository::Request &request, const std::shared_ptr<HttpRepository> &repository
+  );
+  /**
+   * @brief Записать ответ в соединение.
+   * @return true - если ответ записан и соединение поддерживается, иначе соединение закрыто
+   */
+  net::awaitable<bool> WriteResponse(HttpRepository::Response &&response);
+  /**
+   * @brief Записать ответ, которым запрос отклонен до чтения тела, и закрыть соединение.
+   *
+   * Ответ записывается без копирования и может одновременно записываться в другие соединения.
+   */
+  net::awaitable<void> WriteRejection(const HttpRepository::Response &rejection);
   void Close();
-  void OnReadRequest(const HttpRepository::Request &request, const beast::error_code &ec);
 };
 
 }  // namespace call_center::core::http
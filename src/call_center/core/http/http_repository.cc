@@ -1,5 +1,9 @@
 #include "http_repository.h"
 
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/use_awaitable.hpp>
 #include <boost/beast/version.hpp>
 
 namespace call_center::core::http {
@@ -11,6 +15,71 @@ std::string_view HttpRepository::GetRootPath() const {
   return root_;
 }
 
+std::string_view HttpRepository::GetSubPath(std::string_view target) const {
+  target = target.substr(0, target.find('?'));
+  target.remove_prefix(std::min(target.size(), root_.size() + 1));
+  while (target.starts_with('/')) {
+    target.remove_prefix(1);
+  }
+  while (target.ends_with('/')) {
+    target.remove_suffix(1);
+  }
+  return target;
+}
+
+std::optional<std::string_view> HttpRepository::GetQueryParameter(
+    std::string_view target, const std::string_view name
+) {
+  const auto query_start = target.find('?');
+  if (query_start == std::string_view::npos) {
+    return std::nullopt;
+  }
+  target.remove_prefix(query_start + 1);
+  while (!target.empty()) {
+    const auto parameter_end = std::min(target.find('&'), target.size());
+    const auto parameter = target.substr(0, parameter_end);
+    target.remove_prefix(std::min(parameter_end + 1, target.size()));
+
+    const auto value_start = parameter.find('=');
+    if (parameter.substr(0, value_start) == name) {
+      return value_start == std::string_view::npos ? std::string_view()
+                                                   : parameter.substr(value_start + 1);
+    }
+  }
+  return std::nullopt;
+}
+
+void HttpRepository::HandleRequest(
+    const http::request<http::string_body> &, const net::ip::address &, OnHandle on_handle
+) {
+  on_handle(MakeResponse(http::status::not_implemented, false, {}));
+}
+
+net::awaitable<HttpRepository::Response> HttpRepository::HandleRequestAsync(
+    const Request &request, const net::ip::address &client
+) {
+  auto initiation = [this, &request, &client](auto handler) {
+    HandleRequest(request, client, [handler = std::move(handler)](Response &&response) mutable {
+      const auto executor = net::get_associated_executor(handler);
+      net::dispatch(
+          executor,
+          [handler = std::move(handler), response = std::move(response)]() mutable {
+            std::move(handler)(std::move(response));
+          }
+      );
+    });
+  };
+  co_return co_await net::async_initiate<decltype(net::use_awaitable), void(Response)>(
+      std::move(initiation), net::use_awaitable
+  );
+}
+
+std::shared_ptr<const HttpRepository::Response> HttpRepository::AdmitRequest(
+    const RequestHeader &, const net::ip::address &
+) {
+  return nullptr;
+}
+
 HttpRepository::Response HttpRepository::MakeResponse(
     const http::status status, const bool keep_alive, std::string &&body
 ) {
@@ -1,6 +1,12 @@
 #ifndef CALL_CENTER_SRC_CALL_CENTER_DATA_HTTP_REPOSITORY_H_
 #define CALL_CENTER_SRC_CALL_CENTER_DATA_HTTP_REPOSITORY_H_
 
+#include <boost/asio/awaitable.hpp>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "core/utils/functional.h"
 #include "http.h"
 
 namespace call_center::core::http {
@@ -16,11 +22,15 @@ class HttpRepository {
   /**
    * @brief Обратный вызов при завершении обработки запроса.
    */
-  using OnHandle = std::function<void(http::response<http::string_body> &&)>;
+  using OnHandle = utils::functional::UniqueFunction<void(http::response<http::string_body> &&)>;
   /**
    * @brief Принимаемый запрос.
    */
   using Request = http::request<http::string_body>;
+  /**
+   * @brief Строка запроса и заголовки, прочитанные до тела запроса.
+   */
+  using RequestHeader = http::request_header<>;
   /**
    * @brief Сформированный ответ репозитория.
    */
@@ -33,15 +43,63 @@ class HttpRepository {
 
   /**
    * @brief Обработка входящих запросов.
+   *
+   * Репозиторий переопределяет либо этот метод, либо @link HandleRequestAsync @endlink. Если
+   * переопределен только второй, обработка с обратным вызовом не поддерживается и по умолчанию
+   * отвечает 501.
+   * @param client адрес клиента, отправившего запрос
    * @param on_handle обратный вызов при завершении обработки запроса
    */
   virtual void HandleRequest(
-      const http::request<http::string_body> &request, const OnHandle &on_handle
-  ) = 0;
+      const http::request<http::string_body> &request,
+      const net::ip::address &client,
+      OnHandle on_handle
+  );
+  /**
+   * @brief Обработка входящих запросов в виде сопрограммы.
+   *
+   * По умолчанию вызывает @link HandleRequest @endlink и возобновляет сопрограмму в её исполнителе
+   * при вызове обратного вызова. Репозитории, обработка в которых выполняется асинхронно,
+   * переопределяют только этот метод, чтобы не создавать цепочку обратных вызовов.
+   * @param request запрос, должен существовать до завершения сопрограммы
+   * @param client адрес клиента, отправившего запрос
+   */
+  virtual net::awaitable<Response> HandleRequestAsync(
+      const Request &request, const net::ip::address &client
+  );
+  /**
+   * @brief Допуск запроса по строке запроса и заголовкам, до чтения тела.
+   *
+   * Позволяет отклонить запрос, не читая тело и не передавая его на обработку, например, при
+   * перегрузке. После отклоненного запроса соединение закрывается, т.к. его тело не прочитано.
+   * Ответ не копируется, а записывается напрямую, поэтому его можно сформировать заранее и
+   * разделять между соединениями. По умолчанию все запросы допускаются.
+   * @param client адрес клиента, отправившего запрос
+   * @return ответ, которым отклоняется запрос, либо nullptr - если запрос допущен
+   */
+  virtual std::shared_ptr<const Response> AdmitRequest(
+      const RequestHeader &header, const net::ip::address &client
+  );
   /**
    * @brief Корень запросов, обрабатываемых резиторием.
    */
   [[nodiscard]] std::string_view GetRootPath() const;
+  /**
+   * @brief Путь запроса относительно @link GetRootPath корня@endlink без начального '/' и
+   * без строки параметров.
+   *
+   * Например, для корня "metrics" и цели запроса "/metrics/scheduler?a=b" вернется "scheduler".
+   */
+  [[nodiscard]] std::string_view GetSubPath(std::string_view target) const;
+  /**
+   * @brief Значение параметра из строки параметров цели запроса (без декодирования).
+   *
+   * Например, для цели "/metrics?window=60s" и имени "window" вернется "60s".
+   * @return std::nullopt - если параметр не задан
+   */
+  static std::optional<std::string_view> GetQueryParameter(
+      std::string_view target, std::string_view name
+  );
 
   /**
    * @brief Сформировать ответ
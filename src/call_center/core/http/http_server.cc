@@ -83,7 +83,7 @@ void HttpServer::OnAccept(const beast::error_code &error, tcp::socket socket) {
       logger_->Debug() << "New connection reject";
     Stop();
   } else {
-    HttpConnection::Create(std::move(socket), repositories_, logger_provider_)->ReadRequest();
+    HttpConnection::Create(std::move(socket), repositories_, logger_provider_)->Start();
     Start();
   }
 }
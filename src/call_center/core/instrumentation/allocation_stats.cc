@@ -0,0 +1,196 @@
+#include "allocation_stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace call_center::core::instrumentation {
+
+namespace {
+
+/// Размер линии кеша, счетчики размещаются в разных линиях, чтобы не мешать друг другу.
+constexpr size_t kCacheLineSize = 64;
+
+struct Counters {
+  alignas(kCacheLineSize) std::atomic_uint64_t allocation_count = 0;
+  alignas(kCacheLineSize) std::atomic_uint64_t deallocation_count = 0;
+  alignas(kCacheLineSize) std::atomic_uint64_t allocated_bytes = 0;
+};
+
+/// Статическая инициализация константами: счетчики доступны до запуска конструкторов.
+constinit Counters counters;
+
+}  // namespace
+
+uint64_t AllocationStats::Snapshot::GetLiveCount() const {
+  return allocation_count >= deallocation_count ? allocation_count - deallocation_count : 0;
+}
+
+void AllocationStats::RecordAllocation(const size_t size) {
+  counters.allocation_count.fetch_add(1, std::memory_order_relaxed);
+  counters.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationStats::RecordDeallocation() {
+  counters.deallocation_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+AllocationStats::Snapshot AllocationStats::GetSnapshot() {
+  return {
+      .allocation_count = counters.allocation_count.load(std::memory_order_relaxed),
+      .deallocation_count = counters.deallocation_count.load(std::memory_order_relaxed),
+      .allocated_bytes = counters.allocated_bytes.load(std::memory_order_relaxed)
+  };
+}
+
+}  // namespace call_center::core::instrumentation
+
+#ifdef CALL_CENTER_INSTRUMENTATION
+
+namespace {
+
+using call_center::core::instrumentation::AllocationStats;
+
+void *Allocate(size_t size) noexcept {
+  if (size == 0) {
+    size = 1;
+  }
+  void *ptr = std::malloc(size);
+  if (ptr) {
+    AllocationStats::RecordAllocation(size);
+  }
+  return ptr;
+}
+
+void *AllocateAligned(size_t size, const std::align_val_t alignment) noexcept {
+  const auto align = static_cast<size_t>(alignment);
+  // размер для std::aligned_alloc должен быть кратен выравниванию
+  size = (std::max<size_t>(size, 1) + align - 1) / align * align;
+  void *ptr = std::aligned_alloc(align, size);
+  if (ptr) {
+    AllocationStats::RecordAllocation(size);
+  }
+  return ptr;
+}
+
+void *AllocateOrThrow(const size_t size) {
+  while (true) {
+    if (void *ptr = Allocate(size)) {
+      return ptr;
+    }
+    const auto handler = std::get_new_handler();
+    if (!handler) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void *AllocateAlignedOrThrow(const size_t size, const std::align_val_t alignment) {
+  while (true) {
+    if (void *ptr = AllocateAligned(size, alignment)) {
+      return ptr;
+    }
+    const auto handler = std::get_new_handler();
+    if (!handler) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void Deallocate(void *ptr) noexcept {
+  if (ptr) {
+    AllocationStats::RecordDeallocation();
+    std::free(ptr);
+  }
+}
+
+}  // namespace
+
+void *operator new(const size_t size) {
+  return AllocateOrThrow(size);
+}
+
+void *operator new[](const size_t size) {
+  return AllocateOrThrow(size);
+}
+
+void *operator new(const size_t size, const std::nothrow_t &) noexcept {
+  return Allocate(size);
+}
+
+void *operator new[](const size_t size, const std::nothrow_t &) noexcept {
+  return Allocate(size);
+}
+
+void *operator new(const size_t size, const std::align_val_t alignment) {
+  return AllocateAlignedOrThrow(size, alignment);
+}
+
+void *operator new[](const size_t size, const std::align_val_t alignment) {
+  return AllocateAlignedOrThrow(size, alignment);
+}
+
+void *operator new(
+    const size_t size, const std::align_val_t alignment, const std::nothrow_t &
+) noexcept {
+  return AllocateAligned(size, alignment);
+}
+
+void *operator new[](
+    const size_t size, const std::align_val_t alignment, const std::nothrow_t &
+) noexcept {
+  return AllocateAligned(size, alignment);
+}
+
+void operator delete(void *ptr) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+  Deallocate(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+  Deallocate(ptr);
+}
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_ALLOCATION_STATS_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_ALLOCATION_STATS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace call_center::core::instrumentation {
+
+/**
+ * @brief Счетчики выделений динамической памяти через глобальные operator new и operator delete.
+ *
+ * Счетчики обновляются только в сборке с инструментированием, в которой глобальные operator new и
+ * operator delete заменены на считающие, иначе они всегда равны нулю.
+ */
+class AllocationStats {
+ public:
+  /**
+   * @brief Снимок счетчиков.
+   */
+  struct Snapshot {
+    uint64_t allocation_count = 0;
+    uint64_t deallocation_count = 0;
+    /// Суммарный размер выделенной памяти в байтах.
+    uint64_t allocated_bytes = 0;
+
+    /**
+     * @brief Количество еще не освобожденных выделений.
+     */
+    [[nodiscard]] uint64_t GetLiveCount() const;
+  };
+
+  /**
+   * @brief Зафиксировать выделение памяти заданного размера.
+   */
+  static void RecordAllocation(size_t size);
+  /**
+   * @brief Зафиксировать освобождение памяти.
+   */
+  static void RecordDeallocation();
+  [[nodiscard]] static Snapshot GetSnapshot();
+};
+
+}  // namespace call_center::core::instrumentation
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_ALLOCATION_STATS_H_
@@ -0,0 +1,54 @@
+#include "instrumentation_report.h"
+
+#include <chrono>
+
+#include "instrumented_mutex.h"
+
+namespace call_center::core::instrumentation {
+
+InstrumentationReport InstrumentationReport::Collect(const uint64_t call_count) {
+  return {
+      .enabled = kEnabled,
+      .call_count = call_count,
+      .allocations = AllocationStats::GetSnapshot(),
+      .locks = LockRegistry::GetSnapshot()
+  };
+}
+
+double InstrumentationReport::GetAllocationsPerCall() const {
+  if (call_count == 0) {
+    return 0;
+  }
+  return static_cast<double>(allocations.allocation_count) / static_cast<double>(call_count);
+}
+
+double InstrumentationReport::GetAllocatedBytesPerCall() const {
+  if (call_count == 0) {
+    return 0;
+  }
+  return static_cast<double>(allocations.allocated_bytes) / static_cast<double>(call_count);
+}
+
+std::ostream &operator<<(std::ostream &out, const InstrumentationReport &report) {
+  using Microseconds = std::chrono::duration<double, std::micro>;
+
+  if (!report.enabled) {
+    return out << "instrumentation is disabled";
+  }
+  out << "calls: " << report.call_count
+      << ", allocations: " << report.allocations.allocation_count
+      << " (live: " << report.allocations.GetLiveCount()
+      << ", bytes: " << report.allocations.allocated_bytes
+      << "), allocations per call: " << report.GetAllocationsPerCall()
+      << ", bytes per call: " << report.GetAllocatedBytesPerCall();
+  for (const auto &lock : report.locks) {
+    out << "; lock " << lock.name << ": acquired " << lock.acquire_count << ", contended "
+        << lock.contended_count << ", wait " << Microseconds(lock.wait_time).count()
+        << " us, max wait " << Microseconds(lock.max_wait_time).count() << " us, hold "
+        << Microseconds(lock.hold_time).count() << " us, max hold "
+        << Microseconds(lock.max_hold_time).count() << " us";
+  }
+  return out;
+}
+
+}  // namespace call_center::core::instrumentation
@@ -0,0 +1,47 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_INSTRUMENTATION_REPORT_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_INSTRUMENTATION_REPORT_H_
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "allocation_stats.h"
+#include "lock_stats.h"
+
+namespace call_center::core::instrumentation {
+
+/**
+ * @brief Отчет о выделениях памяти и ожидании блокировок.
+ */
+struct InstrumentationReport {
+  /// Собрана ли программа с инструментированием, иначе счетчики не заполняются.
+  bool enabled = false;
+  /// Количество поступивших вызовов, на которое делятся счетчики выделений.
+  uint64_t call_count = 0;
+  AllocationStats::Snapshot allocations;
+  std::vector<LockStats::Snapshot> locks;
+
+  /**
+   * @brief Собрать отчет по текущим значениям счетчиков.
+   * @param call_count количество поступивших вызовов
+   */
+  static InstrumentationReport Collect(uint64_t call_count);
+
+  /**
+   * @brief Среднее количество выделений памяти на один поступивший вызов.
+   */
+  [[nodiscard]] double GetAllocationsPerCall() const;
+  /**
+   * @brief Средний объем выделенной памяти на один поступивший вызов в байтах.
+   */
+  [[nodiscard]] double GetAllocatedBytesPerCall() const;
+};
+
+/**
+ * @brief Вывод отчета в текстовом виде.
+ */
+std::ostream &operator<<(std::ostream &out, const InstrumentationReport &report);
+
+}  // namespace call_center::core::instrumentation
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_INSTRUMENTATION_REPORT_H_
@@ -0,0 +1,121 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_INSTRUMENTED_MUTEX_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_INSTRUMENTED_MUTEX_H_
+
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+
+#include "lock_stats.h"
+
+namespace call_center::core::instrumentation {
+
+/**
+ * @brief Мьютекс, собирающий статистику захватов в @link LockRegistry реестр@endlink под
+ * заданным именем.
+ *
+ * Сначала выполняется попытка захвата без ожидания, и только если она не удалась, измеряется
+ * время ожидания, поэтому захват без конкуренции почти не замедляется. Время удержания измеряется
+ * только для исключительного захвата: разделяемых владельцев может быть несколько.
+ * @tparam MutexT std::mutex или std::shared_mutex
+ */
+template <typename MutexT>
+class InstrumentedMutex {
+ public:
+  /**
+   * @param name имя вида блокировки, под которым собирается статистика
+   */
+  explicit InstrumentedMutex(std::string_view name) : stats_(LockRegistry::Get(name)) {
+  }
+  InstrumentedMutex(const InstrumentedMutex &other) = delete;
+  InstrumentedMutex &operator=(const InstrumentedMutex &other) = delete;
+
+  void lock() {
+    if (mutex_.try_lock()) {
+      stats_.RecordAcquire();
+      locked_at_ = Clock::now();
+      return;
+    }
+    const auto start = Clock::now();
+    mutex_.lock();
+    locked_at_ = Clock::now();
+    stats_.RecordContendedAcquire(locked_at_ - start);
+  }
+
+  bool try_lock() {
+    const auto locked = mutex_.try_lock();
+    if (locked) {
+      stats_.RecordAcquire();
+      locked_at_ = Clock::now();
+    }
+    return locked;
+  }
+
+  void unlock() {
+    const auto hold_time = Clock::now() - locked_at_;
+    mutex_.unlock();
+    stats_.RecordRelease(hold_time);
+  }
+
+  void lock_shared()
+    requires requires(MutexT &mutex) { mutex.lock_shared(); }
+  {
+    if (mutex_.try_lock_shared()) {
+      stats_.RecordAcquire();
+      return;
+    }
+    const auto start = Clock::now();
+    mutex_.lock_shared();
+    stats_.RecordContendedAcquire(Clock::now() - start);
+  }
+
+  bool try_lock_shared()
+    requires requires(MutexT &mutex) { mutex.try_lock_shared(); }
+  {
+    const auto locked = mutex_.try_lock_shared();
+    if (locked) {
+      stats_.RecordAcquire();
+    }
+    return locked;
+  }
+
+  void unlock_shared()
+    requires requires(MutexT &mutex) { mutex.unlock_shared(); }
+  {
+    mutex_.unlock_shared();
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  MutexT mutex_;
+  LockStats &stats_;
+  /// Момент исключительного захвата, изменяется только владельцем блокировки.
+  Clock::time_point locked_at_;
+};
+
+/**
+ * @brief Мьютекс с именем, которое игнорируется. Используется вместо @link InstrumentedMutex
+ * @endlink, когда инструментирование выключено.
+ */
+template <typename MutexT>
+class NamedMutex : public MutexT {
+ public:
+  explicit NamedMutex(std::string_view) {
+  }
+};
+
+#ifdef CALL_CENTER_INSTRUMENTATION
+/// Сборка с инструментированием (CMake-опция CALL_CENTER_INSTRUMENTATION).
+inline constexpr bool kEnabled = true;
+using Mutex = InstrumentedMutex<std::mutex>;
+using SharedMutex = InstrumentedMutex<std::shared_mutex>;
+#else
+inline constexpr bool kEnabled = false;
+using Mutex = NamedMutex<std::mutex>;
+using SharedMutex = NamedMutex<std::shared_mutex>;
+#endif
+
+}  // namespace call_center::core::instrumentation
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_INSTRUMENTED_MUTEX_H_
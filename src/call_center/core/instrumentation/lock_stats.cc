@@ -0,0 +1,96 @@
+#include "lock_stats.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+namespace call_center::core::instrumentation {
+
+namespace {
+
+/**
+ * @brief Хранилище статистики блокировок.
+ *
+ * Блокируется только при создании блокировок, а не при их захвате.
+ */
+struct Registry {
+  std::shared_mutex mutex;
+  std::map<std::string, std::unique_ptr<LockStats>, std::less<>> stats;
+};
+
+Registry &GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+}  // namespace
+
+LockStats::LockStats(std::string name) : name_(std::move(name)) {
+}
+
+void LockStats::RecordAcquire() {
+  acquire_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void LockStats::RecordContendedAcquire(const Duration wait_time) {
+  acquire_count_.fetch_add(1, std::memory_order_relaxed);
+  contended_count_.fetch_add(1, std::memory_order_relaxed);
+  Accumulate(wait_time_, max_wait_time_, wait_time);
+}
+
+void LockStats::RecordRelease(const Duration hold_time) {
+  Accumulate(hold_time_, max_hold_time_, hold_time);
+}
+
+LockStats::Snapshot LockStats::GetSnapshot() const {
+  return {
+      .name = name_,
+      .acquire_count = acquire_count_.load(std::memory_order_relaxed),
+      .contended_count = contended_count_.load(std::memory_order_relaxed),
+      .wait_time = Duration(wait_time_.load(std::memory_order_relaxed)),
+      .max_wait_time = Duration(max_wait_time_.load(std::memory_order_relaxed)),
+      .hold_time = Duration(hold_time_.load(std::memory_order_relaxed)),
+      .max_hold_time = Duration(max_hold_time_.load(std::memory_order_relaxed))
+  };
+}
+
+void LockStats::Accumulate(
+    std::atomic_int64_t &sum, std::atomic_int64_t &max, const Duration duration
+) {
+  const auto value = duration.count();
+  sum.fetch_add(value, std::memory_order_relaxed);
+  auto current_max = max.load(std::memory_order_relaxed);
+  while (value > current_max &&
+         !max.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {
+  }
+}
+
+LockStats &LockRegistry::Get(const std::string_view name) {
+  auto &registry = GetRegistry();
+  {
+    std::shared_lock lock(registry.mutex);
+    if (const auto stats = registry.stats.find(name); stats != registry.stats.end()) {
+      return *stats->second;
+    }
+  }
+  std::lock_guard lock(registry.mutex);
+  auto [stats, inserted] = registry.stats.try_emplace(std::string(name), nullptr);
+  if (inserted) {
+    stats->second = std::make_unique<LockStats>(std::string(name));
+  }
+  return *stats->second;
+}
+
+std::vector<LockStats::Snapshot> LockRegistry::GetSnapshot() {
+  auto &registry = GetRegistry();
+  std::shared_lock lock(registry.mutex);
+  std::vector<LockStats::Snapshot> snapshot;
+  snapshot.reserve(registry.stats.size());
+  for (const auto &[name, stats] : registry.stats) {
+    snapshot.push_back(stats->GetSnapshot());
+  }
+  return snapshot;
+}
+
+}  // namespace call_center::core::instrumentation
@@ -0,0 +1,97 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_LOCK_STATS_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_LOCK_STATS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Инструментирование выделений памяти и блокировок для поиска узких мест под нагрузкой.
+namespace call_center::core::instrumentation {
+
+/**
+ * @brief Статистика захватов блокировок одного вида (например, всех блокировок очереди вызовов).
+ *
+ * Обновляется без блокировок, поэтому может использоваться в каждом захвате.
+ */
+class LockStats {
+ public:
+  using Duration = std::chrono::nanoseconds;
+
+  /**
+   * @brief Снимок статистики.
+   */
+  struct Snapshot {
+    std::string name;
+    /// Количество захватов.
+    uint64_t acquire_count = 0;
+    /// Количество захватов, которым пришлось ждать освобождения блокировки.
+    uint64_t contended_count = 0;
+    /// Суммарное время ожидания захвата.
+    Duration wait_time{0};
+    /// Максимальное время ожидания захвата.
+    Duration max_wait_time{0};
+    /// Суммарное время удержания блокировки в исключительном режиме.
+    Duration hold_time{0};
+    /// Максимальное время удержания блокировки в исключительном режиме.
+    Duration max_hold_time{0};
+  };
+
+  explicit LockStats(std::string name);
+  LockStats(const LockStats &other) = delete;
+  LockStats &operator=(const LockStats &other) = delete;
+
+  /**
+   * @brief Зафиксировать захват без ожидания.
+   */
+  void RecordAcquire();
+  /**
+   * @brief Зафиксировать захват после ожидания заданной длительности.
+   */
+  void RecordContendedAcquire(Duration wait_time);
+  /**
+   * @brief Зафиксировать освобождение блокировки, удерживавшейся заданную длительность.
+   */
+  void RecordRelease(Duration hold_time);
+  [[nodiscard]] Snapshot GetSnapshot() const;
+
+ private:
+  const std::string name_;
+  std::atomic_uint64_t acquire_count_ = 0;
+  std::atomic_uint64_t contended_count_ = 0;
+  std::atomic_int64_t wait_time_ = 0;
+  std::atomic_int64_t max_wait_time_ = 0;
+  std::atomic_int64_t hold_time_ = 0;
+  std::atomic_int64_t max_hold_time_ = 0;
+
+  /**
+   * @brief Увеличить сумму длительностей и обновить максимум.
+   */
+  static void Accumulate(std::atomic_int64_t &sum, std::atomic_int64_t &max, Duration duration);
+};
+
+/**
+ * @brief Реестр статистики блокировок по их видам.
+ *
+ * Статистика блокировок с одинаковым именем объединяется, поэтому объем памяти не зависит от
+ * количества экземпляров (например, вызовов) и ограничен количеством видов блокировок.
+ */
+class LockRegistry {
+ public:
+  /**
+   * @brief Статистика блокировок с заданным именем, создается при первом обращении.
+   *
+   * Ссылка действительна до завершения программы.
+   */
+  static LockStats &Get(std::string_view name);
+  /**
+   * @brief Снимки статистики всех видов блокировок, упорядоченные по имени.
+   */
+  static std::vector<LockStats::Snapshot> GetSnapshot();
+};
+
+}  // namespace call_center::core::instrumentation
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_INSTRUMENTATION_LOCK_STATS_H_
@@ -0,0 +1,252 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_MEMORY_POOL_ALLOCATOR_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_MEMORY_POOL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/// Распределение памяти для объектов, создаваемых при обработке каждого вызова.
+namespace call_center::core::memory {
+
+/**
+ * @brief Пул блоков памяти одного размера.
+ *
+ * Освобожденные блоки не возвращаются в кучу, а сохраняются в кеше потока и выдаются при
+ * следующих выделениях, поэтому в установившемся режиме выделение и освобождение не обращаются к
+ * глобальной куче и не блокируются. Если кеш потока переполняется (например, блоки выделяются
+ * одним потоком, а освобождаются другим), половина кеша одной пачкой переносится в общий склад,
+ * из которого пачку забирает поток с пустым кешем.
+ * @tparam kBlockSize размер блока в байтах
+ */
+template <size_t kBlockSize>
+class BlockPool {
+ public:
+  /// Максимальное количество блоков в кеше одного потока.
+  static constexpr size_t kMaxCachedBlocks = 256;
+
+  /**
+   * @brief Выделить блок.
+   * @throws std::bad_alloc - если память не удалось выделить
+   */
+  static void *Allocate();
+  /**
+   * @brief Вернуть блок в пул.
+   */
+  static void Deallocate(void *ptr) noexcept;
+
+ private:
+  struct Block {
+    Block *next;
+  };
+
+  static_assert(kBlockSize >= sizeof(Block));
+
+  /**
+   * @brief Список свободных блоков.
+   */
+  struct FreeList {
+    Block *head = nullptr;
+    size_t count = 0;
+
+    void Push(Block *block) noexcept;
+    Block *Pop() noexcept;
+    /**
+     * @brief Отделить заданное количество блоков в отдельный список.
+     */
+    FreeList Split(size_t count) noexcept;
+  };
+
+  /**
+   * @brief Общий склад пачек свободных блоков.
+   */
+  struct Depot {
+    std::mutex mutex;
+    std::vector<FreeList> batches;
+  };
+
+  /**
+   * @brief Кеш свободных блоков потока, при завершении потока блоки переносятся на склад.
+   */
+  struct LocalCache {
+    FreeList free;
+
+    ~LocalCache();
+  };
+
+  /// Уничтожен ли кеш текущего потока, после этого блоки освобождаются напрямую.
+  static thread_local bool local_destroyed_;
+
+  static LocalCache &GetLocalCache();
+  /**
+   * @brief Склад не уничтожается, чтобы блоки можно было освобождать при завершении программы.
+   */
+  static Depot &GetDepot();
+  static void PushBatch(FreeList batch) noexcept;
+  static FreeList PopBatch() noexcept;
+};
+
+/**
+ * @brief Аллокатор для стандартных контейнеров и std::allocate_shared, выделяющий одиночные
+ * объекты из @link BlockPool пула@endlink.
+ *
+ * Массивы и объекты с расширенным выравниванием выделяются из глобальной кучи. Все экземпляры
+ * равны, поэтому память можно освобождать через любой из них в любом потоке.
+ */
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+
+  PoolAllocator() noexcept = default;
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> &) noexcept {  // NOLINT(google-explicit-constructor)
+  }
+
+  T *allocate(size_t n);
+  void deallocate(T *ptr, size_t n) noexcept;
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U> &) const noexcept {
+    return true;
+  }
+
+ private:
+  static constexpr size_t kBlockSize =
+      (sizeof(T) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) *
+      alignof(std::max_align_t);
+  static constexpr bool kPooled = alignof(T) <= alignof(std::max_align_t);
+};
+
+template <size_t kBlockSize>
+thread_local bool BlockPool<kBlockSize>::local_destroyed_ = false;
+
+template <size_t kBlockSize>
+void *BlockPool<kBlockSize>::Allocate() {
+  if (!local_destroyed_) {
+    auto &local = GetLocalCache();
+    if (local.free.count == 0) {
+      local.free = PopBatch();
+    }
+    if (auto *block = local.free.Pop()) {
+      return block;
+    }
+  }
+  return ::operator new(kBlockSize);
+}
+
+template <size_t kBlockSize>
+void BlockPool<kBlockSize>::Deallocate(void *ptr) noexcept {
+  if (!ptr) {
+    return;
+  }
+  if (local_destroyed_) {
+    ::operator delete(ptr);
+    return;
+  }
+  auto &local = GetLocalCache();
+  local.free.Push(static_cast<Block *>(ptr));
+  if (local.free.count > kMaxCachedBlocks) {
+    PushBatch(local.free.Split(kMaxCachedBlocks / 2));
+  }
+}
+
+template <size_t kBlockSize>
+void BlockPool<kBlockSize>::FreeList::Push(Block *block) noexcept {
+  block->next = head;
+  head = block;
+  ++count;
+}
+
+template <size_t kBlockSize>
+typename BlockPool<kBlockSize>::Block *BlockPool<kBlockSize>::FreeList::Pop() noexcept {
+  if (!head) {
+    return nullptr;
+  }
+  auto *block = head;
+  head = block->next;
+  --count;
+  return block;
+}
+
+template <size_t kBlockSize>
+typename BlockPool<kBlockSize>::FreeList BlockPool<kBlockSize>::FreeList::Split(
+    const size_t split_count
+) noexcept {
+  FreeList result;
+  while (result.count < split_count && head) {
+    result.Push(Pop());
+  }
+  return result;
+}
+
+template <size_t kBlockSize>
+BlockPool<kBlockSize>::LocalCache::~LocalCache() {
+  local_destroyed_ = true;
+  if (free.count > 0) {
+    PushBatch(free);
+  }
+}
+
+template <size_t kBlockSize>
+typename BlockPool<kBlockSize>::LocalCache &BlockPool<kBlockSize>::GetLocalCache() {
+  thread_local LocalCache local;
+  return local;
+}
+
+template <size_t kBlockSize>
+typename BlockPool<kBlockSize>::Depot &BlockPool<kBlockSize>::GetDepot() {
+  static auto *const depot = new Depot();
+  return *depot;
+}
+
+template <size_t kBlockSize>
+void BlockPool<kBlockSize>::PushBatch(FreeList batch) noexcept {
+  auto &depot = GetDepot();
+  std::lock_guard lock(depot.mutex);
+  try {
+    depot.batches.push_back(batch);
+  } catch (const std::bad_alloc &) {
+    while (auto *block = batch.Pop()) {
+      ::operator delete(block);
+    }
+  }
+}
+
+template <size_t kBlockSize>
+typename BlockPool<kBlockSize>::FreeList BlockPool<kBlockSize>::PopBatch() noexcept {
+  auto &depot = GetDepot();
+  std::lock_guard lock(depot.mutex);
+  if (depot.batches.empty()) {
+    return {};
+  }
+  const auto batch = depot.batches.back();
+  depot.batches.pop_back();
+  return batch;
+}
+
+template <typename T>
+T *PoolAllocator<T>::allocate(const size_t n) {
+  if constexpr (kPooled) {
+    if (n == 1) {
+      return static_cast<T *>(BlockPool<kBlockSize>::Allocate());
+    }
+  }
+  return std::allocator<T>().allocate(n);
+}
+
+template <typename T>
+void PoolAllocator<T>::deallocate(T *ptr, const size_t n) noexcept {
+  if constexpr (kPooled) {
+    if (n == 1) {
+      BlockPool<kBlockSize>::Deallocate(ptr);
+      return;
+    }
+  }
+  std::allocator<T>().deallocate(ptr, n);
+}
+
+}  // namespace call_center::core::memory
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_MEMORY_POOL_ALLOCATOR_H_
@@ -0,0 +1,148 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_ATOMIC_METRIC_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_ATOMIC_METRIC_H_
+
+#include <atomic>
+#include <chrono>
+
+#include "metric.h"
+
+namespace call_center::core::qs::metrics {
+
+/**
+ * @brief Представление значения показателя в виде, пригодном для хранения в std::atomic.
+ */
+template <typename T>
+struct MetricValueTraits {
+  using Rep = T;
+
+  static Rep ToRep(T value) {
+    return value;
+  }
+
+  static T FromRep(Rep rep) {
+    return rep;
+  }
+};
+
+template <typename Rep_t, typename Period>
+struct MetricValueTraits<std::chrono::duration<Rep_t, Period>> {
+  using Rep = Rep_t;
+
+  static Rep ToRep(std::chrono::duration<Rep_t, Period> value) {
+    return value.count();
+  }
+
+  static std::chrono::duration<Rep_t, Period> FromRep(Rep rep) {
+    return std::chrono::duration<Rep_t, Period>(rep);
+  }
+};
+
+/**
+ * @brief Потокобезопасный аналог @link Metric @endlink без блокировок.
+ *
+ * Значения добавляются атомарными операциями с ослабленным упорядочиванием (relaxed), минимум и
+ * максимум обновляются через CAS. Поля читаются независимо друг от друга, поэтому снимок,
+ * полученный во время записи, может быть немного несогласованным, что допустимо для метрик.
+ * @tparam T значение показателя
+ * @tparam AvgT среднее значение показателя
+ */
+template <typename T, typename AvgT = T>
+class AtomicMetric {
+ public:
+  /**
+   * @param default_value значение показателя по умолчанию
+   */
+  explicit AtomicMetric(T default_value);
+  AtomicMetric(const AtomicMetric &other) = delete;
+  AtomicMetric &operator=(const AtomicMetric &other) = delete;
+
+  /**
+   * @brief Добавить новое значение показателя.
+   */
+  void AddValue(T value);
+  /**
+   * @brief Снимок метрики.
+   */
+  [[nodiscard]] Metric<T, AvgT> Load() const;
+  /**
+   * @brief Количество зафиксированных значений.
+   */
+  [[nodiscard]] size_t GetCount() const;
+  /**
+   * @brief Сумма зафиксированных значений.
+   */
+  [[nodiscard]] T GetSum() const;
+  /**
+   * @brief Сбросить метрику в начальное состояние.
+   *
+   * Не должен вызываться одновременно с добавлением значений.
+   */
+  void Reset();
+
+ private:
+  using Traits = MetricValueTraits<T>;
+  using Rep = typename Traits::Rep;
+
+  const T default_value_;
+  std::atomic<Rep> min_;
+  std::atomic<Rep> max_;
+  std::atomic<Rep> sum_{};
+  std::atomic<size_t> count_ = 0;
+};
+
+template <typename T, typename AvgT>
+AtomicMetric<T, AvgT>::AtomicMetric(T default_value)
+    : default_value_(default_value),
+      min_(Traits::ToRep(default_value)),
+      max_(Traits::ToRep(default_value)) {
+}
+
+template <typename T, typename AvgT>
+void AtomicMetric<T, AvgT>::AddValue(T value) {
+  const auto rep = Traits::ToRep(value);
+  sum_.fetch_add(rep, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+
+  auto min = min_.load(std::memory_order_relaxed);
+  while (rep < min && !min_.compare_exchange_weak(min, rep, std::memory_order_relaxed)) {
+  }
+  auto max = max_.load(std::memory_order_relaxed);
+  while (rep > max && !max_.compare_exchange_weak(max, rep, std::memory_order_relaxed)) {
+  }
+}
+
+template <typename T, typename AvgT>
+Metric<T, AvgT> AtomicMetric<T, AvgT>::Load() const {
+  const auto count = GetCount();
+  if (count == 0) {
+    return Metric<T, AvgT>(default_value_);
+  }
+  return Metric<T, AvgT>(
+      Traits::FromRep(min_.load(std::memory_order_relaxed)),
+      Traits::FromRep(max_.load(std::memory_order_relaxed)),
+      AvgT(GetSum()) / count,
+      count
+  );
+}
+
+template <typename T, typename AvgT>
+size_t AtomicMetric<T, AvgT>::GetCount() const {
+  return count_.load(std::memory_order_relaxed);
+}
+
+template <typename T, typename AvgT>
+T AtomicMetric<T, AvgT>::GetSum() const {
+  return Traits::FromRep(sum_.load(std::memory_order_relaxed));
+}
+
+template <typename T, typename AvgT>
+void AtomicMetric<T, AvgT>::Reset() {
+  min_.store(Traits::ToRep(default_value_), std::memory_order_relaxed);
+  max_.store(Traits::ToRep(default_value_), std::memory_order_relaxed);
+  sum_.store(Rep{}, std::memory_order_relaxed);
+  count_.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace call_center::core::qs::metrics
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_ATOMIC_METRIC_H_
@@ -0,0 +1,167 @@
+#include "erlang.h"
+
+#include <cmath>
+#include <limits>
+
+namespace call_center::core::qs::metrics::erlang {
+
+namespace {
+
+/// Максимальное количество членов ряда в Erlang A.
+constexpr size_t kMaxSeriesTerms = 10'000'000;
+/// Порог, при превышении которого члены ряда масштабируются, чтобы избежать переполнения.
+constexpr double kSeriesScale = 1e200;
+
+/**
+ * @brief Вероятность ожидания Erlang C по уже вычисленной вероятности Erlang B.
+ */
+double ErlangCFromB(const size_t server_count, const double load, const double erlang_b) {
+  const auto n = static_cast<double>(server_count);
+  if (load >= n) {
+    return 1;
+  }
+  return n * erlang_b / (n - load * (1 - erlang_b));
+}
+
+/**
+ * @brief Уровень обслуживания Erlang C по вероятности ожидания.
+ */
+double GetServiceLevel(
+    const size_t server_count,
+    const double load,
+    const double wait_probability,
+    const Seconds service_time,
+    const Seconds target_answer_time
+) {
+  const auto free_capacity = static_cast<double>(server_count) - load;
+  return 1 - wait_probability * std::exp(-free_capacity * target_answer_time / service_time);
+}
+
+}  // namespace
+
+double ErlangB(const size_t server_count, const double load) {
+  if (load <= 0) {
+    return server_count == 0 ? 1 : 0;
+  }
+  double erlang_b = 1;
+  for (size_t n = 1; n <= server_count; ++n) {
+    erlang_b = load * erlang_b / (static_cast<double>(n) + load * erlang_b);
+  }
+  return erlang_b;
+}
+
+double ErlangC(const size_t server_count, const double load) {
+  if (load <= 0) {
+    return 0;
+  }
+  return ErlangCFromB(server_count, load, ErlangB(server_count, load));
+}
+
+ErlangCPrediction PredictErlangC(
+    const size_t server_count,
+    const double load,
+    const Seconds service_time,
+    const Seconds target_answer_time
+) {
+  if (load <= 0 || service_time <= Seconds::zero()) {
+    return {.wait_probability = 0, .service_level = 1, .average_wait = Seconds::zero()};
+  }
+  if (load >= static_cast<double>(server_count)) {
+    return {
+        .wait_probability = 1,
+        .service_level = 0,
+        .average_wait = Seconds(std::numeric_limits<double>::infinity())};
+  }
+  const auto wait_probability = ErlangC(server_count, load);
+  return {
+      .wait_probability = wait_probability,
+      .service_level =
+          GetServiceLevel(server_count, load, wait_probability, service_time, target_answer_time),
+      .average_wait =
+          wait_probability * service_time / (static_cast<double>(server_count) - load)};
+}
+
+ErlangAPrediction PredictErlangA(
+    const size_t server_count,
+    const double arrival_rate,
+    const Seconds service_time,
+    const Seconds patience
+) {
+  if (arrival_rate <= 0 || service_time <= Seconds::zero()) {
+    return {};
+  }
+  const auto load = arrival_rate * service_time.count();
+  const auto erlang_b = ErlangB(server_count, load);
+  if (patience <= Seconds::zero()) {
+    return {
+        .wait_probability = erlang_b,
+        .abandonment_probability = erlang_b,
+        .average_wait = Seconds::zero()};
+  }
+  if (erlang_b == 0) {
+    return {};
+  }
+
+  // Вероятности состояний с очередью длины m пропорциональны произведениям
+  // x / (a + j), j = 1..m, где x = lambda / theta, a = n * mu / theta.
+  const auto x = arrival_rate * patience.count();
+  const auto a = static_cast<double>(server_count) * patience / service_time;
+  double term = 1;
+  double term_sum = 1;
+  double weighted_term_sum = 0;
+  size_t scale_count = 0;
+  for (size_t m = 1; m < kMaxSeriesTerms; ++m) {
+    const auto denominator = a + static_cast<double>(m);
+    term *= x / denominator;
+    term_sum += term;
+    weighted_term_sum += static_cast<double>(m) * term;
+    if (term > kSeriesScale) {
+      term /= kSeriesScale;
+      term_sum /= kSeriesScale;
+      weighted_term_sum /= kSeriesScale;
+      ++scale_count;
+    }
+    if (x < denominator && term < std::numeric_limits<double>::epsilon() * term_sum) {
+      break;
+    }
+  }
+
+  auto ratio = (1 - erlang_b) / (erlang_b * term_sum);
+  for (size_t i = 0; i < scale_count && ratio > 0; ++i) {
+    ratio /= kSeriesScale;
+  }
+  const auto wait_probability = 1 / (1 + ratio);
+  const auto average_queue_size = weighted_term_sum / term_sum * wait_probability;
+  return {
+      .wait_probability = wait_probability,
+      .abandonment_probability = average_queue_size / x,
+      .average_wait = Seconds(average_queue_size / arrival_rate)};
+}
+
+std::optional<size_t> GetRequiredServerCount(
+    const double load,
+    const Seconds service_time,
+    const Seconds target_answer_time,
+    const double target_service_level,
+    const size_t max_server_count
+) {
+  if (load <= 0 || service_time <= Seconds::zero()) {
+    return 0;
+  }
+  double erlang_b = 1;
+  for (size_t n = 1; n <= max_server_count; ++n) {
+    erlang_b = load * erlang_b / (static_cast<double>(n) + load * erlang_b);
+    if (static_cast<double>(n) <= load) {
+      continue;
+    }
+    const auto wait_probability = ErlangCFromB(n, load, erlang_b);
+    const auto service_level =
+        GetServiceLevel(n, load, wait_probability, service_time, target_answer_time);
+    if (service_level >= target_service_level) {
+      return n;
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace call_center::core::qs::metrics::erlang
@@ -0,0 +1,99 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_ERLANG_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_ERLANG_H_
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+/**
+ * @brief Формулы Эрланга для расчета количества обслуживающих приборов.
+ *
+ * Вероятности вычисляются через рекуррентное соотношение для Erlang B, которое устойчиво и
+ * выполняется за O(n) без факториалов и степеней, поэтому подходит для пулов из десятков тысяч
+ * приборов.
+ */
+namespace call_center::core::qs::metrics::erlang {
+
+/// Длительность в секундах.
+using Seconds = std::chrono::duration<double>;
+
+/**
+ * @brief Прогноз для модели Erlang C (M/M/n, без отказов от ожидания).
+ */
+struct ErlangCPrediction {
+  /// Вероятность того, что вызов будет ожидать в очереди.
+  double wait_probability = 1;
+  /// Доля вызовов, ожидающих не дольше целевого времени.
+  double service_level = 0;
+  /// Среднее время ожидания (бесконечность - если система перегружена).
+  Seconds average_wait{0};
+};
+
+/**
+ * @brief Прогноз для модели Erlang A (M/M/n+M, с экспоненциальным временем терпения).
+ */
+struct ErlangAPrediction {
+  /// Вероятность того, что вызов будет ожидать в очереди.
+  double wait_probability = 0;
+  /// Вероятность того, что вызов не дождется обслуживания.
+  double abandonment_probability = 0;
+  /// Среднее время ожидания среди всех вызовов.
+  Seconds average_wait{0};
+};
+
+/**
+ * @brief Вероятность блокировки Erlang B.
+ * @param server_count количество приборов
+ * @param load предложенная нагрузка в Эрлангах
+ */
+double ErlangB(size_t server_count, double load);
+
+/**
+ * @brief Вероятность ожидания Erlang C.
+ * @return 1 - если нагрузка не меньше количества приборов
+ */
+double ErlangC(size_t server_count, double load);
+
+/**
+ * @brief Прогноз Erlang C.
+ * @param server_count количество приборов
+ * @param load предложенная нагрузка в Эрлангах
+ * @param service_time среднее время обслуживания
+ * @param target_answer_time целевое время ожидания для расчета уровня обслуживания
+ */
+ErlangCPrediction PredictErlangC(
+    size_t server_count, double load, Seconds service_time, Seconds target_answer_time
+);
+
+/**
+ * @brief Прогноз Erlang A.
+ * @param server_count количество приборов
+ * @param arrival_rate интенсивность поступления вызовов (в секунду)
+ * @param service_time среднее время обслуживания
+ * @param patience среднее время терпения вызова (0 - вызовы не ожидают)
+ */
+ErlangAPrediction PredictErlangA(
+    size_t server_count, double arrival_rate, Seconds service_time, Seconds patience
+);
+
+/**
+ * @brief Минимальное количество приборов, при котором уровень обслуживания Erlang C не ниже
+ * целевого.
+ * @param load предложенная нагрузка в Эрлангах
+ * @param service_time среднее время обслуживания
+ * @param target_answer_time целевое время ожидания
+ * @param target_service_level целевая доля вызовов, ожидающих не дольше целевого времени
+ * @param max_server_count ограничение поиска
+ * @return std::nullopt - если цель не достигается при max_server_count приборах
+ */
+std::optional<size_t> GetRequiredServerCount(
+    double load,
+    Seconds service_time,
+    Seconds target_answer_time,
+    double target_service_level,
+    size_t max_server_count
+);
+
+}  // namespace call_center::core::qs::metrics::erlang
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_ERLANG_H_
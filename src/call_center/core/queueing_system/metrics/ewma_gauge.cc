@@ -0,0 +1,30 @@
+#include "ewma_gauge.h"
+
+#include <cmath>
+
+namespace call_center::core::qs::metrics {
+
+using namespace std::chrono;
+
+void EwmaGauge::Update(const double value, const Duration elapsed) {
+  const auto initialized = initialized_.exchange(true, std::memory_order_relaxed);
+  for (size_t i = 0; i < kTimeConstants.size(); ++i) {
+    if (!initialized) {
+      averages_[i].store(value, std::memory_order_relaxed);
+      continue;
+    }
+    const auto alpha = 1 - std::exp(-duration<double>(elapsed) / kTimeConstants[i]);
+    const auto average = averages_[i].load(std::memory_order_relaxed);
+    averages_[i].store(average + alpha * (value - average), std::memory_order_relaxed);
+  }
+}
+
+EwmaGauge::Snapshot EwmaGauge::Get() const {
+  Snapshot snapshot{};
+  for (size_t i = 0; i < kTimeConstants.size(); ++i) {
+    snapshot[i] = averages_[i].load(std::memory_order_relaxed);
+  }
+  return snapshot;
+}
+
+}  // namespace call_center::core::qs::metrics
@@ -0,0 +1,50 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_EWMA_GAUGE_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_EWMA_GAUGE_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace call_center::core::qs::metrics {
+
+/**
+ * @brief Экспоненциально взвешенные скользящие средние показателя за 1, 5 и 15 минут (аналогично
+ * средней загрузке в Unix).
+ *
+ * Вес нового значения зависит от времени, прошедшего с предыдущего обновления, поэтому средние
+ * не зависят от периода обновления. Обновлять показатель должен один поток, читать - любые.
+ */
+class EwmaGauge {
+ public:
+  using Duration = std::chrono::milliseconds;
+
+  /// Постоянные времени, для которых вычисляются средние.
+  static constexpr std::array<std::chrono::minutes, 3> kTimeConstants{
+      std::chrono::minutes(1), std::chrono::minutes(5), std::chrono::minutes(15)};
+
+  /// Средние значения для каждой из @link kTimeConstants постоянных времени@endlink.
+  using Snapshot = std::array<double, kTimeConstants.size()>;
+
+  EwmaGauge() = default;
+  EwmaGauge(const EwmaGauge &other) = delete;
+  EwmaGauge &operator=(const EwmaGauge &other) = delete;
+
+  /**
+   * @brief Учесть новое значение показателя.
+   * @param value значение показателя на прошедшем промежутке
+   * @param elapsed время, прошедшее с предыдущего обновления
+   */
+  void Update(double value, Duration elapsed);
+  /**
+   * @brief Текущие средние значения.
+   */
+  [[nodiscard]] Snapshot Get() const;
+
+ private:
+  std::array<std::atomic<double>, kTimeConstants.size()> averages_{};
+  std::atomic_bool initialized_ = false;
+};
+
+}  // namespace call_center::core::qs::metrics
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_EWMA_GAUGE_H_
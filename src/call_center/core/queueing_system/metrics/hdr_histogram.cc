@@ -0,0 +1,124 @@
+#include "hdr_histogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace call_center::core::qs::metrics {
+
+namespace {
+
+constexpr uint64_t kHalfSubBucketCount = HdrHistogram::kSubBucketCount / 2;
+constexpr uint64_t kMaxValue = (uint64_t{1} << HdrHistogram::kValueBits) - 1;
+
+}  // namespace
+
+void HdrHistogram::Record(Duration value) {
+  value = std::max(value, Duration::zero());
+  const auto count = value.count();
+  buckets_[GetBucketIndex(static_cast<uint64_t>(count))].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(count, std::memory_order_relaxed);
+
+  auto min = min_.load(std::memory_order_relaxed);
+  while (count < min && !min_.compare_exchange_weak(min, count, std::memory_order_relaxed)) {
+  }
+  auto max = max_.load(std::memory_order_relaxed);
+  while (count > max && !max_.compare_exchange_weak(max, count, std::memory_order_relaxed)) {
+  }
+}
+
+HdrHistogram::Snapshot HdrHistogram::GetSnapshot() const {
+  Snapshot snapshot;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  }
+  snapshot.count = count_.load(std::memory_order_relaxed);
+  snapshot.sum = Duration(sum_.load(std::memory_order_relaxed));
+  snapshot.min = Duration(min_.load(std::memory_order_relaxed));
+  snapshot.max = Duration(max_.load(std::memory_order_relaxed));
+  return snapshot;
+}
+
+size_t HdrHistogram::GetBucketIndex(uint64_t value) {
+  value = std::min(value, kMaxValue);
+  if (value < kSubBucketCount) {
+    return value;
+  }
+  const auto shift = static_cast<size_t>(std::bit_width(value)) - kSubBucketBits;
+  const auto sub_bucket = (value >> shift) - kHalfSubBucketCount;
+  return kSubBucketCount + (shift - 1) * kHalfSubBucketCount + sub_bucket;
+}
+
+uint64_t HdrHistogram::GetBucketLowerBound(const size_t bucket) {
+  if (bucket < kSubBucketCount) {
+    return bucket;
+  }
+  const auto offset = bucket - kSubBucketCount;
+  const auto shift = offset / kHalfSubBucketCount + 1;
+  return (offset % kHalfSubBucketCount + kHalfSubBucketCount) << shift;
+}
+
+uint64_t HdrHistogram::GetBucketUpperBound(const size_t bucket) {
+  if (bucket + 1 >= kBucketCount) {
+    return kMaxValue;
+  }
+  return GetBucketLowerBound(bucket + 1) - 1;
+}
+
+uint64_t HdrHistogram::GetPercentileUpperBound(
+    const std::span<const uint64_t, kBucketCount> buckets,
+    const uint64_t count,
+    const double percentile
+) {
+  const auto rank = std::max(
+      static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 1.0) * count)), uint64_t{1}
+  );
+  uint64_t accumulated = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    accumulated += buckets[i];
+    if (accumulated >= rank) {
+      return GetBucketUpperBound(i);
+    }
+  }
+  return kMaxValue;
+}
+
+void HdrHistogram::Snapshot::Merge(const Snapshot &other) {
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    buckets[i] += other.buckets[i];
+  }
+  count += other.count;
+  sum += other.sum;
+  min = std::min(min, other.min);
+  max = std::max(max, other.max);
+}
+
+void HdrHistogram::Snapshot::Subtract(const Snapshot &previous) {
+  count = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    buckets[i] -= std::min(buckets[i], previous.buckets[i]);
+    count += buckets[i];
+  }
+  sum = std::max(sum - previous.sum, Duration::zero());
+}
+
+HdrHistogram::Duration HdrHistogram::Snapshot::GetMin() const {
+  return count == 0 ? Duration::zero() : min;
+}
+
+HdrHistogram::Duration HdrHistogram::Snapshot::GetAvg() const {
+  if (count == 0) {
+    return Duration::zero();
+  }
+  return sum / count;
+}
+
+HdrHistogram::Duration HdrHistogram::Snapshot::GetPercentile(const double percentile) const {
+  if (count == 0) {
+    return Duration::zero();
+  }
+  return std::min(Duration(GetPercentileUpperBound(buckets, count, percentile)), max);
+}
+
+}  // namespace call_center::core::qs::metrics
@@ -0,0 +1,121 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_HDR_HISTOGRAM_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_HDR_HISTOGRAM_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace call_center::core::qs::metrics {
+
+/**
+ * @brief Потокобезопасная гистограмма длительностей с логарифмически-линейными корзинами (в стиле
+ * HdrHistogram).
+ *
+ * Значения меньше @link kSubBucketCount @endlink хранятся точно, а каждый следующий интервал
+ * [2^k, 2^(k+1)) делится на @link kSubBucketCount @endlink / 2 равных корзин, поэтому
+ * относительная погрешность не превышает 2 / @link kSubBucketCount @endlink (~3%). Запись
+ * выполняется за константное время без блокировок, объем памяти фиксирован.
+ */
+class HdrHistogram {
+ public:
+  using Duration = std::chrono::milliseconds;
+
+  /// Количество бит, определяющих корзину внутри степени двойки.
+  static constexpr size_t kSubBucketBits = 6;
+  /// Количество точно хранимых значений.
+  static constexpr size_t kSubBucketCount = size_t{1} << kSubBucketBits;
+  /// Количество бит в максимальном записываемом значении, большие значения ограничиваются им.
+  static constexpr size_t kValueBits = 32;
+  /// Количество корзин гистограммы.
+  static constexpr size_t kBucketCount =
+      kSubBucketCount + (kValueBits - kSubBucketBits) * (kSubBucketCount / 2);
+
+  /**
+   * @brief Снимок состояния гистограммы.
+   */
+  struct Snapshot {
+    std::array<uint64_t, kBucketCount> buckets{};
+    uint64_t count = 0;
+    Duration sum{0};
+    Duration min{std::numeric_limits<Duration::rep>::max()};
+    Duration max{0};
+
+    /**
+     * @brief Добавить значения из другого снимка (например, другого сегмента метрик).
+     */
+    void Merge(const Snapshot &other);
+    /**
+     * @brief Оставить только значения, записанные после предыдущего снимка той же гистограммы.
+     *
+     * Минимум и максимум не вычитаются и остаются границами всех значений.
+     */
+    void Subtract(const Snapshot &previous);
+    /**
+     * @brief Минимальное значение.
+     */
+    [[nodiscard]] Duration GetMin() const;
+    /**
+     * @brief Среднее значение.
+     */
+    [[nodiscard]] Duration GetAvg() const;
+    /**
+     * @brief Оценка перцентиля сверху (по верхней границе корзины).
+     * @param percentile значение из [0, 1]
+     */
+    [[nodiscard]] Duration GetPercentile(double percentile) const;
+  };
+
+  HdrHistogram() = default;
+  HdrHistogram(const HdrHistogram &other) = delete;
+  HdrHistogram &operator=(const HdrHistogram &other) = delete;
+
+  /**
+   * @brief Добавить новое значение.
+   */
+  void Record(Duration value);
+  /**
+   * @brief Получить снимок состояния гистограммы.
+   *
+   * Снимок не является атомарным по отношению к параллельным записям, но каждое отдельное
+   * значение в нем корректно.
+   */
+  [[nodiscard]] Snapshot GetSnapshot() const;
+
+  /**
+   * @brief Номер корзины, в которую попадает значение.
+   */
+  static size_t GetBucketIndex(uint64_t value);
+  /**
+   * @brief Нижняя граница значений корзины.
+   */
+  static uint64_t GetBucketLowerBound(size_t bucket);
+  /**
+   * @brief Верхняя граница значений корзины (включительно).
+   */
+  static uint64_t GetBucketUpperBound(size_t bucket);
+  /**
+   * @brief Оценка перцентиля сверху по количеству значений в корзинах.
+   *
+   * Используется и другими гистограммами с такими же корзинами.
+   * @param count общее количество значений в корзинах, больше 0
+   * @param percentile значение из [0, 1]
+   * @return Верхняя граница корзины, в которую попадает перцентиль.
+   */
+  static uint64_t GetPercentileUpperBound(
+      std::span<const uint64_t, kBucketCount> buckets, uint64_t count, double percentile
+  );
+
+ private:
+  std::array<std::atomic_uint64_t, kBucketCount> buckets_{};
+  std::atomic_uint64_t count_ = 0;
+  std::atomic_int64_t sum_ = 0;
+  std::atomic_int64_t min_ = std::numeric_limits<int64_t>::max();
+  std::atomic_int64_t max_ = 0;
+};
+
+}  // namespace call_center::core::qs::metrics
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_HDR_HISTOGRAM_H_
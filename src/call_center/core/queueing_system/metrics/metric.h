@@ -19,7 +19,17 @@ class Metric {
    * @param default_value значение показателя по умолчанию
    */
   explicit Metric(T default_value);
+  /**
+   * @brief Создать метрику по уже подсчитанным значениям.
+   */
+  Metric(T min, T max, AvgT avg, size_t count);
 
+  /**
+   * @brief Объединить с метрикой, собранной независимо (например, в другом потоке).
+   *
+   * Результат совпадает с тем, как если бы все значения были добавлены в одну метрику.
+   */
+  void Merge(const Metric &other);
   /**
    * @brief Добавить новое значение показателя.
    */
@@ -53,6 +63,27 @@ Metric<T, AvgT>::Metric(T default_value)
     : min_(default_value), max_(default_value), avg_(default_value) {
 }
 
+template <typename T, typename AvgT>
+Metric<T, AvgT>::Metric(T min, T max, AvgT avg, size_t count)
+    : min_(min), max_(max), avg_(avg), count_(count) {
+}
+
+template <typename T, typename AvgT>
+void Metric<T, AvgT>::Merge(const Metric &other) {
+  if (other.count_ == 0) {
+    return;
+  }
+  if (count_ == 0) {
+    *this = other;
+    return;
+  }
+  const auto count = count_ + other.count_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  avg_ = AvgT((avg_ * count_ + other.avg_ * other.count_) / count);
+  count_ = count;
+}
+
 template <typename T, typename AvgT>
 void Metric<T, AvgT>::AddValue(T value) {
   ++count_;
@@ -1,8 +1,9 @@
 #include "queueing_system_metrics.h"
 
+#include <boost/uuid/uuid_io.hpp>
+#include <bit>
 #include <mutex>
-#include <ranges>
-#include <unordered_set>
+#include <thread>
 
 #include "service_metrics.h"
 
@@ -28,7 +29,8 @@ QueueingSystemMetrics::QueueingSystemMetrics(
     : clock_(std::move(clock)),
       configuration_(std::move(configuration)),
       task_manager_(std::move(task_manager)),
-      logger_(logger_provider.Get("QueueingSystemMetrics")) {
+      logger_(logger_provider.Get("QueueingSystemMetrics")),
+      shards_(std::bit_ceil(std::max(1U, std::thread::hardware_concurrency()))) {
 }
 
 void QueueingSystemMetrics::Start() {
@@ -42,7 +44,10 @@ void QueueingSystemMetrics::Start() {
 
 void QueueingSystemMetrics::Reset() {
   logger_->Info() << "Reset recording start time";
-  recording_start_time_ = std::chrono::time_point_cast<Duration>(clock_->Now());
+  const auto now = Now();
+  std::lock_guard lock(periodic_mutex_);
+  recording_start_time_ = now;
+  start_gauges_ = GetGaugesSnapshot(now);
 }
 
 void QueueingSystemMetrics::Stop() {
@@ -55,55 +60,88 @@ void QueueingSystemMetrics::Stop() {
 
 void QueueingSystemMetrics::RecordRequestArrival(const RequestPtr &request) {
   assert(request->WasArrived());
-  std::lock_guard lock(queue_mutex_);
-  ++arrival_count_;
-  ++current_in_system_count_;
-  ++current_queue_size_;
+  auto &shard = GetShard();
+  const auto arrival_time = *request->GetArrivalTime();
+  shard.arrival_count.fetch_add(1, std::memory_order_relaxed);
+  shard.in_system_count.Add(arrival_time, 1);
+  shard.queue_size.Add(arrival_time, 1);
   UpdateAvgTimeBetweenRequests(*request->GetArrivalTime());
+  window_metrics_.RecordArrival(Now());
 }
 
 void QueueingSystemMetrics::RecordServiceStart(const RequestPtr &request) {
   assert(request->GetWaitTime());
-  std::lock_guard lock(queue_mutex_);
-  --current_queue_size_;
-  wait_time_.AddValue(*request->GetWaitTime());
+  auto &shard = GetShard();
+  const auto start_time = *request->GetServiceStartTime();
+  shard.queue_size.Add(start_time, -1);
+  shard.busy_server_count.Add(start_time, 1);
+  shard.wait_time.AddValue(*request->GetWaitTime());
+  shard.wait_time_histogram.Record(*request->GetWaitTime());
+  window_metrics_.RecordServiceStart(Now(), *request->GetWaitTime());
 }
 
 void QueueingSystemMetrics::RecordServiceComplete(
     const RequestPtr &request, const ServerPtr &server
 ) {
   assert(request->WasServiced());
-  std::lock_guard service_lock(service_mutex_);
-  assert(servers_metrics_.contains(server));
-  GetServerMetrics(server).AddCompletedService(*request->GetServiceTime());
   {
-    std::lock_guard queue_lock(queue_mutex_);
-    --current_in_system_count_;
+    std::shared_lock service_lock(service_mutex_);
+    assert(server->GetIndex() < server_slot_count_);
+    assert(GetServerSlot(server->GetIndex()).server == server);
+    GetServerSlot(server->GetIndex()).metrics.AddCompletedService(*request->GetServiceTime());
   }
+  auto &shard = GetShard();
+  const auto complete_time = *request->GetServiceCompleteTime();
+  shard.in_system_count.Add(complete_time, -1);
+  shard.busy_server_count.Add(complete_time, -1);
+  shard.service_time.AddValue(*request->GetServiceTime());
+  shard.service_time_histogram.Record(*request->GetServiceTime());
+  shard.total_time_histogram.Record(*request->GetTotalTime());
+  window_metrics_.RecordServiceComplete(Now(), *request->GetServiceTime());
 }
 
 void QueueingSystemMetrics::RecordRequestDropout(const RequestPtr &request) {
   assert(request->WasFinished());
-  {
-    std::lock_guard queue_lock(queue_mutex_);
-    --current_queue_size_;
-    --current_in_system_count_;
-  }
-  std::lock_guard dropout_lock(dropout_mutex_);
-  ++dropout_count_;
-  refused_wait_time_.AddValue(*request->GetWaitTime());
+  auto &shard = GetShard();
+  const auto dropout_time = *request->GetServiceCompleteTime();
+  shard.queue_size.Add(dropout_time, -1);
+  shard.in_system_count.Add(dropout_time, -1);
+  shard.dropout_count.fetch_add(1, std::memory_order_relaxed);
+  shard.refused_wait_time.AddValue(*request->GetWaitTime());
+  window_metrics_.RecordDropout(Now());
 }
 
 void QueueingSystemMetrics::UpdatePeriodicMetrics() {
-  {
-    std::lock_guard queue_lock(queue_mutex_);
-    queue_size_.AddValue(current_queue_size_);
-    in_system_count_.AddValue(current_in_system_count_);
-  }
-  {
-    std::lock_guard service_lock(service_mutex_);
-    busy_server_count_.AddValue(GetCurrentBusyServerCount());
+  const auto gauges = GetGaugesSnapshot(Now());
+  const auto to_count = [](const TimeWeightedGauge::Snapshot &gauge) {
+    return static_cast<size_t>(std::max<int64_t>(0, gauge.value));
+  };
+
+  std::lock_guard lock(periodic_mutex_);
+  queue_size_.AddValue(to_count(gauges.queue_size));
+  in_system_count_.AddValue(to_count(gauges.in_system_count));
+  busy_server_count_.AddValue(to_count(gauges.busy_server_count));
+  UpdateEwmaGauges(gauges);
+}
+
+void QueueingSystemMetrics::UpdateEwmaGauges(const GaugesSnapshot &gauges) {
+  using std::chrono::seconds;
+
+  if (prev_periodic_gauges_) {
+    const auto &prev = *prev_periodic_gauges_;
+    const auto elapsed = gauges.queue_size.time - prev.queue_size.time;
+    const auto window =
+        std::max(std::chrono::round<seconds>(elapsed), SlidingWindowMetrics::kBucketDuration);
+    queue_size_ewma_.Update(gauges.queue_size.GetAverageSince(prev.queue_size), elapsed);
+    busy_server_count_ewma_.Update(
+        gauges.busy_server_count.GetAverageSince(prev.busy_server_count), elapsed
+    );
+    service_load_ewma_.Update(
+        window_metrics_.GetSnapshot(gauges.queue_size.time, window).GetServiceLoadInErlang(),
+        elapsed
+    );
   }
+  prev_periodic_gauges_ = gauges;
 }
 
 void QueueingSystemMetrics::ScheduleUpdatePeriodicMetrics() {
@@ -120,39 +158,223 @@ void QueueingSystemMetrics::ScheduleUpdatePeriodicMetrics() {
   );
 }
 
-size_t QueueingSystemMetrics::GetCurrentBusyServerCount() const {
-  size_t count = 0;
-  for (const auto &server : std::views::keys(servers_metrics_)) {
-    if (server->IsBusy()) {
-      ++count;
+void QueueingSystemMetrics::UpdateAvgTimeBetweenRequests(TimePoint last_arrival_time_) {
+  const auto prev_arrival = prev_arrival_.exchange(last_arrival_time_, std::memory_order_relaxed);
+  if (prev_arrival != TimePoint::min()) {
+    // запросы из разных потоков могут фиксироваться не в порядке получения
+    const Duration cur_duration = std::max(Duration(0), last_arrival_time_ - prev_arrival);
+    GetShard().time_between_requests.AddValue(cur_duration);
+  }
+}
+
+void QueueingSystemMetrics::AddServer(const std::shared_ptr<Server> &server) {
+  const auto now = Now();
+  std::lock_guard lock(service_mutex_);
+  size_t index = server_slot_count_;
+  if (!free_server_indexes_.empty()) {
+    index = free_server_indexes_.top();
+    free_server_indexes_.pop();
+  } else {
+    if (index == server_slot_chunks_.size() * kServerSlotChunkSize) {
+      server_slot_chunks_.push_back(std::make_unique<ServerSlotChunk>());
     }
+    ++server_slot_count_;
   }
-  return count;
+  auto &slot = GetServerSlot(index);
+  slot.server = server;
+  slot.added_time = now;
+  server->SetIndex(index);
 }
 
-void QueueingSystemMetrics::UpdateAvgTimeBetweenRequests(TimePoint last_arrival_time_) {
-  if (prev_arrival_) {
-    const Duration cur_duration = last_arrival_time_ - *prev_arrival_;
-    time_between_requests_.AddValue(cur_duration);
+void QueueingSystemMetrics::RemoveServer(const ServerPtr &server) {
+  std::lock_guard lock(service_mutex_);
+  const auto index = server->GetIndex();
+  if (index >= server_slot_count_ || GetServerSlot(index).server != server) {
+    logger_->Warning() << "Remove unknown server " << boost::uuids::to_string(server->GetId());
+    return;
   }
-  prev_arrival_ = last_arrival_time_;
+  auto &slot = GetServerSlot(index);
+  retired_service_time_.Merge(slot.metrics.GetServiceTimeMetric());
+  ++retired_server_count_;
+  slot.metrics.Reset();
+  slot.server = nullptr;
+  free_server_indexes_.push(index);
 }
 
-ServiceMetrics &QueueingSystemMetrics::GetServerMetrics(const ServerPtr &server) {
-  return servers_metrics_.find(server)->second;
+QueueingSystemMetrics::Snapshot QueueingSystemMetrics::GetSnapshot() const {
+  const auto now = Now();
+  Snapshot snapshot;
+  Duration total_service_time{0};
+  for (const auto &shard : shards_) {
+    snapshot.arrival_count += shard.arrival_count.load(std::memory_order_relaxed);
+    snapshot.dropout_count += shard.dropout_count.load(std::memory_order_relaxed);
+    snapshot.wait_time.Merge(shard.wait_time.Load());
+    snapshot.refused_wait_time.Merge(shard.refused_wait_time.Load());
+    snapshot.time_between_requests.Merge(shard.time_between_requests.Load());
+    snapshot.service_time.Merge(shard.service_time.Load());
+    total_service_time += shard.service_time.GetSum();
+    snapshot.wait_time_histogram.Merge(shard.wait_time_histogram.GetSnapshot());
+    snapshot.service_time_histogram.Merge(shard.service_time_histogram.GetSnapshot());
+    snapshot.total_time_histogram.Merge(shard.total_time_histogram.GetSnapshot());
+  }
+  snapshot.serviced_count = snapshot.service_time.GetCount();
+  snapshot.probability_of_loss =
+      CalculateProbabilityOfLoss(snapshot.arrival_count, snapshot.dropout_count);
+  snapshot.service_load_erlang = CalculateServiceLoadInErlang(total_service_time, now);
+
+  const auto gauges = GetGaugesSnapshot(now);
+  {
+    std::shared_lock lock(periodic_mutex_);
+    snapshot.queue_size =
+        WithTimeWeightedAverage(queue_size_, gauges, &GaugesSnapshot::queue_size);
+    snapshot.busy_server_count =
+        WithTimeWeightedAverage(busy_server_count_, gauges, &GaugesSnapshot::busy_server_count);
+    snapshot.in_system_count =
+        WithTimeWeightedAverage(in_system_count_, gauges, &GaugesSnapshot::in_system_count);
+  }
+
+  snapshot.queue_size_ewma = queue_size_ewma_.Get();
+  snapshot.busy_server_count_ewma = busy_server_count_ewma_.Get();
+  snapshot.service_load_erlang_ewma = service_load_ewma_.Get();
+  snapshot.scaling = GetScalingMetrics();
+  return snapshot;
 }
 
-size_t QueueingSystemMetrics::GetServicedCount() const {
-  size_t count = 0;
-  for (const auto &metrics : std::views::values(servers_metrics_)) {
-    count += metrics.GetServicedCount();
+QueueingSystemMetrics::ServersSnapshot QueueingSystemMetrics::GetServersMetrics() const {
+  const auto now = Now();
+  const auto recording_start_time = recording_start_time_.load();
+  std::shared_lock lock(service_mutex_);
+  ServersSnapshot snapshot;
+  snapshot.retired_count = retired_server_count_;
+  snapshot.retired_service_time = retired_service_time_;
+  ForEachServerSlot([&](const ServerSlot &slot) {
+    const auto service_time = slot.metrics.GetServiceTimeMetric();
+    const auto active_time = now - std::max(slot.added_time, recording_start_time);
+    const auto utilization = active_time.count() > 0
+                                 ? static_cast<double>(slot.metrics.GetTotalServiceTime().count()) /
+                                       static_cast<double>(active_time.count())
+                                 : 0.0;
+    snapshot.servers.push_back(
+        {.index = slot.server->GetIndex(),
+         .id = slot.server->GetId(),
+         .service_time = service_time,
+         .utilization = std::min(utilization, 1.0)}
+    );
+  });
+  return snapshot;
+}
+
+size_t QueueingSystemMetrics::GetServerCount() const {
+  std::shared_lock lock(service_mutex_);
+  return server_slot_count_ - free_server_indexes_.size();
+}
+
+void QueueingSystemMetrics::RecordScalingDecision(
+    const size_t previous_count, const size_t desired_count, const size_t target_count
+) {
+  scaling_decision_count_.fetch_add(1, std::memory_order_relaxed);
+  if (target_count > previous_count) {
+    scale_up_count_.fetch_add(1, std::memory_order_relaxed);
+  } else if (target_count < previous_count) {
+    scale_down_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  desired_server_count_.store(desired_count, std::memory_order_relaxed);
+  target_server_count_.store(target_count, std::memory_order_relaxed);
+}
+
+QueueingSystemMetrics::ScalingSnapshot QueueingSystemMetrics::GetScalingMetrics() const {
+  return {
+      .decision_count = scaling_decision_count_.load(std::memory_order_relaxed),
+      .scale_up_count = scale_up_count_.load(std::memory_order_relaxed),
+      .scale_down_count = scale_down_count_.load(std::memory_order_relaxed),
+      .desired_count = desired_server_count_.load(std::memory_order_relaxed),
+      .target_count = target_server_count_.load(std::memory_order_relaxed)};
+}
+
+QueueingSystemMetrics::ServerSlot &QueueingSystemMetrics::GetServerSlot(const size_t index) {
+  return (*server_slot_chunks_[index / kServerSlotChunkSize])[index % kServerSlotChunkSize];
+}
+
+const QueueingSystemMetrics::ServerSlot &QueueingSystemMetrics::GetServerSlot(const size_t index
+) const {
+  return (*server_slot_chunks_[index / kServerSlotChunkSize])[index % kServerSlotChunkSize];
+}
+
+QueueingSystemMetrics::Shard &QueueingSystemMetrics::GetShard() {
+  static std::atomic<size_t> next_thread_index = 0;
+  static thread_local const size_t thread_index = next_thread_index.fetch_add(1);
+  return shards_[thread_index & (shards_.size() - 1)];
+}
+
+HdrHistogram::Snapshot QueueingSystemMetrics::MergeShards(HdrHistogram Shard::*histogram) const {
+  HdrHistogram::Snapshot result;
+  for (const auto &shard : shards_) {
+    result.Merge((shard.*histogram).GetSnapshot());
+  }
+  return result;
+}
+
+QueueingSystemMetrics::TimePoint QueueingSystemMetrics::Now() const {
+  return std::chrono::time_point_cast<Duration>(clock_->Now());
+}
+
+QueueingSystemMetrics::GaugesSnapshot QueueingSystemMetrics::GetGaugesSnapshot(const TimePoint now
+) const {
+  GaugesSnapshot gauges{
+      .queue_size = {.time = now},
+      .in_system_count = {.time = now},
+      .busy_server_count = {.time = now}};
+  for (const auto &shard : shards_) {
+    gauges.queue_size.Merge(shard.queue_size.GetSnapshot(now));
+    gauges.in_system_count.Merge(shard.in_system_count.GetSnapshot(now));
+    gauges.busy_server_count.Merge(shard.busy_server_count.GetSnapshot(now));
+  }
+  return gauges;
+}
+
+Metric<size_t, double> QueueingSystemMetrics::WithTimeWeightedAverage(
+    const Metric<size_t, double> &samples,
+    const GaugesSnapshot &gauges,
+    TimeWeightedGauge::Snapshot GaugesSnapshot::*gauge
+) const {
+  const auto average = (gauges.*gauge).GetAverageSince(start_gauges_.*gauge);
+  return {samples.GetMin(), samples.GetMax(), average, samples.GetCount()};
+}
+
+QueueingSystemMetrics::Duration QueueingSystemMetrics::GetTotalServiceTime() const {
+  Duration total_service_time{0};
+  for (const auto &shard : shards_) {
+    total_service_time += shard.service_time.GetSum();
+  }
+  return total_service_time;
+}
+
+double QueueingSystemMetrics::CalculateServiceLoadInErlang(
+    const Duration total_service_time, const TimePoint now
+) const {
+  const auto duration_since_start = now - recording_start_time_.load();
+  if (duration_since_start.count() <= 0) {
+    return 0;
   }
-  return count;
+  return static_cast<double>(total_service_time.count()) /
+         static_cast<double>(duration_since_start.count());
+}
+
+double QueueingSystemMetrics::CalculateProbabilityOfLoss(
+    const size_t arrival_count, const size_t dropout_count
+) {
+  if (arrival_count == 0) {
+    return 0;
+  }
+  return static_cast<double>(dropout_count) / static_cast<double>(arrival_count);
+}
+
+size_t QueueingSystemMetrics::GetServicedCount() const {
+  return MergeShards(&Shard::service_time).GetCount();
 }
 
 size_t QueueingSystemMetrics::GetArrivalCount() const {
-  std::shared_lock lock(queue_mutex_);
-  return arrival_count_;
+  return SumShards(&Shard::arrival_count);
 }
 
 void QueueingSystemMetrics::UpdateMetricsUpdateTime() {
@@ -160,84 +382,80 @@ void QueueingSystemMetrics::UpdateMetricsUpdateTime() {
 }
 
 Metric<QueueingSystemMetrics::Duration> QueueingSystemMetrics::GetWaitTimeMetric() const {
-  std::shared_lock lock(queue_mutex_);
-  return wait_time_;
+  return MergeShards(&Shard::wait_time);
+}
+
+HdrHistogram::Snapshot QueueingSystemMetrics::GetWaitTimeHistogram() const {
+  return MergeShards(&Shard::wait_time_histogram);
+}
+
+HdrHistogram::Snapshot QueueingSystemMetrics::GetServiceTimeHistogram() const {
+  return MergeShards(&Shard::service_time_histogram);
+}
+
+HdrHistogram::Snapshot QueueingSystemMetrics::GetTotalTimeHistogram() const {
+  return MergeShards(&Shard::total_time_histogram);
+}
+
+SlidingWindowMetrics::Snapshot QueueingSystemMetrics::GetWindowMetrics(
+    const std::chrono::seconds window
+) const {
+  return window_metrics_.GetSnapshot(Now(), window);
+}
+
+EwmaGauge::Snapshot QueueingSystemMetrics::GetQueueSizeEwma() const {
+  return queue_size_ewma_.Get();
+}
+
+EwmaGauge::Snapshot QueueingSystemMetrics::GetBusyServerCountEwma() const {
+  return busy_server_count_ewma_.Get();
+}
+
+EwmaGauge::Snapshot QueueingSystemMetrics::GetServiceLoadInErlangEwma() const {
+  return service_load_ewma_.Get();
 }
 
 Metric<size_t, double> QueueingSystemMetrics::GetQueueSizeMetric() const {
-  std::shared_lock lock(queue_mutex_);
-  return queue_size_;
+  const auto gauges = GetGaugesSnapshot(Now());
+  std::shared_lock lock(periodic_mutex_);
+  return WithTimeWeightedAverage(queue_size_, gauges, &GaugesSnapshot::queue_size);
 }
 
 Metric<size_t, double> QueueingSystemMetrics::GetBusyServerCountMetric() const {
-  std::shared_lock lock(service_mutex_);
-  return busy_server_count_;
+  const auto gauges = GetGaugesSnapshot(Now());
+  std::shared_lock lock(periodic_mutex_);
+  return WithTimeWeightedAverage(busy_server_count_, gauges, &GaugesSnapshot::busy_server_count);
 }
 
 double QueueingSystemMetrics::GetServiceLoadInErlang() const {
-  std::shared_lock lock(service_mutex_);
-  Duration total_service_time(0);
-  for (const auto &service_metrics : std::views::values(servers_metrics_)) {
-    total_service_time += service_metrics.GetTotalServiceTime();
-  }
-  const auto duration_since_start =
-      std::chrono::duration_cast<Duration>(clock_->Now() - recording_start_time_.load());
-  return static_cast<double>(total_service_time.count()) /
-         static_cast<double>(duration_since_start.count());
+  return CalculateServiceLoadInErlang(GetTotalServiceTime(), Now());
 }
 
 Metric<QueueingSystemMetrics::Duration> QueueingSystemMetrics::GetTimeBetweenRequestsMetric(
 ) const {
-  std::shared_lock lock(queue_mutex_);
-  return time_between_requests_;
+  return MergeShards(&Shard::time_between_requests);
 }
 
 size_t QueueingSystemMetrics::GetDropoutCount() const {
-  std::shared_lock lock(dropout_mutex_);
-  return dropout_count_;
+  return SumShards(&Shard::dropout_count);
 }
 
 Metric<QueueingSystemMetrics::Duration> QueueingSystemMetrics::GetRefusedWaitTimeMetric() const {
-  std::shared_lock lock(dropout_mutex_);
-  return refused_wait_time_;
+  return MergeShards(&Shard::refused_wait_time);
 }
 
 QueueingSystemMetrics::Duration QueueingSystemMetrics::GetAverageServiceTime() const {
-  std::shared_lock lock(service_mutex_);
-  Duration avg_service_time_{0};
-  for (const auto &service_metrics : std::views::values(servers_metrics_)) {
-    avg_service_time_ += service_metrics.GetServiceTimeMetric().GetAvg();
-  }
-  return avg_service_time_;
+  return MergeShards(&Shard::service_time).GetAvg();
 }
 
 Metric<size_t, double> QueueingSystemMetrics::GetRequestCountInSystemMetric() const {
-  std::shared_lock lock(queue_mutex_);
-  return in_system_count_;
+  const auto gauges = GetGaugesSnapshot(Now());
+  std::shared_lock lock(periodic_mutex_);
+  return WithTimeWeightedAverage(in_system_count_, gauges, &GaugesSnapshot::in_system_count);
 }
 
 double QueueingSystemMetrics::GetProbabilityOfLoss() const {
-  std::shared_lock service_lock(service_mutex_);
-  const size_t serviced_count = GetServicedCount();
-  service_lock.unlock();
-  std::shared_lock queue_lock(queue_mutex_);
-  return static_cast<double>(serviced_count) / static_cast<double>(arrival_count_);
-}
-
-bool QueueingSystemMetrics::ServerEquals::operator()(
-    const ServerPtr &first, const ServerPtr &second
-) const {
-  if ((first == nullptr) ^ (second == nullptr))
-    return false;
-
-  if (first == nullptr)
-    return true;
-
-  return first->GetId() == second->GetId();
-}
-
-size_t QueueingSystemMetrics::ServerHash::operator()(const ServerPtr &server) const {
-  return server->hash();
+  return CalculateProbabilityOfLoss(GetArrivalCount(), GetDropoutCount());
 }
 
 }  // namespace call_center::core::qs::metrics
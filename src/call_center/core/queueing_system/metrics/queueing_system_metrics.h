@@ -1,26 +1,43 @@
 #ifndef CALL_CENTER_SRC_CALL_CENTER_QUEUEING_SYSTEM_METRICS_H_
 #define CALL_CENTER_SRC_CALL_CENTER_QUEUEING_SYSTEM_METRICS_H_
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <functional>
+#include <queue>
 #include <shared_mutex>
-#include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
+#include "atomic_metric.h"
 #include "configuration/configuration.h"
 #include "core/clock_adapter.h"
+#include "core/instrumentation/instrumented_mutex.h"
 #include "core/queueing_system/request.h"
 #include "core/queueing_system/server.h"
 #include "core/tasks/task_manager.h"
+#include "ewma_gauge.h"
+#include "hdr_histogram.h"
 #include "metric.h"
 #include "operator.h"
 #include "service_metrics.h"
+#include "sliding_window_metrics.h"
+#include "time_weighted_gauge.h"
 
 /// Метрики для СМО.
 namespace call_center::core::qs::metrics {
 
 /**
  * @brief Класс для подсчета различных метрик для системы массового обслуживания.
+ *
+ * События записываются без общих блокировок: каждый поток пишет в свой
+ * @link Shard сегмент@endlink, а сегменты объединяются только при чтении метрик. Размер очереди,
+ * количество запросов в системе и количество занятых приборов изменяются при каждом событии
+ * вместе с их интегралами по времени, поэтому средние значения этих показателей точные и не
+ * зависят от периода обновления метрик.
+ *
+ * Для получения нескольких метрик сразу следует использовать @link GetSnapshot @endlink: он
+ * объединяет сегменты за один проход и берет только одну разделяемую блокировку.
  */
 class QueueingSystemMetrics : public std::enable_shared_from_this<QueueingSystemMetrics> {
  public:
@@ -36,6 +53,72 @@ class QueueingSystemMetrics : public std::enable_shared_from_this<QueueingSystem
   /// Ключ в конфигурации, соответствующий значению времени обновления метрик в секундах.
   static constexpr auto kMetricsUpdateTimeKey = "metrics_update_time";
 
+  /**
+   * @brief Метрики обслуживающего прибора.
+   */
+  struct ServerSnapshot {
+    /// Номер прибора (@link Server::GetIndex @endlink).
+    size_t index = 0;
+    Server::Id id{};
+    Metric<Duration> service_time{Duration(0)};
+    /// Доля времени с момента добавления прибора (или начала записи), занятая обслуживанием.
+    double utilization = 0;
+  };
+
+  /**
+   * @brief Метрики всех обслуживающих приборов.
+   */
+  struct ServersSnapshot {
+    /// Работающие приборы в порядке возрастания номеров.
+    std::vector<ServerSnapshot> servers;
+    /// Количество удаленных приборов.
+    size_t retired_count = 0;
+    /// Объединенные метрики времени обслуживания удаленных приборов.
+    Metric<Duration> retired_service_time{Duration(0)};
+  };
+
+  /**
+   * @brief Решения об изменении количества обслуживающих приборов.
+   */
+  struct ScalingSnapshot {
+    /// Количество принятых решений (включая решения оставить количество без изменений).
+    uint64_t decision_count = 0;
+    uint64_t scale_up_count = 0;
+    uint64_t scale_down_count = 0;
+    /// Количество приборов, рассчитанное по измерениям при последнем решении.
+    size_t desired_count = 0;
+    /// Количество приборов, установленное последним решением.
+    size_t target_count = 0;
+  };
+
+  /**
+   * @brief Снимок всех метрик системы, прочитанных за один проход.
+   */
+  struct Snapshot {
+    size_t arrival_count = 0;
+    size_t serviced_count = 0;
+    size_t dropout_count = 0;
+    /// Доля отклоненных запросов среди принятых.
+    double probability_of_loss = 0;
+    Metric<Duration> wait_time{Duration(0)};
+    Metric<Duration> refused_wait_time{Duration(0)};
+    Metric<Duration> time_between_requests{Duration(0)};
+    /// Время обслуживания по всем приборам, включая удаленные.
+    Metric<Duration> service_time{Duration(0)};
+    HdrHistogram::Snapshot wait_time_histogram;
+    HdrHistogram::Snapshot service_time_histogram;
+    HdrHistogram::Snapshot total_time_histogram;
+    Metric<size_t, double> queue_size{0};
+    Metric<size_t, double> busy_server_count{0};
+    Metric<size_t, double> in_system_count{0};
+    /// Обслуженная нагрузка в Эрлангах с начала записи.
+    double service_load_erlang = 0;
+    EwmaGauge::Snapshot queue_size_ewma{};
+    EwmaGauge::Snapshot busy_server_count_ewma{};
+    EwmaGauge::Snapshot service_load_erlang_ewma{};
+    ScalingSnapshot scaling;
+  };
+
   static std::shared_ptr<QueueingSystemMetrics> Create(
       std::shared_ptr<tasks::TaskManager> task_manager,
       std::shared_ptr<config::Configuration> configuration,
@@ -60,11 +143,19 @@ class QueueingSystemMetrics : public std::enable_shared_from_this<QueueingSystem
   void Stop();
 
   /**
-   * @brief Добавить обслуживающие приборы для отслеживания их статуса.
-   * @tparam ServerImplSet множество приборов
+   * @brief Добавить обслуживающий прибор и назначить ему @link Server::GetIndex номер@endlink.
+   *
+   * Прибор получает наименьший свободный номер, поэтому память под метрики приборов ограничена
+   * наибольшим количеством одновременно работающих приборов.
+   */
+  void AddServer(const std::shared_ptr<Server> &server);
+  /**
+   * @brief Удалить обслуживающий прибор.
+   *
+   * Метрики прибора добавляются к общим метрикам удаленных приборов, а его номер освобождается.
+   * Прибор не должен обслуживать запрос.
    */
-  template <typename ServerImplSet>
-  void SetServers(const ServerImplSet &server_impls);
+  void RemoveServer(const ServerPtr &server);
   /**
    * @brief Зафиксировать получение нового запроса.
    */
@@ -81,17 +172,65 @@ class QueueingSystemMetrics : public std::enable_shared_from_this<QueueingSystem
    * @brief Зафиксировать отклоненный запрос.
    */
   void RecordRequestDropout(const RequestPtr &request);
+  /**
+   * @brief Зафиксировать решение об изменении количества обслуживающих приборов.
+   * @param previous_count количество приборов до решения
+   * @param desired_count количество приборов, рассчитанное по измерениям
+   * @param target_count установленное количество приборов
+   */
+  void RecordScalingDecision(size_t previous_count, size_t desired_count, size_t target_count);
+
+  /**
+   * @brief Получить снимок всех метрик системы.
+   *
+   * Метрики читаются без обращения к ячейкам приборов и только с одной разделяемой блокировкой
+   * периодических метрик.
+   */
+  [[nodiscard]] Snapshot GetSnapshot() const;
 
   /**
    * @brief Получить метрики по времени ожидания в очереди.
    */
   [[nodiscard]] Metric<Duration> GetWaitTimeMetric() const;
+  /**
+   * @brief Получить распределение времени ожидания в очереди обслуженных запросов.
+   */
+  [[nodiscard]] HdrHistogram::Snapshot GetWaitTimeHistogram() const;
+  /**
+   * @brief Получить распределение времени обслуживания.
+   */
+  [[nodiscard]] HdrHistogram::Snapshot GetServiceTimeHistogram() const;
+  /**
+   * @brief Получить распределение времени пребывания в системе обслуженных запросов.
+   */
+  [[nodiscard]] HdrHistogram::Snapshot GetTotalTimeHistogram() const;
+  /**
+   * @brief Получить метрики за последний промежуток времени.
+   * @param window длина промежутка, не более @link SlidingWindowMetrics::kMaxWindow @endlink
+   */
+  [[nodiscard]] SlidingWindowMetrics::Snapshot GetWindowMetrics(std::chrono::seconds window) const;
+  /**
+   * @brief Скользящие средние размера очереди.
+   */
+  [[nodiscard]] EwmaGauge::Snapshot GetQueueSizeEwma() const;
+  /**
+   * @brief Скользящие средние количества занятых приборов.
+   */
+  [[nodiscard]] EwmaGauge::Snapshot GetBusyServerCountEwma() const;
+  /**
+   * @brief Скользящие средние обслуженной нагрузки в Эрлангах.
+   */
+  [[nodiscard]] EwmaGauge::Snapshot GetServiceLoadInErlangEwma() const;
   /**
    * @brief Получить метрики по размеру очереди.
+   *
+   * Среднее значение взвешено по времени, минимум и максимум - по периодическим замерам.
    */
   [[nodiscard]] Metric<size_t, double> GetQueueSizeMetric() const;
   /**
-   * @brief Получить метрики по количеству обслуживающих приборов.
+   * @brief Получить метрики по количеству занятых обслуживающих приборов.
+   *
+   * Среднее значение взвешено по времени, минимум и максимум - по периодическим замерам.
    */
   [[nodiscard]] Metric<size_t, double> GetBusyServerCountMetric() const;
   /**
@@ -111,15 +250,17 @@ class QueueingSystemMetrics : public std::enable_shared_from_this<QueueingSystem
    */
   [[nodiscard]] Metric<Duration> GetRefusedWaitTimeMetric() const;
   /**
-   * @brief Получить среднее время обслуживания среди всех приборов.
+   * @brief Получить среднее время обслуживания по всем обслуженным запросам.
    */
   [[nodiscard]] Duration GetAverageServiceTime() const;
   /**
    * @brief Получить метрики по количеству запросов, одновременно находящихся в системе.
+   *
+   * Среднее значение взвешено по времени, минимум и максимум - по периодическим замерам.
    */
   [[nodiscard]] Metric<size_t, double> GetRequestCountInSystemMetric() const;
   /**
-   * @brief Получить вероятность потери запроса.
+   * @brief Получить вероятность потери запроса (долю отклоненных запросов среди принятых).
    */
   [[nodiscard]] double GetProbabilityOfLoss() const;
   /**
@@ -130,14 +271,65 @@ class QueueingSystemMetrics : public std::enable_shared_from_this<QueueingSystem
    * @brief Получить количество принятых запросов.
    */
   [[nodiscard]] size_t GetArrivalCount() const;
+  /**
+   * @brief Получить метрики работающих и удаленных обслуживающих приборов.
+   */
+  [[nodiscard]] ServersSnapshot GetServersMetrics() const;
+  /**
+   * @brief Получить количество работающих обслуживающих приборов.
+   */
+  [[nodiscard]] size_t GetServerCount() const;
+  /**
+   * @brief Получить метрики решений об изменении количества обслуживающих приборов.
+   */
+  [[nodiscard]] ScalingSnapshot GetScalingMetrics() const;
 
  private:
-  struct ServerEquals {
-    bool operator()(const ServerPtr &first, const ServerPtr &second) const;
+  /**
+   * @brief Ячейка метрик обслуживающего прибора, адресуемая его номером.
+   */
+  struct ServerSlot {
+    ServiceMetrics metrics;
+    /// Прибор, занимающий ячейку, nullptr - если ячейка свободна.
+    ServerPtr server;
+    /// Время добавления прибора.
+    TimePoint added_time{};
   };
 
-  struct ServerHash {
-    size_t operator()(const ServerPtr &server) const;
+  /// Количество ячеек метрик приборов в блоке.
+  static constexpr size_t kServerSlotChunkSize = 64;
+  /// Блок ячеек, ячейки не перемещаются при добавлении новых блоков.
+  using ServerSlotChunk = std::array<ServerSlot, kServerSlotChunkSize>;
+
+  /**
+   * @brief Сегмент метрик, в который записывают события закрепленные за ним потоки.
+   *
+   * Выровнен по размеру кэш-линии, чтобы запись из разных потоков не приводила к ложному
+   * разделению.
+   */
+  struct alignas(64) Shard {
+    AtomicMetric<Duration> time_between_requests{Duration(0)};
+    AtomicMetric<Duration> wait_time{Duration(0)};
+    AtomicMetric<Duration> refused_wait_time{Duration(0)};
+    AtomicMetric<Duration> service_time{Duration(0)};
+    HdrHistogram wait_time_histogram;
+    HdrHistogram service_time_histogram;
+    HdrHistogram total_time_histogram;
+    std::atomic<size_t> arrival_count = 0;
+    std::atomic<size_t> dropout_count = 0;
+    /// Изменения показателей, внесенные потоками сегмента (значения могут быть отрицательными).
+    TimeWeightedGauge queue_size;
+    TimeWeightedGauge in_system_count;
+    TimeWeightedGauge busy_server_count;
+  };
+
+  /**
+   * @brief Снимок показателей, изменяемых событиями, объединенный по всем сегментам.
+   */
+  struct GaugesSnapshot {
+    TimeWeightedGauge::Snapshot queue_size;
+    TimeWeightedGauge::Snapshot in_system_count;
+    TimeWeightedGauge::Snapshot busy_server_count;
   };
 
   static constexpr uint64_t kDefaultMetricsUpdateTime = 10;
@@ -151,23 +343,39 @@ class QueueingSystemMetrics : public std::enable_shared_from_this<QueueingSystem
   uint64_t metrics_update_time_ = kDefaultMetricsUpdateTime;
   std::atomic<TimePoint> recording_start_time_ = TimePoint(Duration(0));
 
-  Metric<Duration> time_between_requests_{Duration(0)};
-  std::optional<TimePoint> prev_arrival_;
-  size_t arrival_count_ = 0;
-  Metric<Duration> wait_time_{Duration(0)};
+  std::vector<Shard> shards_;
+  /// Время получения последнего запроса, TimePoint::min() - если запросов еще не было.
+  std::atomic<TimePoint> prev_arrival_ = TimePoint::min();
+
   Metric<size_t, double> queue_size_{0};
   Metric<size_t, double> in_system_count_{0};
-  size_t current_queue_size_ = 0;
-  size_t current_in_system_count_ = 0;
-  mutable std::shared_mutex queue_mutex_;
+  Metric<size_t, double> busy_server_count_{0};
+  /// Показатели на момент начала записи метрик.
+  GaugesSnapshot start_gauges_;
+  mutable instrumentation::SharedMutex periodic_mutex_{"QueueingSystemMetrics.periodic"};
 
-  std::size_t dropout_count_ = 0;
-  Metric<Duration> refused_wait_time_{Duration(0)};
-  mutable std::shared_mutex dropout_mutex_;
+  SlidingWindowMetrics window_metrics_;
+  EwmaGauge queue_size_ewma_;
+  EwmaGauge busy_server_count_ewma_;
+  EwmaGauge service_load_ewma_;
+  /// Показатели при предыдущем периодическом обновлении, используются только в нем.
+  std::optional<GaugesSnapshot> prev_periodic_gauges_;
 
-  std::unordered_map<ServerPtr, ServiceMetrics, ServerHash, ServerEquals> servers_metrics_;
-  Metric<size_t, double> busy_server_count_{0};
-  mutable std::shared_mutex service_mutex_;
+  std::vector<std::unique_ptr<ServerSlotChunk>> server_slot_chunks_;
+  /// Количество когда-либо занятых ячеек, номера работающих приборов меньше него.
+  size_t server_slot_count_ = 0;
+  /// Освобожденные номера, переиспользуются начиная с наименьшего.
+  std::priority_queue<size_t, std::vector<size_t>, std::greater<>> free_server_indexes_;
+  size_t retired_server_count_ = 0;
+  Metric<Duration> retired_service_time_{Duration(0)};
+  /// Защищает ячейки приборов, запись в их метрики выполняется под разделяемой блокировкой.
+  mutable instrumentation::SharedMutex service_mutex_{"QueueingSystemMetrics.service"};
+
+  std::atomic<uint64_t> scaling_decision_count_ = 0;
+  std::atomic<uint64_t> scale_up_count_ = 0;
+  std::atomic<uint64_t> scale_down_count_ = 0;
+  std::atomic<size_t> desired_server_count_ = 0;
+  std::atomic<size_t> target_server_count_ = 0;
 
   QueueingSystemMetrics(
       std::shared_ptr<tasks::TaskManager> task_manager,
@@ -184,40 +392,115 @@ class QueueingSystemMetrics : public std::enable_shared_from_this<QueueingSystem
    * @brief Запланировать очередное периодическое обновление метрик.
    */
   void ScheduleUpdatePeriodicMetrics();
-  /**
-   * @brief Получить текущее количество занятых приборов.
-   */
-  [[nodiscard]] size_t GetCurrentBusyServerCount() const;
   /**
    * @brief Обновить среднее время между запросами, используя время получения нового запрсоа.
    */
   void UpdateAvgTimeBetweenRequests(TimePoint last_arrival_time_);
   /**
-   * @brief Получить метрики для заданного прибора.
+   * @brief Ячейка метрик прибора с заданным номером.
+   */
+  ServerSlot &GetServerSlot(size_t index);
+  const ServerSlot &GetServerSlot(size_t index) const;
+  /**
+   * @brief Выполнить функцию для ячеек всех работающих приборов в порядке возрастания номеров.
+   *
+   * Вызывается под блокировкой @link service_mutex_ @endlink.
+   */
+  template <typename Function>
+  void ForEachServerSlot(Function &&function) const;
+  /**
+   * @brief Сегмент, закрепленный за текущим потоком.
+   */
+  Shard &GetShard();
+  /**
+   * @brief Объединить метрики всех сегментов.
+   * @param metric указатель на метрику в сегменте
+   */
+  template <typename T, typename AvgT>
+  Metric<T, AvgT> MergeShards(AtomicMetric<T, AvgT> Shard::*metric) const;
+  /**
+   * @brief Объединить гистограммы всех сегментов.
+   * @param histogram указатель на гистограмму в сегменте
+   */
+  HdrHistogram::Snapshot MergeShards(HdrHistogram Shard::*histogram) const;
+  /**
+   * @brief Сумма значения по всем сегментам.
+   * @param value указатель на значение в сегменте
+   */
+  template <typename T>
+  T SumShards(std::atomic<T> Shard::*value) const;
+  /**
+   * @brief Снимок показателей, изменяемых событиями, в заданный момент времени.
+   */
+  [[nodiscard]] GaugesSnapshot GetGaugesSnapshot(TimePoint now) const;
+  /**
+   * @brief Метрика показателя со средним, взвешенным по времени с начала записи.
+   *
+   * Вызывается под блокировкой @link periodic_mutex_ @endlink.
+   * @param samples периодические замеры показателя
+   * @param gauges текущий снимок показателей
+   * @param gauge указатель на показатель в снимке
+   */
+  [[nodiscard]] Metric<size_t, double> WithTimeWeightedAverage(
+      const Metric<size_t, double> &samples,
+      const GaugesSnapshot &gauges,
+      TimeWeightedGauge::Snapshot GaugesSnapshot::*gauge
+  ) const;
+  /**
+   * @brief Суммарное время обслуживания всех запросов.
+   */
+  [[nodiscard]] Duration GetTotalServiceTime() const;
+  /**
+   * @brief Обслуженная нагрузка в Эрлангах с начала записи до заданного момента.
+   */
+  [[nodiscard]] double CalculateServiceLoadInErlang(Duration total_service_time, TimePoint now)
+      const;
+  /**
+   * @brief Доля отклоненных запросов среди принятых.
    */
-  ServiceMetrics &GetServerMetrics(const ServerPtr &server);
+  static double CalculateProbabilityOfLoss(size_t arrival_count, size_t dropout_count);
+  /**
+   * @brief Текущее время в единицах метрик.
+   */
+  [[nodiscard]] TimePoint Now() const;
+  /**
+   * @brief Обновить скользящие средние, учитывая время, прошедшее с предыдущего обновления.
+   */
+  void UpdateEwmaGauges(const GaugesSnapshot &gauges);
   /**
    * @brief Обновить интервал обновления метрик.
    */
   void UpdateMetricsUpdateTime();
 };
 
-template <typename ServerImplSet>
-void QueueingSystemMetrics::SetServers(const ServerImplSet &server_impls) {
-  const std::unordered_set<ServerPtr, ServerHash, ServerEquals> servers(
-      server_impls.begin(), server_impls.end()
-  );
-  std::lock_guard lock(service_mutex_);
-  erase_if(servers_metrics_, [&servers](const auto &p) {
-    return !servers.contains(p.first);
-  });
-  for (const auto &server : servers) {
-    if (!servers_metrics_.contains(server)) {
-      servers_metrics_.emplace(server, ServiceMetrics{});
+template <typename Function>
+void QueueingSystemMetrics::ForEachServerSlot(Function &&function) const {
+  for (size_t index = 0; index < server_slot_count_; ++index) {
+    const auto &slot = GetServerSlot(index);
+    if (slot.server) {
+      function(slot);
     }
   }
 }
 
+template <typename T, typename AvgT>
+Metric<T, AvgT> QueueingSystemMetrics::MergeShards(AtomicMetric<T, AvgT> Shard::*metric) const {
+  auto result = (shards_.front().*metric).Load();
+  for (auto shard = std::next(shards_.begin()); shard != shards_.end(); ++shard) {
+    result.Merge(((*shard).*metric).Load());
+  }
+  return result;
+}
+
+template <typename T>
+T QueueingSystemMetrics::SumShards(std::atomic<T> Shard::*value) const {
+  T sum{};
+  for (const auto &shard : shards_) {
+    sum += (shard.*value).load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
 }  // namespace call_center::core::qs::metrics
 
 #endif  // CALL_CENTER_SRC_CALL_CENTER_QUEUEING_SYSTEM_METRICS_H_
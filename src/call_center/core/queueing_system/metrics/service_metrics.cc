@@ -6,12 +6,16 @@ size_t ServiceMetrics::GetServicedCount() const {
   return service_time_.GetCount();
 }
 
-const Metric<ServiceMetrics::Duration> &ServiceMetrics::GetServiceTimeMetric() const {
-  return service_time_;
+Metric<ServiceMetrics::Duration> ServiceMetrics::GetServiceTimeMetric() const {
+  return service_time_.Load();
 }
 
 ServiceMetrics::Duration ServiceMetrics::GetTotalServiceTime() const {
-  return total_service_time_;
+  return service_time_.GetSum();
+}
+
+void ServiceMetrics::Reset() {
+  service_time_.Reset();
 }
 
 }  // namespace call_center::core::qs::metrics
@@ -1,5 +1,6 @@
 #ifndef SERVICE_METRICS_H
 #define SERVICE_METRICS_H
+#include "atomic_metric.h"
 #include "metric.h"
 #include "request_metrics.h"
 
@@ -8,7 +9,8 @@ namespace call_center::core::qs::metrics {
 /**
  * @brief Метрики обслуживания прибором.
  *
- * Содержит количество обслуженных запросов, средее и общее время обслуживания.
+ * Содержит количество обслуженных запросов, средее и общее время обслуживания. Запись
+ * потокобезопасна и выполняется без блокировок.
  */
 class ServiceMetrics {
  public:
@@ -16,6 +18,10 @@ class ServiceMetrics {
   using Duration = std::chrono::milliseconds;
   using TimePoint = std::chrono::time_point<Clock, Duration>;
 
+  ServiceMetrics() = default;
+  ServiceMetrics(const ServiceMetrics &other) = delete;
+  ServiceMetrics &operator=(const ServiceMetrics &other) = delete;
+
   /**
    * @brief Добавить обслуженный запрос.
    * @param cur_service_time время обслуживания запроса
@@ -29,21 +35,23 @@ class ServiceMetrics {
   /**
    * @brief Метрика времени обслуживания.
    */
-  [[nodiscard]] const Metric<Duration> &GetServiceTimeMetric() const;
+  [[nodiscard]] Metric<Duration> GetServiceTimeMetric() const;
   /**
    * @brief Общее время обслужиания.
    */
   [[nodiscard]] Duration GetTotalServiceTime() const;
+  /**
+   * @brief Сбросить метрики, например, перед переиспользованием для другого прибора.
+   */
+  void Reset();
 
  private:
-  Metric<Duration> service_time_{Duration(0)};
-  Duration total_service_time_{Duration(0)};
+  AtomicMetric<Duration> service_time_{Duration(0)};
 };
 
 template <typename Duration_t>
 void ServiceMetrics::AddCompletedService(Duration_t cur_service_time) {
-  service_time_.AddValue(cur_service_time);
-  total_service_time_ += cur_service_time;
+  service_time_.AddValue(std::chrono::duration_cast<Duration>(cur_service_time));
 }
 
 }  // namespace call_center::core::qs::metrics
@@ -0,0 +1,124 @@
+#include "sliding_window_metrics.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace call_center::core::qs::metrics {
+
+using namespace std::chrono;
+
+void SlidingWindowMetrics::RecordArrival(const TimePoint now) {
+  if (auto *bucket = AcquireBucket(now)) {
+    bucket->arrival_count.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void SlidingWindowMetrics::RecordServiceStart(const TimePoint now, const Duration wait_time) {
+  auto *bucket = AcquireBucket(now);
+  if (!bucket) {
+    return;
+  }
+  bucket->service_start_count.fetch_add(1, std::memory_order_relaxed);
+  bucket->wait_time_sum.fetch_add(wait_time.count(), std::memory_order_relaxed);
+  auto max = bucket->max_wait_time.load(std::memory_order_relaxed);
+  while (wait_time.count() > max &&
+         !bucket->max_wait_time.compare_exchange_weak(
+             max, wait_time.count(), std::memory_order_relaxed
+         )) {
+  }
+}
+
+void SlidingWindowMetrics::RecordServiceComplete(const TimePoint now, const Duration service_time) {
+  if (auto *bucket = AcquireBucket(now)) {
+    bucket->serviced_count.fetch_add(1, std::memory_order_relaxed);
+    bucket->service_time_sum.fetch_add(service_time.count(), std::memory_order_relaxed);
+  }
+}
+
+void SlidingWindowMetrics::RecordDropout(const TimePoint now) {
+  if (auto *bucket = AcquireBucket(now)) {
+    bucket->dropout_count.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+SlidingWindowMetrics::Snapshot SlidingWindowMetrics::GetSnapshot(
+    const TimePoint now, seconds window
+) const {
+  window = std::clamp(window, kBucketDuration, kMaxWindow);
+  Snapshot snapshot;
+  snapshot.window = window;
+  const auto last_epoch = ToEpoch(now);
+  const auto first_epoch = last_epoch - window / kBucketDuration + 1;
+  for (auto epoch = std::max<int64_t>(first_epoch, 0); epoch <= last_epoch; ++epoch) {
+    const auto &bucket = buckets_[static_cast<size_t>(epoch) % kBucketCount];
+    if (bucket.epoch.load(std::memory_order_acquire) != epoch) {
+      continue;
+    }
+    snapshot.arrival_count += bucket.arrival_count.load(std::memory_order_relaxed);
+    snapshot.serviced_count += bucket.serviced_count.load(std::memory_order_relaxed);
+    snapshot.dropout_count += bucket.dropout_count.load(std::memory_order_relaxed);
+    snapshot.service_start_count += bucket.service_start_count.load(std::memory_order_relaxed);
+    snapshot.wait_time_sum += Duration(bucket.wait_time_sum.load(std::memory_order_relaxed));
+    snapshot.max_wait_time = std::max(
+        snapshot.max_wait_time, Duration(bucket.max_wait_time.load(std::memory_order_relaxed))
+    );
+    snapshot.service_time_sum += Duration(bucket.service_time_sum.load(std::memory_order_relaxed));
+  }
+  return snapshot;
+}
+
+SlidingWindowMetrics::Bucket *SlidingWindowMetrics::AcquireBucket(const TimePoint now) {
+  const auto epoch = ToEpoch(now);
+  if (epoch < 0) {
+    return nullptr;
+  }
+  auto &bucket = buckets_[static_cast<size_t>(epoch) % kBucketCount];
+  auto current = bucket.epoch.load(std::memory_order_acquire);
+  while (current != epoch) {
+    if (current > epoch) {
+      return nullptr;
+    }
+    if (current == kResettingEpoch) {
+      std::this_thread::yield();
+      current = bucket.epoch.load(std::memory_order_acquire);
+      continue;
+    }
+    if (bucket.epoch.compare_exchange_weak(current, kResettingEpoch, std::memory_order_acq_rel)) {
+      bucket.Clear();
+      bucket.epoch.store(epoch, std::memory_order_release);
+      break;
+    }
+  }
+  return &bucket;
+}
+
+int64_t SlidingWindowMetrics::ToEpoch(const TimePoint time_point) {
+  return floor<seconds>(time_point.time_since_epoch()) / kBucketDuration;
+}
+
+void SlidingWindowMetrics::Bucket::Clear() {
+  arrival_count.store(0, std::memory_order_relaxed);
+  serviced_count.store(0, std::memory_order_relaxed);
+  dropout_count.store(0, std::memory_order_relaxed);
+  service_start_count.store(0, std::memory_order_relaxed);
+  wait_time_sum.store(0, std::memory_order_relaxed);
+  max_wait_time.store(0, std::memory_order_relaxed);
+  service_time_sum.store(0, std::memory_order_relaxed);
+}
+
+SlidingWindowMetrics::Duration SlidingWindowMetrics::Snapshot::GetAvgWaitTime() const {
+  if (service_start_count == 0) {
+    return Duration::zero();
+  }
+  return wait_time_sum / service_start_count;
+}
+
+double SlidingWindowMetrics::Snapshot::GetArrivalRate() const {
+  return static_cast<double>(arrival_count) / duration<double>(window).count();
+}
+
+double SlidingWindowMetrics::Snapshot::GetServiceLoadInErlang() const {
+  return duration<double>(service_time_sum) / duration<double>(window);
+}
+
+}  // namespace call_center::core::qs::metrics
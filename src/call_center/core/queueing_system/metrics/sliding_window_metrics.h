@@ -0,0 +1,109 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_SLIDING_WINDOW_METRICS_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_SLIDING_WINDOW_METRICS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "core/queueing_system/request.h"
+
+namespace call_center::core::qs::metrics {
+
+/**
+ * @brief Метрики за скользящее окно времени.
+ *
+ * События складываются в кольцевой буфер секундных корзин. Корзина переиспользуется, когда время
+ * сдвигается на длину буфера: первый записывающий поток сбрасывает её, заменив эпоху через CAS.
+ * Метрики за окно вычисляются за время, пропорциональное количеству корзин в окне.
+ *
+ * Время обслуживания относится к секунде его завершения, поэтому нагрузка за короткое окно может
+ * немного отличаться от фактической.
+ */
+class SlidingWindowMetrics {
+ public:
+  using Duration = Request::Duration;
+  using TimePoint = Request::TimePoint;
+
+  /// Длительность одной корзины.
+  static constexpr std::chrono::seconds kBucketDuration{1};
+  /// Количество корзин в кольцевом буфере.
+  static constexpr size_t kBucketCount = 15 * 60;
+  /// Максимальная длина окна.
+  static constexpr std::chrono::seconds kMaxWindow = kBucketDuration * kBucketCount;
+
+  /**
+   * @brief Метрики за окно.
+   */
+  struct Snapshot {
+    std::chrono::seconds window{0};
+    uint64_t arrival_count = 0;
+    uint64_t serviced_count = 0;
+    uint64_t dropout_count = 0;
+    /// Количество запросов, обслуживание которых началось в окне.
+    uint64_t service_start_count = 0;
+    Duration wait_time_sum{0};
+    Duration max_wait_time{0};
+    Duration service_time_sum{0};
+
+    /**
+     * @brief Среднее время ожидания запросов, обслуживание которых началось в окне.
+     */
+    [[nodiscard]] Duration GetAvgWaitTime() const;
+    /**
+     * @brief Интенсивность поступления запросов (в секунду).
+     */
+    [[nodiscard]] double GetArrivalRate() const;
+    /**
+     * @brief Обслуженная нагрузка в Эрлангах за окно.
+     */
+    [[nodiscard]] double GetServiceLoadInErlang() const;
+  };
+
+  SlidingWindowMetrics() = default;
+  SlidingWindowMetrics(const SlidingWindowMetrics &other) = delete;
+  SlidingWindowMetrics &operator=(const SlidingWindowMetrics &other) = delete;
+
+  void RecordArrival(TimePoint now);
+  void RecordServiceStart(TimePoint now, Duration wait_time);
+  void RecordServiceComplete(TimePoint now, Duration service_time);
+  void RecordDropout(TimePoint now);
+
+  /**
+   * @brief Получить метрики за окно, заканчивающееся в момент now.
+   * @param window длина окна, ограничивается @link kMaxWindow @endlink
+   */
+  [[nodiscard]] Snapshot GetSnapshot(TimePoint now, std::chrono::seconds window) const;
+
+ private:
+  struct alignas(64) Bucket {
+    std::atomic_int64_t epoch = kEmptyEpoch;
+    std::atomic_uint64_t arrival_count = 0;
+    std::atomic_uint64_t serviced_count = 0;
+    std::atomic_uint64_t dropout_count = 0;
+    std::atomic_uint64_t service_start_count = 0;
+    std::atomic_int64_t wait_time_sum = 0;
+    std::atomic_int64_t max_wait_time = 0;
+    std::atomic_int64_t service_time_sum = 0;
+
+    void Clear();
+  };
+
+  /// Эпоха корзины, в которую еще ничего не записывалось.
+  static constexpr int64_t kEmptyEpoch = -1;
+  /// Эпоха корзины, которую в данный момент сбрасывает другой поток.
+  static constexpr int64_t kResettingEpoch = -2;
+
+  std::array<Bucket, kBucketCount> buckets_{};
+
+  /**
+   * @brief Получить корзину для момента времени, сбросив её при смене эпохи.
+   * @return nullptr - если корзина уже занята более поздним временем
+   */
+  Bucket *AcquireBucket(TimePoint now);
+  static int64_t ToEpoch(TimePoint time_point);
+};
+
+}  // namespace call_center::core::qs::metrics
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_SLIDING_WINDOW_METRICS_H_
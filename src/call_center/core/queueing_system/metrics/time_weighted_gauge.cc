@@ -0,0 +1,36 @@
+#include "time_weighted_gauge.h"
+
+namespace call_center::core::qs::metrics {
+
+void TimeWeightedGauge::Add(const TimePoint time, const int64_t delta) {
+  value_.fetch_add(delta, std::memory_order_relaxed);
+  weighted_sum_.fetch_add(delta * time.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+int64_t TimeWeightedGauge::GetValue() const {
+  return value_.load(std::memory_order_relaxed);
+}
+
+TimeWeightedGauge::Snapshot TimeWeightedGauge::GetSnapshot(const TimePoint time) const {
+  Snapshot snapshot;
+  snapshot.time = time;
+  snapshot.value = GetValue();
+  snapshot.integral = snapshot.value * time.time_since_epoch().count() -
+                      weighted_sum_.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+void TimeWeightedGauge::Snapshot::Merge(const Snapshot &other) {
+  value += other.value;
+  integral += other.integral;
+}
+
+double TimeWeightedGauge::Snapshot::GetAverageSince(const Snapshot &previous) const {
+  const auto elapsed = (time - previous.time).count();
+  if (elapsed <= 0) {
+    return static_cast<double>(value);
+  }
+  return static_cast<double>(integral - previous.integral) / static_cast<double>(elapsed);
+}
+
+}  // namespace call_center::core::qs::metrics
@@ -0,0 +1,71 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_TIME_WEIGHTED_GAUGE_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_TIME_WEIGHTED_GAUGE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "core/queueing_system/request.h"
+
+namespace call_center::core::qs::metrics {
+
+/**
+ * @brief Показатель, который изменяется событиями, с интегралом его значения по времени.
+ *
+ * Интеграл до момента T равен сумме delta * (T - t) по всем изменениям delta в моменты t, т.е.
+ * T * value - sum(delta * t). Поэтому при изменении достаточно атомарно добавить delta к значению и
+ * delta * t к взвешенной сумме: запись выполняется за O(1) без блокировок, а интегралы нескольких
+ * показателей (например, сегментов) можно складывать.
+ */
+class TimeWeightedGauge {
+ public:
+  using Duration = Request::Duration;
+  using TimePoint = Request::TimePoint;
+
+  /**
+   * @brief Значение и интеграл показателя в момент времени.
+   */
+  struct Snapshot {
+    TimePoint time{};
+    int64_t value = 0;
+    /// Интеграл значения по времени, в единицах значения, умноженных на Duration.
+    int64_t integral = 0;
+
+    /**
+     * @brief Добавить значение и интеграл другого показателя, снятые в тот же момент.
+     */
+    void Merge(const Snapshot &other);
+    /**
+     * @brief Среднее по времени значение показателя между двумя снимками.
+     * @return значение показателя - если снимки сделаны в один момент
+     */
+    [[nodiscard]] double GetAverageSince(const Snapshot &previous) const;
+  };
+
+  TimeWeightedGauge() = default;
+  TimeWeightedGauge(const TimeWeightedGauge &other) = delete;
+  TimeWeightedGauge &operator=(const TimeWeightedGauge &other) = delete;
+
+  /**
+   * @brief Изменить значение показателя.
+   * @param time момент изменения
+   * @param delta изменение значения
+   */
+  void Add(TimePoint time, int64_t delta);
+  /**
+   * @brief Текущее значение показателя.
+   */
+  [[nodiscard]] int64_t GetValue() const;
+  /**
+   * @brief Снимок показателя в момент времени, не раньше последнего изменения.
+   */
+  [[nodiscard]] Snapshot GetSnapshot(TimePoint time) const;
+
+ private:
+  std::atomic_int64_t value_ = 0;
+  std::atomic_int64_t weighted_sum_ = 0;
+};
+
+}  // namespace call_center::core::qs::metrics
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_QUEUEING_SYSTEM_METRICS_TIME_WEIGHTED_GAUGE_H_
@@ -19,4 +19,12 @@ Server::Id Server::GetId() const {
   return id_;
 }
 
+size_t Server::GetIndex() const {
+  return index_;
+}
+
+void Server::SetIndex(const size_t index) {
+  index_ = index;
+}
+
 }  // namespace call_center::core::qs
@@ -3,6 +3,7 @@
 
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <limits>
 
 namespace call_center::core::qs {
 
@@ -15,6 +16,9 @@ class Server {
  public:
   using Id = boost::uuids::uuid;
 
+  /// Номер прибора, если он не назначен.
+  static constexpr size_t kNoIndex = std::numeric_limits<size_t>::max();
+
   explicit Server(Id id = boost::uuids::random_generator_mt19937()());
   virtual ~Server() = default;
 
@@ -33,9 +37,21 @@ class Server {
    * @brief Уникальный идентификатор прибора.
    */
   [[nodiscard]] Id GetId() const;
+  /**
+   * @brief Плотный номер прибора среди работающих приборов.
+   *
+   * Назначается метриками при добавлении прибора и используется ими для адресации его метрик.
+   * Номера удаленных приборов переиспользуются.
+   */
+  [[nodiscard]] size_t GetIndex() const;
+  /**
+   * @brief Задать номер прибора.
+   */
+  void SetIndex(size_t index);
 
  protected:
   const Id id_;
+  size_t index_ = kNoIndex;
 };
 
 }  // namespace call_center::core::qs
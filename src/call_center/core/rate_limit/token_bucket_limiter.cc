@@ -0,0 +1,77 @@
+#include "token_bucket_limiter.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+#include "core/utils/hash.h"
+
+namespace call_center::core::rate_limit {
+
+size_t TokenBucketLimiter::KeyHash::operator()(const uint64_t key) const {
+  return utils::hash::Mix64(key);
+}
+
+TokenBucketLimiter::TokenBucketLimiter(const size_t shard_count)
+    : shards_(std::bit_ceil(std::max<size_t>(shard_count, 1))) {
+}
+
+bool TokenBucketLimiter::TryAcquire(
+    const uint64_t key, const Settings &settings, const Clock::time_point now
+) {
+  return TryAcquire(key, 1, settings, now) == 1;
+}
+
+size_t TokenBucketLimiter::TryAcquire(
+    const uint64_t key, const size_t count, const Settings &settings, const Clock::time_point now
+) {
+  auto &shard = GetShard(key);
+  std::lock_guard lock(shard.mutex);
+  EvictIdleBuckets(shard, settings.idle_timeout, now);
+
+  auto found = shard.index.find(key);
+  if (found == shard.index.end()) {
+    shard.buckets.push_back({.key = key, .tokens = settings.burst, .last_update = now});
+    found = shard.index.emplace(key, std::prev(shard.buckets.end())).first;
+  } else {
+    shard.buckets.splice(shard.buckets.end(), shard.buckets, found->second);
+  }
+
+  auto &bucket = *found->second;
+  const auto elapsed = std::chrono::duration<double>(now - bucket.last_update).count();
+  if (elapsed > 0) {
+    bucket.tokens = std::min(settings.burst, bucket.tokens + elapsed * settings.rate);
+    bucket.last_update = now;
+  }
+  const auto acquired = std::min(count, static_cast<size_t>(bucket.tokens));
+  bucket.tokens -= static_cast<double>(acquired);
+  return acquired;
+}
+
+size_t TokenBucketLimiter::GetSize() const {
+  size_t size = 0;
+  for (const auto &shard : shards_) {
+    std::lock_guard lock(shard.mutex);
+    size += shard.index.size();
+  }
+  return size;
+}
+
+TokenBucketLimiter::Shard &TokenBucketLimiter::GetShard(const uint64_t key) {
+  return shards_[KeyHash()(key) & (shards_.size() - 1)];
+}
+
+void TokenBucketLimiter::EvictIdleBuckets(
+    Shard &shard, const Duration idle_timeout, const Clock::time_point now
+) {
+  for (size_t i = 0; i < kMaxEvictionsPerAcquire && !shard.buckets.empty(); ++i) {
+    const auto &oldest = shard.buckets.front();
+    if (now - oldest.last_update < idle_timeout) {
+      return;
+    }
+    shard.index.erase(oldest.key);
+    shard.buckets.pop_front();
+  }
+}
+
+}  // namespace call_center::core::rate_limit
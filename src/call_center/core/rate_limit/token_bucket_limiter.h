@@ -0,0 +1,120 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_RATE_LIMIT_TOKEN_BUCKET_LIMITER_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_RATE_LIMIT_TOKEN_BUCKET_LIMITER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "core/instrumentation/instrumented_mutex.h"
+#include "core/memory/pool_allocator.h"
+
+/// Ограничение интенсивности запросов.
+namespace call_center::core::rate_limit {
+
+/**
+ * @brief Набор корзин маркеров (token bucket), по одной на ключ.
+ *
+ * Корзина пополняется лениво: при обращении количество маркеров увеличивается пропорционально
+ * времени с предыдущего обращения, поэтому фоновых задач нет. Корзины распределены по сегментам
+ * со своими блокировками, так что запросы с разными ключами почти не конкурируют.
+ *
+ * В каждом сегменте корзины упорядочены по времени последнего обращения. При обращении из начала
+ * списка удаляется несколько корзин, к которым не обращались дольше @link Settings::idle_timeout
+ * @endlink, поэтому память под неактивные ключи освобождается без полного обхода, а обращение
+ * стоит O(1) при любом количестве ключей. Корзина, к которой не обращались дольше времени ее
+ * полного пополнения, заполнена, поэтому ее удаление не меняет результатов.
+ */
+class TokenBucketLimiter {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using Duration = Clock::duration;
+
+  /**
+   * @brief Параметры корзин.
+   */
+  struct Settings {
+    /// Скорость пополнения корзины, маркеров в секунду.
+    double rate = 1;
+    /// Емкость корзины: наибольшее количество запросов, допускаемых подряд.
+    double burst = 1;
+    /// Время без обращений, после которого корзина удаляется.
+    Duration idle_timeout = std::chrono::minutes(1);
+  };
+
+  /// Количество сегментов по умолчанию.
+  static constexpr size_t kDefaultShardCount = 64;
+  /// Наибольшее количество неактивных корзин, удаляемых при одном обращении.
+  static constexpr size_t kMaxEvictionsPerAcquire = 4;
+
+  /**
+   * @param shard_count количество сегментов (округляется вверх до степени двойки)
+   */
+  explicit TokenBucketLimiter(size_t shard_count = kDefaultShardCount);
+  TokenBucketLimiter(const TokenBucketLimiter &other) = delete;
+  TokenBucketLimiter &operator=(const TokenBucketLimiter &other) = delete;
+
+  /**
+   * @brief Взять маркер из корзины ключа.
+   *
+   * Корзина нового ключа создается заполненной.
+   * @param now текущее время, не должно убывать для одного ключа
+   * @return true - если маркер взят и запрос допускается, иначе - false
+   */
+  bool TryAcquire(uint64_t key, const Settings &settings, Clock::time_point now);
+  /**
+   * @brief Взять из корзины ключа до count маркеров за одно обращение.
+   *
+   * Берется столько маркеров, сколько есть в корзине, но не больше count, так что из пакета
+   * запросов допускаются первые запросы, укладывающиеся в корзину.
+   * @param now текущее время, не должно убывать для одного ключа
+   * @return количество взятых маркеров
+   */
+  size_t TryAcquire(uint64_t key, size_t count, const Settings &settings, Clock::time_point now);
+  /**
+   * @brief Количество корзин во всех сегментах.
+   */
+  [[nodiscard]] size_t GetSize() const;
+
+ private:
+  struct Bucket {
+    uint64_t key;
+    double tokens;
+    Clock::time_point last_update;
+  };
+
+  struct KeyHash {
+    size_t operator()(uint64_t key) const;
+  };
+
+  using BucketList = std::list<Bucket, memory::PoolAllocator<Bucket>>;
+  using BucketIndex = std::unordered_map<
+      uint64_t,
+      BucketList::iterator,
+      KeyHash,
+      std::equal_to<>,
+      memory::PoolAllocator<std::pair<const uint64_t, BucketList::iterator>>>;
+
+  /**
+   * @brief Сегмент корзин, выровненный по размеру кэш-линии.
+   */
+  struct alignas(64) Shard {
+    mutable instrumentation::Mutex mutex{"TokenBucketLimiter"};
+    /// Корзины в порядке последнего обращения: в начале - самые давние.
+    BucketList buckets;
+    BucketIndex index;
+  };
+
+  std::vector<Shard> shards_;
+
+  Shard &GetShard(uint64_t key);
+  /**
+   * @brief Удалить из начала списка корзины, к которым не обращались дольше заданного времени.
+   */
+  static void EvictIdleBuckets(Shard &shard, Duration idle_timeout, Clock::time_point now);
+};
+
+}  // namespace call_center::core::rate_limit
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_RATE_LIMIT_TOKEN_BUCKET_LIMITER_H_
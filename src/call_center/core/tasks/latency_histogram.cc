@@ -0,0 +1,53 @@
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace call_center::core::tasks {
+
+using namespace std::chrono;
+using qs::metrics::HdrHistogram;
+
+void LatencyHistogram::Record(Duration value) {
+  value = std::max(value, Duration::zero());
+  const auto micros = static_cast<uint64_t>(duration_cast<microseconds>(value).count());
+  buckets_[HdrHistogram::GetBucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(value.count(), std::memory_order_relaxed);
+
+  auto max = max_.load(std::memory_order_relaxed);
+  while (value.count() > max &&
+         !max_.compare_exchange_weak(max, value.count(), std::memory_order_relaxed)) {
+  }
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const {
+  Snapshot snapshot;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  }
+  snapshot.count = count_.load(std::memory_order_relaxed);
+  snapshot.sum = Duration(sum_.load(std::memory_order_relaxed));
+  snapshot.max = Duration(max_.load(std::memory_order_relaxed));
+  return snapshot;
+}
+
+LatencyHistogram::Duration LatencyHistogram::Snapshot::GetAvg() const {
+  if (count == 0) {
+    return Duration::zero();
+  }
+  return sum / count;
+}
+
+LatencyHistogram::Duration LatencyHistogram::Snapshot::GetPercentile(const double percentile
+) const {
+  const uint64_t total = std::accumulate(buckets.begin(), buckets.end(), uint64_t{0});
+  if (total == 0) {
+    return Duration::zero();
+  }
+  // значения в корзинах округлены вниз до микросекунд
+  const auto upper_bound = HdrHistogram::GetPercentileUpperBound(buckets, total, percentile);
+  return std::min(duration_cast<Duration>(microseconds(upper_bound + 1)), max);
+}
+
+}  // namespace call_center::core::tasks
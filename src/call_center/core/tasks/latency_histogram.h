@@ -0,0 +1,68 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_LATENCY_HISTOGRAM_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_LATENCY_HISTOGRAM_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "core/queueing_system/metrics/hdr_histogram.h"
+
+namespace call_center::core::tasks {
+
+/**
+ * @brief Потокобезопасная гистограмма длительностей.
+ *
+ * Значения хранятся в микросекундах в корзинах @link qs::metrics::HdrHistogram HdrHistogram
+ * @endlink, поэтому относительная погрешность перцентилей не превышает ~3%. Запись значения не
+ * использует блокировок, поэтому гистограмму можно обновлять при выполнении каждой задачи.
+ */
+class LatencyHistogram {
+ public:
+  using Duration = std::chrono::nanoseconds;
+
+  /// Количество корзин гистограммы.
+  static constexpr size_t kBucketCount = qs::metrics::HdrHistogram::kBucketCount;
+
+  /**
+   * @brief Снимок состояния гистограммы.
+   */
+  struct Snapshot {
+    std::array<uint64_t, kBucketCount> buckets{};
+    uint64_t count = 0;
+    Duration sum{0};
+    Duration max{0};
+
+    /**
+     * @brief Среднее значение.
+     */
+    [[nodiscard]] Duration GetAvg() const;
+    /**
+     * @brief Оценка перцентиля сверху (по верхней границе корзины).
+     * @param percentile значение из [0, 1]
+     */
+    [[nodiscard]] Duration GetPercentile(double percentile) const;
+  };
+
+  /**
+   * @brief Добавить новое значение.
+   */
+  void Record(Duration value);
+  /**
+   * @brief Получить снимок состояния гистограммы.
+   *
+   * Снимок не является атомарным по отношению к параллельным записям, но каждое отдельное
+   * значение в нем корректно.
+   */
+  [[nodiscard]] Snapshot GetSnapshot() const;
+
+ private:
+  std::array<std::atomic_uint64_t, kBucketCount> buckets_{};
+  std::atomic_uint64_t count_ = 0;
+  std::atomic_int64_t sum_ = 0;
+  std::atomic_int64_t max_ = 0;
+};
+
+}  // namespace call_center::core::tasks
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_LATENCY_HISTOGRAM_H_
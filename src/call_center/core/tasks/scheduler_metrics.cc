@@ -0,0 +1,144 @@
+#include "scheduler_metrics.h"
+
+#include <algorithm>
+
+namespace call_center::core::tasks {
+
+using namespace std::chrono;
+
+thread_local SchedulerMetrics::ThreadSlot *SchedulerMetrics::current_thread_slot_ = nullptr;
+
+std::shared_ptr<SchedulerMetrics> SchedulerMetrics::Create() {
+  return std::shared_ptr<SchedulerMetrics>(new SchedulerMetrics());
+}
+
+SchedulerMetrics::ThreadSlot::ThreadSlot(const size_t id, const Clock::time_point start_time)
+    : id(id), start_time(start_time), interval(GetInterval(start_time)) {
+}
+
+void SchedulerMetrics::ThreadSlot::Reset(const Clock::time_point start_time) {
+  this->start_time = start_time;
+  busy_time.store(0, std::memory_order_relaxed);
+  interval.store(GetInterval(start_time), std::memory_order_relaxed);
+  interval_busy_time.store(0, std::memory_order_relaxed);
+  previous_interval_busy_time.store(0, std::memory_order_relaxed);
+  active.store(true, std::memory_order_relaxed);
+}
+
+void SchedulerMetrics::RegisterCurrentThread() {
+  std::lock_guard lock(threads_mutex_);
+  const auto now = Clock::now();
+  const auto free_slot = std::ranges::find_if(threads_, [](const ThreadSlot &slot) {
+    return !slot.active.load(std::memory_order_relaxed);
+  });
+  if (free_slot != threads_.end()) {
+    free_slot->Reset(now);
+    current_thread_slot_ = &*free_slot;
+  } else {
+    current_thread_slot_ = &threads_.emplace_back(threads_.size(), now);
+  }
+}
+
+void SchedulerMetrics::UnregisterCurrentThread() {
+  std::lock_guard lock(threads_mutex_);
+  if (current_thread_slot_) {
+    current_thread_slot_->active.store(false, std::memory_order_relaxed);
+    current_thread_slot_ = nullptr;
+  }
+}
+
+void SchedulerMetrics::RecordTask(
+    const TaskCategory category, const Duration wait_time, const Duration run_time
+) {
+  auto &histograms = categories_[static_cast<size_t>(category)];
+  histograms.wait_time.Record(wait_time);
+  histograms.run_time.Record(run_time);
+  AddBusyTime(Clock::now(), run_time);
+}
+
+SchedulerMetrics::Snapshot SchedulerMetrics::GetSnapshot() const {
+  Snapshot snapshot;
+  for (size_t i = 0; i < kTaskCategoryCount; ++i) {
+    snapshot.categories.push_back(
+        {static_cast<TaskCategory>(i),
+         categories_[i].wait_time.GetSnapshot(),
+         categories_[i].run_time.GetSnapshot()}
+    );
+  }
+
+  const auto now = Clock::now();
+  std::lock_guard lock(threads_mutex_);
+  snapshot.threads.reserve(threads_.size());
+  for (const auto &slot : threads_) {
+    const auto &thread = snapshot.threads.emplace_back(MakeThreadSnapshot(slot, now));
+    if (thread.active) {
+      ++snapshot.active_thread_count;
+      snapshot.utilization += thread.utilization;
+    }
+  }
+  if (snapshot.active_thread_count > 0) {
+    snapshot.utilization /= static_cast<double>(snapshot.active_thread_count);
+  }
+  return snapshot;
+}
+
+std::string_view SchedulerMetrics::ToString(const TaskCategory category) {
+  switch (category) {
+    case TaskCategory::kImmediate:
+      return "immediate";
+    case TaskCategory::kDelayed:
+      return "delayed";
+    case TaskCategory::kDeferred:
+      return "deferred";
+  }
+  return "unknown";
+}
+
+SchedulerMetrics::Clock::rep SchedulerMetrics::GetInterval(const Clock::time_point time_point) {
+  return time_point.time_since_epoch() / kUtilizationInterval;
+}
+
+void SchedulerMetrics::AddBusyTime(const Clock::time_point now, const Duration busy_time) {
+  auto *const slot = current_thread_slot_;
+  if (!slot) {
+    return;
+  }
+  const auto busy = duration_cast<Clock::duration>(busy_time).count();
+  slot->busy_time.fetch_add(busy, std::memory_order_relaxed);
+
+  const auto current_interval = GetInterval(now);
+  const auto slot_interval = slot->interval.load(std::memory_order_relaxed);
+  if (slot_interval != current_interval) {
+    const auto previous_busy = slot_interval + 1 == current_interval
+                                   ? slot->interval_busy_time.load(std::memory_order_relaxed)
+                                   : 0;
+    slot->previous_interval_busy_time.store(previous_busy, std::memory_order_relaxed);
+    slot->interval_busy_time.store(0, std::memory_order_relaxed);
+    slot->interval.store(current_interval, std::memory_order_relaxed);
+  }
+  slot->interval_busy_time.fetch_add(busy, std::memory_order_relaxed);
+}
+
+SchedulerMetrics::ThreadSnapshot SchedulerMetrics::MakeThreadSnapshot(
+    const ThreadSlot &slot, const Clock::time_point now
+) {
+  const auto current_interval = GetInterval(now);
+  const auto slot_interval = slot.interval.load(std::memory_order_relaxed);
+  Clock::rep last_interval_busy_time = 0;
+  if (slot_interval == current_interval) {
+    last_interval_busy_time = slot.previous_interval_busy_time.load(std::memory_order_relaxed);
+  } else if (slot_interval + 1 == current_interval) {
+    last_interval_busy_time = slot.interval_busy_time.load(std::memory_order_relaxed);
+  }
+  const auto utilization = duration<double>(Clock::duration(last_interval_busy_time)) /
+                           duration<double>(kUtilizationInterval);
+
+  return {
+      .id = slot.id,
+      .active = slot.active.load(std::memory_order_relaxed),
+      .busy_time = Clock::duration(slot.busy_time.load(std::memory_order_relaxed)),
+      .lifetime = now - slot.start_time,
+      .utilization = std::clamp(utilization, 0.0, 1.0)};
+}
+
+}  // namespace call_center::core::tasks
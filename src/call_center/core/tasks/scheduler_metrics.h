@@ -0,0 +1,164 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_SCHEDULER_METRICS_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_SCHEDULER_METRICS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "latency_histogram.h"
+
+namespace call_center::core::tasks {
+
+/**
+ * @brief Метрики выполнения пользовательских задач в @link TaskManagerImpl @endlink.
+ *
+ * Для каждой категории задач собираются гистограммы времени ожидания и времени выполнения.
+ * Для немедленных задач время ожидания - это время от постановки задачи до ее запуска, для
+ * отложенных - опоздание запуска относительно срабатывания таймера. Кроме того, для каждого
+ * потока-исполнителя учитывается время, в течение которого он был занят выполнением задач.
+ */
+class SchedulerMetrics {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using Duration = LatencyHistogram::Duration;
+
+  /**
+   * @brief Категория задачи.
+   */
+  enum class TaskCategory : size_t {
+    /// Задача, поставленная через PostTask.
+    kImmediate,
+    /// Задача, поставленная через PostTaskDelayed.
+    kDelayed,
+    /// Задача, поставленная через PostTaskAt.
+    kDeferred
+  };
+  static constexpr size_t kTaskCategoryCount = 3;
+
+  /// Интервал, за который вычисляется загруженность потока.
+  static constexpr std::chrono::seconds kUtilizationInterval{1};
+
+  /**
+   * @brief Снимок метрик категории задач.
+   */
+  struct CategorySnapshot {
+    TaskCategory category;
+    LatencyHistogram::Snapshot wait_time;
+    LatencyHistogram::Snapshot run_time;
+  };
+
+  /**
+   * @brief Снимок метрик потока-исполнителя.
+   */
+  struct ThreadSnapshot {
+    size_t id;
+    /// Выполняет ли поток задачи в данный момент (не был ли он остановлен).
+    bool active;
+    /// Суммарное время выполнения задач потоком.
+    Duration busy_time;
+    /// Время жизни потока.
+    Duration lifetime;
+    /// Доля занятого времени за последний полный интервал @link kUtilizationInterval @endlink.
+    double utilization;
+  };
+
+  /**
+   * @brief Снимок всех метрик планировщика.
+   */
+  struct Snapshot {
+    std::vector<CategorySnapshot> categories;
+    std::vector<ThreadSnapshot> threads;
+    size_t active_thread_count = 0;
+    /// Средняя загруженность активных потоков.
+    double utilization = 0;
+  };
+
+  static std::shared_ptr<SchedulerMetrics> Create();
+
+  SchedulerMetrics(const SchedulerMetrics &other) = delete;
+  SchedulerMetrics &operator=(const SchedulerMetrics &other) = delete;
+
+  /**
+   * @brief Зарегистрировать текущий поток как поток-исполнитель.
+   *
+   * Должен вызываться из потока перед началом выполнения задач. Метрики завершившихся потоков
+   * переиспользуются, поэтому их количество не растет при изменении размера пула потоков.
+   */
+  void RegisterCurrentThread();
+  /**
+   * @brief Отметить, что текущий поток больше не выполняет задачи.
+   */
+  void UnregisterCurrentThread();
+  /**
+   * @brief Учесть выполненную задачу.
+   * @param wait_time время ожидания запуска задачи
+   * @param run_time время выполнения задачи
+   */
+  void RecordTask(TaskCategory category, Duration wait_time, Duration run_time);
+
+  [[nodiscard]] Snapshot GetSnapshot() const;
+
+  /**
+   * @brief Название категории задач.
+   */
+  static std::string_view ToString(TaskCategory category);
+
+ private:
+  /**
+   * @brief Метрики одного потока-исполнителя.
+   *
+   * Изменяются только самим потоком, поэтому выровнены по линии кэша, чтобы потоки не мешали
+   * друг другу.
+   */
+  struct alignas(64) ThreadSlot {
+    const size_t id;
+    /// Защищено мьютексом списка потоков.
+    Clock::time_point start_time;
+    std::atomic_bool active = true;
+    std::atomic<Clock::rep> busy_time = 0;
+    /// Номер текущего интервала @link kUtilizationInterval @endlink.
+    std::atomic<Clock::rep> interval = 0;
+    std::atomic<Clock::rep> interval_busy_time = 0;
+    std::atomic<Clock::rep> previous_interval_busy_time = 0;
+
+    ThreadSlot(size_t id, Clock::time_point start_time);
+
+    /**
+     * @brief Сбросить метрики для нового потока.
+     */
+    void Reset(Clock::time_point start_time);
+  };
+
+  struct CategoryHistograms {
+    LatencyHistogram wait_time;
+    LatencyHistogram run_time;
+  };
+
+  /// Метрики текущего потока, если он зарегистрирован.
+  static thread_local ThreadSlot *current_thread_slot_;
+
+  std::array<CategoryHistograms, kTaskCategoryCount> categories_;
+  mutable std::mutex threads_mutex_;
+  std::deque<ThreadSlot> threads_;
+
+  SchedulerMetrics() = default;
+
+  /**
+   * @brief Номер интервала @link kUtilizationInterval @endlink, в который попадает момент времени.
+   */
+  static Clock::rep GetInterval(Clock::time_point time_point);
+  /**
+   * @brief Учесть время работы текущего потока.
+   */
+  static void AddBusyTime(Clock::time_point now, Duration busy_time);
+  static ThreadSnapshot MakeThreadSnapshot(const ThreadSlot &slot, Clock::time_point now);
+};
+
+}  // namespace call_center::core::tasks
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_SCHEDULER_METRICS_H_
@@ -3,7 +3,8 @@
 
 #include <boost/asio.hpp>
 #include <chrono>
-#include <functional>
+
+#include "core/utils/functional.h"
 
 /// Планирование и выполнение задач.
 namespace call_center::core::tasks {
@@ -17,6 +18,8 @@ namespace call_center::core::tasks {
 class TaskManager {
  public:
   using Task = void();
+  /// Обертка над задачей, не выделяющая память в куче для небольших задач.
+  using TaskFunction = utils::functional::UniqueFunction<Task>;
 
   TaskManager() = default;
   TaskManager(const TaskManager &other) = delete;
@@ -40,21 +43,21 @@ class TaskManager {
   /**
    * @brief Поставить задачу на выполнение.
    */
-  virtual void PostTask(std::function<Task> task) = 0;
+  virtual void PostTask(TaskFunction task) = 0;
 
   /**
    * @brief В указанное время (time_point) выполнить задачу.
    * @param time_point время, в которое нужно выполнить задачу
    */
   template <typename TimePoint>
-  void PostTaskAt(const TimePoint &time_point, const std::function<Task> &task);
+  void PostTaskAt(const TimePoint &time_point, TaskFunction task);
 
   /**
    * @brief Через указанную задержку (delay) выполнить задачу.
    * @param delay задержка, через которую нужно выполнить задачу
    */
   template <typename Duration>
-  void PostTaskDelayed(const Duration &delay, const std::function<Task> &task);
+  void PostTaskDelayed(const Duration &delay, TaskFunction task);
 
  protected:
   using Clock_t = std::chrono::utc_clock;
@@ -65,24 +68,24 @@ class TaskManager {
    * @brief Конкретная реализация метода @link PostTaskDelayed @endlink, но с определенными
    * временными единицами.
    */
-  virtual void PostTaskDelayedImpl(Duration_t delay, std::function<Task> task) = 0;
+  virtual void PostTaskDelayedImpl(Duration_t delay, TaskFunction task) = 0;
   /**
    * @brief Конкретная реализация метода @link PostTaskAt @endlink, но с определенными
    * временными единицами.
    */
-  virtual void PostTaskAtImpl(TimePoint_t time_point, std::function<Task> task) = 0;
+  virtual void PostTaskAtImpl(TimePoint_t time_point, TaskFunction task) = 0;
 };
 
 template <typename Duration>
-void TaskManager::PostTaskDelayed(const Duration &delay, const std::function<Task> &task) {
-  PostTaskDelayedImpl(std::chrono::duration_cast<Duration_t>(delay), task);
+void TaskManager::PostTaskDelayed(const Duration &delay, TaskFunction task) {
+  PostTaskDelayedImpl(std::chrono::duration_cast<Duration_t>(delay), std::move(task));
 }
 
 template <typename TimePoint>
-void TaskManager::PostTaskAt(const TimePoint &time_point, const std::function<Task> &task) {
+void TaskManager::PostTaskAt(const TimePoint &time_point, TaskFunction task) {
   PostTaskAtImpl(
       std::chrono::time_point_cast<Duration_t, Clock_t, typename TimePoint::duration>(time_point),
-      task
+      std::move(task)
   );
 }
 
@@ -8,8 +8,11 @@ namespace asio = boost::asio;
 
 const size_t TaskManagerImpl::kDefaultUserThreadCount =
     std::max(static_cast<size_t>(boost::thread::hardware_concurrency()), static_cast<size_t>(1));
+const size_t TaskManagerImpl::kDefaultUserMaxThreadCount = kDefaultUserThreadCount * 2;
 const size_t TaskManagerImpl::kDefaultIoThreadCount =
-    std::max(static_cast<size_t>(boost::thread::hardware_concurrency()), static_cast<size_t>(64));
+    std::max(static_cast<size_t>(boost::thread::hardware_concurrency()), static_cast<size_t>(1));
+const size_t TaskManagerImpl::kDefaultIoMaxThreadCount =
+    std::max(kDefaultIoThreadCount, static_cast<size_t>(64));
 
 std::shared_ptr<TaskManagerImpl> TaskManagerImpl::Create(
     std::shared_ptr<config::Configuration> configuration, const log::LoggerProvider &logger_provider
@@ -22,10 +25,13 @@ std::shared_ptr<TaskManagerImpl> TaskManagerImpl::Create(
 TaskManagerImpl::TaskManagerImpl(
     std::shared_ptr<config::Configuration> configuration, const log::LoggerProvider &logger_provider
 )
-    : user_work_guard_(make_work_guard(user_context_)),
+    : scheduler_metrics_(SchedulerMetrics::Create()),
+      user_work_guard_(make_work_guard(user_context_)),
       io_work_guard_(make_work_guard(io_context_)),
       logger_(logger_provider.Get("TaskManagerImpl")),
-      configuration_(std::move(configuration)) {
+      configuration_(std::move(configuration)),
+      user_pool_(user_context_, scheduler_metrics_, logger_provider.Get("ThreadPool (user)")),
+      io_pool_(io_context_, nullptr, logger_provider.Get("ThreadPool (io)")) {
 }
 
 TaskManagerImpl::~TaskManagerImpl() {
@@ -43,11 +49,11 @@ void TaskManagerImpl::Start() {
   }
   started_ = true;
 
-  io_thread_count_ = ReadIoThreadCount();
-  AddThreadsToGroup(io_threads_, io_thread_count_, io_context_);
-
-  user_thread_count_ = ReadUserThreadCount();
-  AddThreadsToGroup(user_threads_, user_thread_count_, user_context_);
+  PlacePool(io_pool_, kIoCpuSetKey, "I/O");
+  PlacePool(user_pool_, kUserCpuSetKey, "User");
+  io_pool_.Resize(ReadIoThreadCount());
+  user_pool_.Resize(ReadUserThreadCount());
+  SchedulePoolsAdjustment();
 }
 
 void TaskManagerImpl::Stop() {
@@ -67,66 +73,199 @@ void TaskManagerImpl::Stop() {
 }
 
 void TaskManagerImpl::Join() {
-  user_threads_.join_all();
-  io_threads_.join_all();
+  user_pool_.Join();
+  io_pool_.Join();
 }
 
 asio::io_context &TaskManagerImpl::IoContext() {
   return io_context_;
 }
 
-void TaskManagerImpl::PostTaskDelayedImpl(Duration_t delay, std::function<Task> task) {
-  logger_->Info() << "Starting the timer of task delayed by "
-                  << std::chrono::floor<std::chrono::milliseconds>(delay);
+void TaskManagerImpl::PostTaskDelayedImpl(Duration_t delay, TaskFunction task) {
+  logger_->Debug() << "Starting the timer of task delayed by "
+                   << std::chrono::floor<std::chrono::milliseconds>(delay);
 
   auto timer = std::make_unique<TimerTaskWrapped<Task, Clock_t>::Timer>(user_context_, delay);
-  timer->async_wait(MakeTimerTaskWrapped(std::move(task), std::move(timer)));
+  timer->async_wait(MakeTimerTaskWrapped(
+      std::move(task), SchedulerMetrics::TaskCategory::kDelayed, std::move(timer)
+  ));
 }
 
-void TaskManagerImpl::PostTaskAtImpl(TimePoint_t time_point, std::function<Task> task) {
-  logger_->Info() << "Starting the timer of deferred task until " << time_point;
+void TaskManagerImpl::PostTaskAtImpl(TimePoint_t time_point, TaskFunction task) {
+  logger_->Debug() << "Starting the timer of deferred task until " << time_point;
   auto timer = std::make_unique<TimerTaskWrapped<Task, Clock_t>::Timer>(user_context_, time_point);
-  timer->async_wait(MakeTimerTaskWrapped(std::move(task), std::move(timer)));
+  timer->async_wait(MakeTimerTaskWrapped(
+      std::move(task), SchedulerMetrics::TaskCategory::kDeferred, std::move(timer)
+  ));
 }
 
-void TaskManagerImpl::PostTask(std::function<Task> task) {
-  user_context_.post(MakeTaskWrapped(std::move(task)));
+void TaskManagerImpl::PostTask(TaskFunction task) {
+  asio::post(user_context_, MakeTaskWrapped(std::move(task)));
 }
 
 TimerTaskWrapped<TaskManager::Task, TaskManager::Clock_t> TaskManagerImpl::MakeTimerTaskWrapped(
-    std::function<Task> task, std::unique_ptr<TimerTaskWrapped<Task, Clock_t>::Timer> timer
+    TaskFunction task,
+    const SchedulerMetrics::TaskCategory category,
+    std::unique_ptr<TimerTaskWrapped<Task, Clock_t>::Timer> timer
 ) const {
-  return {std::move(task), std::move(timer), *logger_};
+  return {std::move(task), category, std::move(timer), *scheduler_metrics_, *logger_};
 }
 
-TaskWrapped<TaskManager::Task> TaskManagerImpl::MakeTaskWrapped(std::function<Task> task) const {
-  return {std::move(task), *logger_};
+TaskWrapped<TaskManager::Task> TaskManagerImpl::MakeTaskWrapped(TaskFunction task) const {
+  return {
+      std::move(task), SchedulerMetrics::TaskCategory::kImmediate, *scheduler_metrics_, *logger_};
 }
 
-size_t TaskManagerImpl::ReadUserThreadCount() const {
-  return configuration_->GetNumber<size_t>(kUserThreadCountKey, user_thread_count_, 1);
+void TaskManagerImpl::PlacePool(
+    ThreadPool &pool, const std::string &cpu_set_key, const std::string_view pool_name
+) {
+  const auto cpu_set_str = configuration_->GetProperty<std::string>(cpu_set_key);
+  if (!cpu_set_str) {
+    logger_->Info() << pool_name << " threads aren't pinned to CPUs";
+    return;
+  }
+  const auto cpu_set = utils::affinity::ParseCpuSet(*cpu_set_str);
+  if (!cpu_set) {
+    logger_->Warning() << "Invalid CPU set by key '" << cpu_set_key << "': " << *cpu_set_str;
+    return;
+  }
+
+  std::string numa_nodes;
+  for (const auto node : utils::affinity::GetNumaNodes(*cpu_set)) {
+    numa_nodes += (numa_nodes.empty() ? "" : ",") + std::to_string(node);
+  }
+  logger_->Info() << pool_name << " threads are pinned to CPUs "
+                  << utils::affinity::ToString(*cpu_set) << " (NUMA nodes: "
+                  << (numa_nodes.empty() ? "unknown" : numa_nodes) << ")";
+  pool.SetCpuSet(*cpu_set);
 }
 
-size_t TaskManagerImpl::ReadIoThreadCount() const {
-  return configuration_->GetNumber<size_t>(kIoThreadCountKey, io_thread_count_, 1);
+void TaskManagerImpl::SchedulePoolsAdjustment() {
+  PostTaskDelayed(ReadPoolAdjustmentPeriod(), [this]() {
+    AdjustPools();
+    SchedulePoolsAdjustment();
+  });
+}
+
+void TaskManagerImpl::AdjustPools() {
+  const auto target_queue_delay = ReadTargetQueueDelay();
+
+  const auto snapshot = scheduler_metrics_->GetSnapshot();
+  const auto user_limits = ReadUserThreadCountLimits();
+  user_pool_.Resize(ThreadPool::CalculateThreadCount(
+      user_pool_.GetThreadCount(),
+      user_limits.min,
+      user_limits.max,
+      TakeUserQueueDelay(snapshot),
+      target_queue_delay,
+      snapshot.utilization
+  ));
+
+  const auto io_limits = ReadIoThreadCountLimits();
+  io_pool_.Resize(ThreadPool::CalculateThreadCount(
+      io_pool_.GetThreadCount(),
+      io_limits.min,
+      io_limits.max,
+      GetIoQueueDelay(),
+      target_queue_delay,
+      std::nullopt
+  ));
+  PostIoProbe();
+}
+
+void TaskManagerImpl::PostIoProbe() {
+  if (io_probe_pending_.exchange(true)) {
+    return;
+  }
+  const auto post_time = SchedulerMetrics::Clock::now();
+  io_probe_post_time_ = post_time.time_since_epoch().count();
+  asio::post(io_context_, [this, post_time] {
+    io_probe_delay_ = (SchedulerMetrics::Clock::now() - post_time).count();
+    io_probe_pending_ = false;
+  });
+}
+
+SchedulerMetrics::Duration TaskManagerImpl::GetIoQueueDelay() const {
+  if (io_probe_pending_) {
+    const SchedulerMetrics::Clock::time_point post_time(
+        SchedulerMetrics::Clock::duration(io_probe_post_time_.load())
+    );
+    return SchedulerMetrics::Clock::now() - post_time;
+  }
+  return SchedulerMetrics::Clock::duration(io_probe_delay_.load());
 }
 
-void TaskManagerImpl::AddThreadsToGroup(
-    boost::thread_group &thread_group, const size_t thread_count, asio::io_context &context
+SchedulerMetrics::Duration TaskManagerImpl::TakeUserQueueDelay(
+    const SchedulerMetrics::Snapshot &snapshot
 ) {
-  for (size_t i = 0; i < thread_count; ++i) {
-    thread_group.add_thread(new boost::thread([&context] {
-      context.run();
-    }));
+  SchedulerMetrics::Duration wait_time_sum{0};
+  uint64_t task_count = 0;
+  for (const auto &category : snapshot.categories) {
+    wait_time_sum += category.wait_time.sum;
+    task_count += category.wait_time.count;
+  }
+  const auto wait_time_delta = wait_time_sum - last_user_wait_time_sum_;
+  const auto task_count_delta = task_count - last_user_task_count_;
+  last_user_wait_time_sum_ = wait_time_sum;
+  last_user_task_count_ = task_count;
+  if (task_count_delta == 0) {
+    return SchedulerMetrics::Duration::zero();
   }
+  return wait_time_delta / task_count_delta;
+}
+
+size_t TaskManagerImpl::ReadUserThreadCount() const {
+  const auto limits = ReadUserThreadCountLimits();
+  const auto thread_count =
+      configuration_->GetNumber<size_t>(kUserThreadCountKey, kDefaultUserThreadCount, 1);
+  return std::clamp(thread_count, limits.min, limits.max);
+}
+
+size_t TaskManagerImpl::ReadIoThreadCount() const {
+  const auto limits = ReadIoThreadCountLimits();
+  const auto thread_count =
+      configuration_->GetNumber<size_t>(kIoThreadCountKey, kDefaultIoThreadCount, 1);
+  return std::clamp(thread_count, limits.min, limits.max);
+}
+
+TaskManagerImpl::ThreadCountLimits TaskManagerImpl::ReadUserThreadCountLimits() const {
+  const auto min = configuration_->GetNumber<size_t>(kUserMinThreadCountKey, 1, 1);
+  const auto max = configuration_->GetNumber<size_t>(
+      kUserMaxThreadCountKey, std::max(kDefaultUserMaxThreadCount, min), min
+  );
+  return {.min = min, .max = max};
+}
+
+TaskManagerImpl::ThreadCountLimits TaskManagerImpl::ReadIoThreadCountLimits() const {
+  const auto min = configuration_->GetNumber<size_t>(kIoMinThreadCountKey, 1, 1);
+  const auto max = configuration_->GetNumber<size_t>(
+      kIoMaxThreadCountKey, std::max(kDefaultIoMaxThreadCount, min), min
+  );
+  return {.min = min, .max = max};
+}
+
+std::chrono::milliseconds TaskManagerImpl::ReadPoolAdjustmentPeriod() const {
+  return std::chrono::milliseconds(configuration_->GetNumber<int64_t>(
+      kPoolAdjustmentPeriodKey, kDefaultPoolAdjustmentPeriod.count(), 100
+  ));
+}
+
+std::chrono::milliseconds TaskManagerImpl::ReadTargetQueueDelay() const {
+  return std::chrono::milliseconds(
+      configuration_->GetNumber<int64_t>(kTargetQueueDelayKey, kDefaultTargetQueueDelay.count(), 1)
+  );
 }
 
 size_t TaskManagerImpl::GetUserThreadCount() const {
-  return user_thread_count_;
+  return user_pool_.GetThreadCount();
 }
 
 size_t TaskManagerImpl::GetIoThreadCount() const {
-  return io_thread_count_;
+  return io_pool_.GetThreadCount();
+}
+
+std::shared_ptr<const SchedulerMetrics> TaskManagerImpl::GetSchedulerMetrics() const {
+  return scheduler_metrics_;
 }
 
 }  // namespace call_center::core::tasks
@@ -3,14 +3,15 @@
 
 #include <boost/asio.hpp>
 #include <chrono>
-#include <functional>
 
 #include "configuration/configuration.h"
 #include "log/logger.h"
 #include "log/logger_provider.h"
 #include "log/sink.h"
+#include "scheduler_metrics.h"
 #include "task_manager.h"
 #include "tasks.h"
+#include "thread_pool.h"
 
 namespace call_center::core::tasks {
 
@@ -18,13 +19,37 @@ namespace call_center::core::tasks {
  * @brief Реализация @link TaskManager @endlink.
  *
  * Использует два отдельных пула потоков: для задач ввода-вывода и для пользовательских задач.
+ * Размер пулов периодически пересчитывается в пределах, заданных конфигурацией: для
+ * пользовательских задач - по времени ожидания задач и загруженности потоков, для задач
+ * ввода-вывода - по времени ожидания пробной задачи.
  */
 class TaskManagerImpl : public TaskManager {
  public:
-  /// Ключ в конфигурации, соответствующий количеству потоков для пользовательских задач.
+  /// Ключ в конфигурации, соответствующий начальному количеству потоков для пользовательских
+  /// задач.
   static constexpr auto kUserThreadCountKey = "task_manager_user_thread_count";
-  /// Ключ в конфигурации, соответствующий количеству потоков для задач ввода-вывода.
+  /// Ключ в конфигурации, соответствующий минимальному количеству потоков для пользовательских
+  /// задач.
+  static constexpr auto kUserMinThreadCountKey = "task_manager_user_min_thread_count";
+  /// Ключ в конфигурации, соответствующий максимальному количеству потоков для пользовательских
+  /// задач.
+  static constexpr auto kUserMaxThreadCountKey = "task_manager_user_max_thread_count";
+  /// Ключ в конфигурации, соответствующий начальному количеству потоков для задач ввода-вывода.
   static constexpr auto kIoThreadCountKey = "task_manager_io_thread_count";
+  /// Ключ в конфигурации, соответствующий минимальному количеству потоков для задач
+  /// ввода-вывода.
+  static constexpr auto kIoMinThreadCountKey = "task_manager_io_min_thread_count";
+  /// Ключ в конфигурации, соответствующий максимальному количеству потоков для задач
+  /// ввода-вывода.
+  static constexpr auto kIoMaxThreadCountKey = "task_manager_io_max_thread_count";
+  /// Ключ в конфигурации, соответствующий периоду пересчета размера пулов в миллисекундах.
+  static constexpr auto kPoolAdjustmentPeriodKey = "task_manager_pool_adjustment_period";
+  /// Ключ в конфигурации, соответствующий целевому времени ожидания задач в миллисекундах.
+  static constexpr auto kTargetQueueDelayKey = "task_manager_target_queue_delay";
+  /// Ключ в конфигурации, соответствующий набору процессоров для пользовательских потоков.
+  static constexpr auto kUserCpuSetKey = "task_manager_user_cpu_set";
+  /// Ключ в конфигурации, соответствующий набору процессоров для потоков ввода-вывода.
+  static constexpr auto kIoCpuSetKey = "task_manager_io_cpu_set";
 
   static std::shared_ptr<TaskManagerImpl> Create(
       std::shared_ptr<config::Configuration> configuration,
@@ -38,18 +63,36 @@ class TaskManagerImpl : public TaskManager {
   void Stop() final;
   void Join() final;
   boost::asio::io_context &IoContext() override;
-  void PostTask(std::function<Task> task) override;
+  void PostTask(TaskFunction task) override;
   [[nodiscard]] size_t GetUserThreadCount() const;
   [[nodiscard]] size_t GetIoThreadCount() const;
+  /**
+   * @brief Метрики выполнения пользовательских задач.
+   */
+  [[nodiscard]] std::shared_ptr<const SchedulerMetrics> GetSchedulerMetrics() const;
 
  protected:
-  void PostTaskDelayedImpl(Duration_t delay, std::function<Task> task) override;
-  void PostTaskAtImpl(TimePoint_t time_point, std::function<Task> task) override;
+  void PostTaskDelayedImpl(Duration_t delay, TaskFunction task) override;
+  void PostTaskAtImpl(TimePoint_t time_point, TaskFunction task) override;
 
  private:
+  /**
+   * @brief Пределы размера пула потоков.
+   */
+  struct ThreadCountLimits {
+    size_t min;
+    size_t max;
+  };
+
   static const size_t kDefaultUserThreadCount;
+  static const size_t kDefaultUserMaxThreadCount;
   static const size_t kDefaultIoThreadCount;
+  static const size_t kDefaultIoMaxThreadCount;
+  static constexpr std::chrono::milliseconds kDefaultPoolAdjustmentPeriod{1000};
+  static constexpr std::chrono::milliseconds kDefaultTargetQueueDelay{5};
 
+  /// Объявлены до контекстов, так как используются задачами, которые хранятся в контекстах.
+  const std::shared_ptr<SchedulerMetrics> scheduler_metrics_;
   boost::asio::io_context io_context_;
   boost::asio::io_context user_context_;
   boost::asio::executor_work_guard<boost::asio::io_context::executor_type> user_work_guard_;
@@ -59,18 +102,17 @@ class TaskManagerImpl : public TaskManager {
   mutable std::mutex start_mutex_;
   const std::unique_ptr<log::Logger> logger_;
   const std::shared_ptr<config::Configuration> configuration_;
-  boost::thread_group user_threads_;
-  boost::thread_group io_threads_;
-  std::atomic_size_t user_thread_count_ = kDefaultUserThreadCount;
-  std::atomic_size_t io_thread_count_ = kDefaultIoThreadCount;
-
-  /**
-   * @brief Добавить определенное количество потоков в группу потоков, при этом каждый из потоков
-   * выполняет метод run из переданного контекста (boost::asio::io_context).
-   */
-  static void AddThreadsToGroup(
-      boost::thread_group &thread_group, size_t thread_count, boost::asio::io_context &context
-  );
+  ThreadPool user_pool_;
+  ThreadPool io_pool_;
+  /// Суммарное время ожидания пользовательских задач при предыдущем пересчете размера пулов.
+  SchedulerMetrics::Duration last_user_wait_time_sum_{0};
+  /// Количество выполненных пользовательских задач при предыдущем пересчете размера пулов.
+  uint64_t last_user_task_count_ = 0;
+  /// Время постановки пробной задачи в контекст ввода-вывода.
+  std::atomic<SchedulerMetrics::Clock::rep> io_probe_post_time_ = 0;
+  /// Время ожидания последней выполненной пробной задачи.
+  std::atomic<SchedulerMetrics::Clock::rep> io_probe_delay_ = 0;
+  std::atomic_bool io_probe_pending_ = false;
 
   TaskManagerImpl(
       std::shared_ptr<config::Configuration> configuration,
@@ -80,13 +122,43 @@ class TaskManagerImpl : public TaskManager {
   /**
    * @brief Обернуть переданную задачу в специальный класс.
    */
-  TaskWrapped<Task> MakeTaskWrapped(std::function<Task> task) const;
+  TaskWrapped<Task> MakeTaskWrapped(TaskFunction task) const;
   /**
    * @brief Обернуть переданную задачу с таймером в специальный класс.
    */
   TimerTaskWrapped<Task, Clock_t> MakeTimerTaskWrapped(
-      std::function<Task> task, std::unique_ptr<TimerTaskWrapped<Task, Clock_t>::Timer> timer
+      TaskFunction task,
+      SchedulerMetrics::TaskCategory category,
+      std::unique_ptr<TimerTaskWrapped<Task, Clock_t>::Timer> timer
   ) const;
+  /**
+   * @brief Прочитать из конфигурации набор процессоров для пула потоков, привязать к нему пул и
+   * сообщить о размещении потоков в лог.
+   * @param cpu_set_key ключ в конфигурации, соответствующий набору процессоров
+   * @param pool_name название пула для лога
+   */
+  void PlacePool(ThreadPool &pool, const std::string &cpu_set_key, std::string_view pool_name);
+  /**
+   * @brief Запланировать пересчет размера пулов потоков.
+   */
+  void SchedulePoolsAdjustment();
+  /**
+   * @brief Пересчитать размер пулов потоков по измеренной нагрузке.
+   */
+  void AdjustPools();
+  /**
+   * @brief Поставить пробную задачу в контекст ввода-вывода для измерения времени ожидания.
+   */
+  void PostIoProbe();
+  /**
+   * @brief Время ожидания пробной задачи в контексте ввода-вывода. Если она еще не выполнена, то
+   * время, прошедшее с момента ее постановки.
+   */
+  [[nodiscard]] SchedulerMetrics::Duration GetIoQueueDelay() const;
+  /**
+   * @brief Среднее время ожидания пользовательских задач с момента предыдущего вызова.
+   */
+  SchedulerMetrics::Duration TakeUserQueueDelay(const SchedulerMetrics::Snapshot &snapshot);
   /**
    * @brief Прочитать значение количества пользовательских потоков из конфигурации.
    */
@@ -95,6 +167,16 @@ class TaskManagerImpl : public TaskManager {
    * @brief Прочитать значение количества потоков ввода-вывода из конфигурации.
    */
   [[nodiscard]] size_t ReadIoThreadCount() const;
+  /**
+   * @brief Прочитать пределы размера пула пользовательских потоков из конфигурации.
+   */
+  [[nodiscard]] ThreadCountLimits ReadUserThreadCountLimits() const;
+  /**
+   * @brief Прочитать пределы размера пула потоков ввода-вывода из конфигурации.
+   */
+  [[nodiscard]] ThreadCountLimits ReadIoThreadCountLimits() const;
+  [[nodiscard]] std::chrono::milliseconds ReadPoolAdjustmentPeriod() const;
+  [[nodiscard]] std::chrono::milliseconds ReadTargetQueueDelay() const;
 };
 
 }  // namespace call_center::core::tasks
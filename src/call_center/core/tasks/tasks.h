@@ -2,27 +2,42 @@
 #define CALL_CENTER_SRC_CALL_CENTER_TASKS_H_
 
 #include <boost/asio.hpp>
-#include <functional>
 
+#include "core/utils/functional.h"
 #include "log/logger.h"
+#include "scheduler_metrics.h"
 
 namespace call_center::core::tasks {
 
 /**
  * @brief Класс-обертка для задачи.
+ *
+ * Только перемещаемый, поэтому задача не копируется при передаче в контекст выполнения.
+ * Запоминает время постановки задачи и после выполнения передает время ожидания и выполнения в
+ * @link SchedulerMetrics @endlink.
  */
 template <typename Task>
 class TaskWrapped {
  public:
-  TaskWrapped(std::function<Task> task, log::Logger &logger);
+  using Function = utils::functional::UniqueFunction<Task>;
+  using Category = SchedulerMetrics::TaskCategory;
+
+  TaskWrapped(Function task, Category category, SchedulerMetrics &metrics, log::Logger &logger);
 
   /**
    * @brief Запустить задау.
    */
   void operator()() const;
+  /**
+   * @brief Запустить задачу, указав время, которое она ожидала запуска.
+   */
+  void Run(SchedulerMetrics::Duration wait_time) const;
 
  private:
-  std::function<Task> task_;
+  Function task_;
+  Category category_;
+  SchedulerMetrics::Clock::time_point post_time_;
+  SchedulerMetrics &metrics_;
   log::Logger &logger_;
 };
 
@@ -31,13 +46,21 @@ class TaskWrapped {
  *
  * Ссылка на запущенный таймер сохраняется внутри экзмепляра.
  * При запуске таймера экземпляр данного класса необходимо передать в качестве обратного вызова.
+ * Временем ожидания задачи считается опоздание ее запуска относительно времени срабатывания
+ * таймера.
  */
 template <typename Task, typename Clock>
 class TimerTaskWrapped {
  public:
   using Timer = boost::asio::basic_waitable_timer<Clock>;
 
-  TimerTaskWrapped(std::function<Task> task, std::unique_ptr<Timer> timer, log::Logger &logger);
+  TimerTaskWrapped(
+      typename TaskWrapped<Task>::Function task,
+      typename TaskWrapped<Task>::Category category,
+      std::unique_ptr<Timer> timer,
+      SchedulerMetrics &metrics,
+      log::Logger &logger
+  );
 
   /**
    * @brief Запустить задау.
@@ -45,7 +68,7 @@ class TimerTaskWrapped {
   void operator()(const boost::system::error_code &error) const;
 
  private:
-  const TaskWrapped<Task> task_;
+  TaskWrapped<Task> task_;
   log::Logger &logger_;
   std::unique_ptr<Timer> timer_;
 };
@@ -53,7 +76,8 @@ class TimerTaskWrapped {
 template <typename Task, typename Clock>
 void TimerTaskWrapped<Task, Clock>::operator()(const boost::system::error_code &error) const {
   if (!error) {
-    task_();
+    const auto lateness = Clock::now() - timer_->expiry();
+    task_.Run(std::chrono::duration_cast<SchedulerMetrics::Duration>(lateness));
   } else {
     logger_.Error() << "System error in timer that used by the deferred task: " << error;
   }
@@ -61,26 +85,45 @@ void TimerTaskWrapped<Task, Clock>::operator()(const boost::system::error_code &
 
 template <typename Task, typename Clock>
 TimerTaskWrapped<Task, Clock>::TimerTaskWrapped(
-    std::function<Task> task, std::unique_ptr<Timer> timer, log::Logger &logger
+    typename TaskWrapped<Task>::Function task,
+    typename TaskWrapped<Task>::Category category,
+    std::unique_ptr<Timer> timer,
+    SchedulerMetrics &metrics,
+    log::Logger &logger
 )
-    : task_(std::move(task), logger), logger_(logger), timer_(std::move(timer)) {
+    : task_(std::move(task), category, metrics, logger),
+      logger_(logger),
+      timer_(std::move(timer)) {
 }
 
 template <typename Task>
-TaskWrapped<Task>::TaskWrapped(std::function<Task> task, log::Logger &logger)
-    : task_(std::move(task)), logger_(logger) {
+TaskWrapped<Task>::TaskWrapped(
+    Function task, const Category category, SchedulerMetrics &metrics, log::Logger &logger
+)
+    : task_(std::move(task)),
+      category_(category),
+      post_time_(SchedulerMetrics::Clock::now()),
+      metrics_(metrics),
+      logger_(logger) {
 }
 
 template <typename Task>
 void TaskWrapped<Task>::operator()() const {
+  Run(SchedulerMetrics::Clock::now() - post_time_);
+}
+
+template <typename Task>
+void TaskWrapped<Task>::Run(const SchedulerMetrics::Duration wait_time) const {
+  const auto start_time = SchedulerMetrics::Clock::now();
   try {
-    logger_.Info() << "Starting execution of the user task";
+    logger_.Trace() << "Starting execution of the user task";
     task_();
   } catch (const std::exception &ex) {
     logger_.Error() << "Unhandled std::exception in task: " << ex.what();
   } catch (...) {
     logger_.Error() << "Unknown unhandled exception in task";
   }
+  metrics_.RecordTask(category_, wait_time, SchedulerMetrics::Clock::now() - start_time);
 }
 
 }  // namespace call_center::core::tasks
@@ -0,0 +1,171 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace call_center::core::tasks {
+
+namespace asio = boost::asio;
+
+ThreadPool::ThreadPool(
+    asio::io_context &context,
+    std::shared_ptr<SchedulerMetrics> metrics,
+    std::unique_ptr<log::Logger> logger
+)
+    : context_(context), metrics_(std::move(metrics)), logger_(std::move(logger)) {
+}
+
+void ThreadPool::Resize(const size_t thread_count) {
+  JoinRetiredThreads();
+  std::lock_guard lock(mutex_);
+  if (thread_count == thread_count_) {
+    return;
+  }
+  logger_->Info() << "Resize thread pool from " << thread_count_ << " to " << thread_count;
+
+  // потоки, которые еще не успели завершиться, остаются в пуле вместо запуска новых
+  const auto kept_count =
+      thread_count > thread_count_ ? CancelRetirements(thread_count - thread_count_) : 0;
+  for (size_t i = thread_count_ + kept_count; i < thread_count; ++i) {
+    auto thread = std::make_unique<boost::thread>([this] {
+      Work();
+    });
+    const auto id = thread->get_id();
+    threads_.emplace(id, std::move(thread));
+  }
+  if (thread_count < thread_count_) {
+    retiring_count_.fetch_add(thread_count_ - thread_count, std::memory_order_relaxed);
+  }
+  for (size_t i = thread_count; i < thread_count_; ++i) {
+    asio::post(context_, [] {});
+  }
+  thread_count_ = thread_count;
+}
+
+void ThreadPool::SetCpuSet(utils::affinity::CpuSet cpu_set) {
+  std::lock_guard lock(mutex_);
+  cpu_set_ = std::move(cpu_set);
+}
+
+void ThreadPool::Join() {
+  {
+    std::unique_lock lock(mutex_);
+    threads_finished_.wait(lock, [this] {
+      return threads_.empty();
+    });
+  }
+  JoinRetiredThreads();
+}
+
+size_t ThreadPool::GetThreadCount() const {
+  std::lock_guard lock(mutex_);
+  return thread_count_;
+}
+
+size_t ThreadPool::GetRunningThreadCount() const {
+  std::lock_guard lock(mutex_);
+  return threads_.size();
+}
+
+void ThreadPool::Work() {
+  ApplyCpuSet();
+  if (metrics_) {
+    metrics_->RegisterCurrentThread();
+  }
+  // run_one возвращает 0, когда контекст остановлен или в нем не осталось работы
+  while (context_.run_one() > 0) {
+    if (TryRetire()) {
+      logger_->Debug() << "Thread retired";
+      break;
+    }
+  }
+  if (metrics_) {
+    metrics_->UnregisterCurrentThread();
+  }
+
+  // Поток сам переносит себя в завершенные, поэтому после освобождения мьютекса к пулу обращаться
+  // нельзя.
+  std::lock_guard lock(mutex_);
+  const auto thread = threads_.find(boost::this_thread::get_id());
+  retired_threads_.push_back(std::move(thread->second));
+  threads_.erase(thread);
+  threads_finished_.notify_all();
+}
+
+bool ThreadPool::TryRetire() {
+  auto retiring_count = retiring_count_.load(std::memory_order_relaxed);
+  while (retiring_count > 0) {
+    if (retiring_count_.compare_exchange_weak(
+            retiring_count, retiring_count - 1, std::memory_order_relaxed
+        )) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t ThreadPool::CancelRetirements(const size_t count) {
+  auto retiring_count = retiring_count_.load(std::memory_order_relaxed);
+  while (retiring_count > 0) {
+    const auto cancelled_count = std::min(count, retiring_count);
+    if (retiring_count_.compare_exchange_weak(
+            retiring_count, retiring_count - cancelled_count, std::memory_order_relaxed
+        )) {
+      return cancelled_count;
+    }
+  }
+  return 0;
+}
+
+void ThreadPool::JoinRetiredThreads() {
+  std::vector<std::unique_ptr<boost::thread>> retired_threads;
+  {
+    std::lock_guard lock(mutex_);
+    retired_threads.swap(retired_threads_);
+  }
+  for (const auto &thread : retired_threads) {
+    thread->join();
+  }
+}
+
+void ThreadPool::ApplyCpuSet() {
+  utils::affinity::CpuSet cpu_set;
+  {
+    std::lock_guard lock(mutex_);
+    cpu_set = cpu_set_;
+  }
+  if (cpu_set.empty()) {
+    return;
+  }
+  if (utils::affinity::SetCurrentThreadAffinity(cpu_set)) {
+    logger_->Debug() << "Thread pinned to CPUs " << utils::affinity::ToString(cpu_set);
+  } else {
+    logger_->Warning() << "Couldn't pin thread to CPUs " << utils::affinity::ToString(cpu_set);
+  }
+}
+
+size_t ThreadPool::CalculateThreadCount(
+    const size_t thread_count,
+    const size_t min_thread_count,
+    const size_t max_thread_count,
+    const Duration queue_delay,
+    const Duration target_queue_delay,
+    const std::optional<double> utilization
+) {
+  auto new_thread_count = thread_count;
+  if (queue_delay > target_queue_delay) {
+    new_thread_count += std::max(thread_count / 4, static_cast<size_t>(1));
+  } else if (utilization && *utilization > kHighUtilization) {
+    new_thread_count += 1;
+  } else if (queue_delay <= target_queue_delay / 4 && thread_count > 1) {
+    const auto remaining_utilization =
+        utilization.value_or(0) * static_cast<double>(thread_count) / (thread_count - 1);
+    if (remaining_utilization <= kTargetUtilization) {
+      new_thread_count -= 1;
+    }
+  }
+  return std::clamp(
+      new_thread_count, min_thread_count, std::max(min_thread_count, max_thread_count)
+  );
+}
+
+}  // namespace call_center::core::tasks
@@ -0,0 +1,134 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_THREAD_POOL_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_THREAD_POOL_H_
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "core/utils/affinity.h"
+#include "log/logger.h"
+#include "scheduler_metrics.h"
+
+namespace call_center::core::tasks {
+
+/**
+ * @brief Пул потоков, выполняющих метод run переданного контекста (boost::asio::io_context),
+ * размер которого можно изменять во время работы.
+ *
+ * Потоки выполняют задачи контекста по одной и после каждой проверяют счетчик потоков, которые
+ * нужно завершить. Для уменьшения пула счетчик увеличивается, а в контекст ставятся пустые задачи,
+ * чтобы разбудить ожидающие потоки. Поэтому уменьшение происходит не мгновенно, а по мере
+ * освобождения потоков.
+ */
+class ThreadPool {
+ public:
+  using Duration = std::chrono::nanoseconds;
+
+  /// Загруженность потоков, выше которой пул увеличивается.
+  static constexpr double kHighUtilization = 0.85;
+  /// Загруженность, которую должны иметь потоки после уменьшения пула.
+  static constexpr double kTargetUtilization = 0.7;
+
+  /**
+   * @param metrics метрики, в которых регистрируются потоки пула (может быть nullptr)
+   */
+  ThreadPool(
+      boost::asio::io_context &context,
+      std::shared_ptr<SchedulerMetrics> metrics,
+      std::unique_ptr<log::Logger> logger
+  );
+  ThreadPool(const ThreadPool &other) = delete;
+  ThreadPool &operator=(const ThreadPool &other) = delete;
+
+  /**
+   * @brief Изменить количество потоков в пуле.
+   */
+  void Resize(size_t thread_count);
+  /**
+   * @brief Задать набор процессоров, к которому привязываются потоки пула.
+   *
+   * Применяется к потокам, запущенным после вызова. Пустой набор отключает привязку.
+   */
+  void SetCpuSet(utils::affinity::CpuSet cpu_set);
+  /**
+   * @brief Ожидать завершения всех потоков пула, включая завершенные при уменьшении пула.
+   */
+  void Join();
+  /**
+   * @brief Целевое количество потоков в пуле.
+   */
+  [[nodiscard]] size_t GetThreadCount() const;
+  /**
+   * @brief Количество потоков, работающих в данный момент (включая еще не завершившиеся после
+   * уменьшения пула).
+   */
+  [[nodiscard]] size_t GetRunningThreadCount() const;
+
+  /**
+   * @brief Рассчитать новый размер пула по измеренной нагрузке.
+   *
+   * Пул увеличивается, если время ожидания задач превышает целевое либо потоки перегружены, и
+   * уменьшается на один поток, если задачи почти не ждут и оставшиеся потоки не будут перегружены.
+   * @param thread_count текущее количество потоков
+   * @param min_thread_count минимальное количество потоков
+   * @param max_thread_count максимальное количество потоков
+   * @param queue_delay среднее время ожидания задач в очереди
+   * @param target_queue_delay целевое время ожидания задач в очереди
+   * @param utilization средняя загруженность потоков, если она измеряется
+   */
+  static size_t CalculateThreadCount(
+      size_t thread_count,
+      size_t min_thread_count,
+      size_t max_thread_count,
+      Duration queue_delay,
+      Duration target_queue_delay,
+      std::optional<double> utilization
+  );
+
+ private:
+  boost::asio::io_context &context_;
+  const std::shared_ptr<SchedulerMetrics> metrics_;
+  const std::unique_ptr<log::Logger> logger_;
+  mutable std::mutex mutex_;
+  std::condition_variable threads_finished_;
+  std::map<boost::thread::id, std::unique_ptr<boost::thread>> threads_;
+  /// Потоки, завершившие работу, но еще не присоединенные.
+  std::vector<std::unique_ptr<boost::thread>> retired_threads_;
+  /// Количество потоков, которые должны завершиться для уменьшения пула.
+  std::atomic_size_t retiring_count_ = 0;
+  size_t thread_count_ = 0;
+  utils::affinity::CpuSet cpu_set_;
+
+  /**
+   * @brief Метод, выполняемый каждым потоком пула.
+   */
+  void Work();
+  /**
+   * @brief Забрать одно из требований завершения потока, если они есть.
+   */
+  bool TryRetire();
+  /**
+   * @brief Отменить до count требований завершения потоков.
+   * @return Количество отмененных требований.
+   */
+  size_t CancelRetirements(size_t count);
+  /**
+   * @brief Присоединить потоки, завершившие работу.
+   */
+  void JoinRetiredThreads();
+  /**
+   * @brief Привязать текущий поток к набору процессоров пула.
+   */
+  void ApplyCpuSet();
+};
+
+}  // namespace call_center::core::tasks
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_TASKS_THREAD_POOL_H_
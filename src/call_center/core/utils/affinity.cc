@@ -0,0 +1,119 @@
+#include "affinity.h"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace call_center::core::utils::affinity {
+
+#ifdef __linux__
+static_assert(kMaxCpuCount == CPU_SETSIZE);
+#endif
+
+namespace {
+
+std::optional<size_t> ParseNumber(const std::string_view str) {
+  size_t number = 0;
+  const auto result = std::from_chars(str.data(), str.data() + str.size(), number);
+  if (result.ec != std::errc() || result.ptr != str.data() + str.size()) {
+    return std::nullopt;
+  }
+  return number;
+}
+
+}  // namespace
+
+std::optional<CpuSet> ParseCpuSet(std::string_view cpu_set) {
+  CpuSet cpus;
+  while (!cpu_set.empty()) {
+    const auto range_end = std::min(cpu_set.find(','), cpu_set.size());
+    const auto range = cpu_set.substr(0, range_end);
+    cpu_set.remove_prefix(std::min(range_end + 1, cpu_set.size()));
+
+    const auto dash = range.find('-');
+    const auto first = ParseNumber(range.substr(0, dash));
+    const auto last = dash == std::string_view::npos ? first : ParseNumber(range.substr(dash + 1));
+    if (!first || !last || *first > *last || *last >= kMaxCpuCount) {
+      return std::nullopt;
+    }
+    for (auto cpu = *first; cpu <= *last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  if (cpus.empty()) {
+    return std::nullopt;
+  }
+  std::ranges::sort(cpus);
+  const auto duplicates = std::ranges::unique(cpus);
+  cpus.erase(duplicates.begin(), duplicates.end());
+  return cpus;
+}
+
+std::string ToString(const CpuSet &cpu_set) {
+  std::string result;
+  for (size_t i = 0; i < cpu_set.size();) {
+    auto j = i;
+    while (j + 1 < cpu_set.size() && cpu_set[j + 1] == cpu_set[j] + 1) {
+      ++j;
+    }
+    if (!result.empty()) {
+      result += ',';
+    }
+    result += std::to_string(cpu_set[i]);
+    if (j > i) {
+      result += '-' + std::to_string(cpu_set[j]);
+    }
+    i = j + 1;
+  }
+  return result;
+}
+
+bool SetCurrentThreadAffinity(const CpuSet &cpu_set) {
+#ifdef __linux__
+  cpu_set_t native_cpu_set;
+  CPU_ZERO(&native_cpu_set);
+  for (const auto cpu : cpu_set) {
+    if (cpu >= CPU_SETSIZE) {
+      return false;
+    }
+    CPU_SET(cpu, &native_cpu_set);
+  }
+  return pthread_setaffinity_np(pthread_self(), sizeof(native_cpu_set), &native_cpu_set) == 0;
+#else
+  return false;
+#endif
+}
+
+std::optional<size_t> GetNumaNode(const size_t cpu) {
+  namespace fs = std::filesystem;
+  static constexpr std::string_view kNodePrefix = "node";
+
+  std::error_code error;
+  const fs::path cpu_path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+  for (const auto &entry : fs::directory_iterator(cpu_path, error)) {
+    const auto name = entry.path().filename().string();
+    if (name.starts_with(kNodePrefix)) {
+      if (const auto node = ParseNumber(std::string_view(name).substr(kNodePrefix.size()))) {
+        return node;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+std::set<size_t> GetNumaNodes(const CpuSet &cpu_set) {
+  std::set<size_t> nodes;
+  for (const auto cpu : cpu_set) {
+    if (const auto node = GetNumaNode(cpu)) {
+      nodes.insert(*node);
+    }
+  }
+  return nodes;
+}
+
+}  // namespace call_center::core::utils::affinity
@@ -0,0 +1,50 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_AFFINITY_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_AFFINITY_H_
+
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Вспомогательные классы для привязки потоков к процессорам.
+namespace call_center::core::utils::affinity {
+
+/// Набор номеров процессоров (логических ядер).
+using CpuSet = std::vector<size_t>;
+
+/// Максимальное количество процессоров в наборе (CPU_SETSIZE в glibc).
+inline constexpr size_t kMaxCpuCount = 1024;
+
+/**
+ * @brief Разобрать набор процессоров в формате cpuset из Linux, например: "0-3,8,10-11".
+ * @return std::nullopt - если строка имеет неверный формат
+ *     или номер процессора не меньше @link kMaxCpuCount @endlink
+ */
+std::optional<CpuSet> ParseCpuSet(std::string_view cpu_set);
+
+/**
+ * @brief Преобразовать набор процессоров в строку в формате cpuset из Linux.
+ */
+std::string ToString(const CpuSet &cpu_set);
+
+/**
+ * @brief Привязать текущий поток к набору процессоров.
+ * @return true - если привязка выполнена успешно
+ */
+bool SetCurrentThreadAffinity(const CpuSet &cpu_set);
+
+/**
+ * @brief Номер узла NUMA, к которому относится процессор.
+ * @return std::nullopt - если система не предоставляет информацию о NUMA
+ */
+std::optional<size_t> GetNumaNode(size_t cpu);
+
+/**
+ * @brief Узлы NUMA, к которым относятся процессоры из набора.
+ */
+std::set<size_t> GetNumaNodes(const CpuSet &cpu_set);
+
+}  // namespace call_center::core::utils::affinity
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_AFFINITY_H_
@@ -0,0 +1,207 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_FUNCTIONAL_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_FUNCTIONAL_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// Вспомогательные классы для работы с функциональными объектами.
+namespace call_center::core::utils::functional {
+
+template <typename Signature, size_t kBufferSize = 64>
+class UniqueFunction;
+
+/**
+ * @brief Перемещаемая (но не копируемая) обертка над вызываемым объектом.
+ *
+ * В отличие от std::function, не требует копируемости вызываемого объекта и хранит объекты
+ * размером до kBufferSize байт во внутреннем буфере без выделения памяти в куче. Объекты большего
+ * размера, а также объекты, перемещение которых может выбросить исключение, размещаются в куче.
+ * @tparam R тип возвращаемого значения
+ * @tparam Args типы аргументов
+ * @tparam kBufferSize размер внутреннего буфера в байтах
+ */
+template <typename R, typename... Args, size_t kBufferSize>
+class UniqueFunction<R(Args...), kBufferSize> {
+ public:
+  UniqueFunction() noexcept;
+  UniqueFunction(std::nullptr_t) noexcept;  // NOLINT(google-explicit-constructor)
+
+  template <typename F>
+    requires(!std::is_same_v<std::decay_t<F>, UniqueFunction> &&
+             std::is_invocable_r_v<R, std::decay_t<F> &, Args...>)
+  UniqueFunction(F &&f) {  // NOLINT(google-explicit-constructor)
+    Emplace(std::forward<F>(f));
+  }
+
+  UniqueFunction(UniqueFunction &&other) noexcept;
+  UniqueFunction &operator=(UniqueFunction &&other) noexcept;
+  UniqueFunction(const UniqueFunction &other) = delete;
+  UniqueFunction &operator=(const UniqueFunction &other) = delete;
+  ~UniqueFunction();
+
+  /**
+   * @brief Вызвать хранимый объект.
+   *
+   * Как и у std::function, оператор константный, но хранимый объект вызывается как неконстантный.
+   * @throw std::bad_function_call если объект пуст
+   */
+  R operator()(Args... args) const;
+  explicit operator bool() const noexcept;
+
+  /**
+   * @brief Хранится ли вызываемый объект во внутреннем буфере (без выделения памяти в куче).
+   */
+  [[nodiscard]] bool IsInline() const noexcept;
+
+ private:
+  /**
+   * @brief Таблица операций над хранимым объектом, своя для каждого типа объекта.
+   */
+  struct VTable {
+    R (*invoke)(void *storage, Args &&...args);
+    /// Переместить объект из src в неинициализированный dst и уничтожить объект в src.
+    void (*relocate)(void *dst, void *src) noexcept;
+    void (*destroy)(void *storage) noexcept;
+    bool is_inline;
+  };
+
+  template <typename F>
+  static constexpr bool kFitsInline = sizeof(F) <= kBufferSize &&
+                                      alignof(F) <= alignof(std::max_align_t) &&
+                                      std::is_nothrow_move_constructible_v<F>;
+
+  template <typename F>
+  static const VTable kInlineVTable;
+  template <typename F>
+  static const VTable kHeapVTable;
+
+  alignas(std::max_align_t) mutable std::byte storage_[kBufferSize];
+  const VTable *vtable_ = nullptr;
+
+  /**
+   * @brief Разместить вызываемый объект во внутреннем буфере либо в куче.
+   */
+  template <typename F>
+  void Emplace(F &&f);
+  void Reset() noexcept;
+};
+
+template <typename R, typename... Args, size_t kBufferSize>
+template <typename F>
+const typename UniqueFunction<R(Args...), kBufferSize>::VTable
+    UniqueFunction<R(Args...), kBufferSize>::kInlineVTable{
+        .invoke = [](void *storage, Args &&...args) -> R {
+          return std::invoke(*static_cast<F *>(storage), std::forward<Args>(args)...);
+        },
+        .relocate = [](void *dst, void *src) noexcept {
+          ::new (dst) F(std::move(*static_cast<F *>(src)));
+          static_cast<F *>(src)->~F();
+        },
+        .destroy = [](void *storage) noexcept {
+          static_cast<F *>(storage)->~F();
+        },
+        .is_inline = true};
+
+template <typename R, typename... Args, size_t kBufferSize>
+template <typename F>
+const typename UniqueFunction<R(Args...), kBufferSize>::VTable
+    UniqueFunction<R(Args...), kBufferSize>::kHeapVTable{
+        .invoke = [](void *storage, Args &&...args) -> R {
+          return std::invoke(**static_cast<F **>(storage), std::forward<Args>(args)...);
+        },
+        .relocate = [](void *dst, void *src) noexcept {
+          ::new (dst) F *(*static_cast<F **>(src));
+        },
+        .destroy = [](void *storage) noexcept {
+          delete *static_cast<F **>(storage);
+        },
+        .is_inline = false};
+
+template <typename R, typename... Args, size_t kBufferSize>
+UniqueFunction<R(Args...), kBufferSize>::UniqueFunction() noexcept {
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+UniqueFunction<R(Args...), kBufferSize>::UniqueFunction(std::nullptr_t) noexcept {
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+template <typename F>
+void UniqueFunction<R(Args...), kBufferSize>::Emplace(F &&f) {
+  using Functor = std::decay_t<F>;
+  if constexpr (std::is_pointer_v<Functor> || std::is_member_pointer_v<Functor> ||
+                requires { static_cast<bool>(f); }) {
+    if (!static_cast<bool>(f)) {
+      return;
+    }
+  }
+  if constexpr (kFitsInline<Functor>) {
+    ::new (static_cast<void *>(storage_)) Functor(std::forward<F>(f));
+    vtable_ = &kInlineVTable<Functor>;
+  } else {
+    ::new (static_cast<void *>(storage_)) Functor *(new Functor(std::forward<F>(f)));
+    vtable_ = &kHeapVTable<Functor>;
+  }
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+UniqueFunction<R(Args...), kBufferSize>::UniqueFunction(UniqueFunction &&other) noexcept
+    : vtable_(other.vtable_) {
+  if (vtable_) {
+    vtable_->relocate(storage_, other.storage_);
+    other.vtable_ = nullptr;
+  }
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+UniqueFunction<R(Args...), kBufferSize> &UniqueFunction<R(Args...), kBufferSize>::operator=(
+    UniqueFunction &&other
+) noexcept {
+  if (this != &other) {
+    Reset();
+    if (other.vtable_) {
+      other.vtable_->relocate(storage_, other.storage_);
+      vtable_ = std::exchange(other.vtable_, nullptr);
+    }
+  }
+  return *this;
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+UniqueFunction<R(Args...), kBufferSize>::~UniqueFunction() {
+  Reset();
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+R UniqueFunction<R(Args...), kBufferSize>::operator()(Args... args) const {
+  if (!vtable_) {
+    throw std::bad_function_call();
+  }
+  return vtable_->invoke(storage_, std::forward<Args>(args)...);
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+UniqueFunction<R(Args...), kBufferSize>::operator bool() const noexcept {
+  return vtable_ != nullptr;
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+bool UniqueFunction<R(Args...), kBufferSize>::IsInline() const noexcept {
+  return vtable_ != nullptr && vtable_->is_inline;
+}
+
+template <typename R, typename... Args, size_t kBufferSize>
+void UniqueFunction<R(Args...), kBufferSize>::Reset() noexcept {
+  if (vtable_) {
+    vtable_->destroy(storage_);
+    vtable_ = nullptr;
+  }
+}
+
+}  // namespace call_center::core::utils::functional
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_FUNCTIONAL_H_
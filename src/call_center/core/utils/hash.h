@@ -0,0 +1,24 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_HASH_H_
+#define CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/// Вспомогательные функции хеширования.
+namespace call_center::core::utils::hash {
+
+/**
+ * @brief Перемешать биты целого числа (финализатор SplitMix64).
+ *
+ * Ключи (адреса, номера телефонов) часто отличаются только младшими битами, а таблицы с размером
+ * степени двойки используют именно младшие биты хеша.
+ */
+constexpr size_t Mix64(uint64_t value) noexcept {
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+  return static_cast<size_t>(value ^ (value >> 31));
+}
+
+}  // namespace call_center::core::utils::hash
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_HASH_H_
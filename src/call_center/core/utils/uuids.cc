@@ -1,9 +1,20 @@
 #include "uuids.h"
 
+#include <boost/uuid/string_generator.hpp>
+#include <stdexcept>
+
 namespace call_center::core::utils::uuids {
 
 std::ostream &operator<<(std::ostream &out, boost::uuids::uuid id) {
   return out << "'" << to_string(id) << "'";
 }
 
+std::optional<boost::uuids::uuid> Parse(const std::string_view str) {
+  try {
+    return boost::uuids::string_generator()(str.begin(), str.end());
+  } catch ([[maybe_unused]] const std::runtime_error &error) {
+    return std::nullopt;
+  }
+}
+
 }  // namespace call_center::core::utils::uuids
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define CALL_CENTER_SRC_CALL_CENTER_CORE_UTILS_UUIDS_H_
 
 #include <boost/uuid/uuid_io.hpp>
+#include <optional>
+#include <string_view>
 
 /// Вспомогательные классы для работы с boost::uuids::uuid.
 namespace call_center::core::utils::uuids {
@@ -10,6 +12,11 @@ namespace call_center::core::utils::uuids {
  * @brief Вывести boost::uuids::uuid в std::ostream.
  */
 std::ostream &operator<<(std::ostream &out, boost::uuids::uuid id);
+/**
+ * @brief Разобрать текстовое представление boost::uuids::uuid.
+ * @return std::nullopt - если строка не является идентификатором
+ */
+std::optional<boost::uuids::uuid> Parse(std::string_view str);
 
 }  // namespace call_center::core::utils::uuids
 
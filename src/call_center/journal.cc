@@ -33,7 +33,7 @@ std::string Journal::FormatCallDetailedRecord(const CallDetailedRecord &cdr) {
       std::make_format_args(
           FormatTimePoint(cdr.GetArrivalTime()),
           FormatUuid(cdr.GetId()),
-          cdr.GetCallerPhoneNumber(),
+          cdr.GetCallerPhoneNumber().Format().View(),
           FormatTimePoint(cdr.GetServiceCompleteTime()),
           to_string(*cdr.GetStatus()),
           FormatTimePoint(cdr.GetServiceStartTime()),
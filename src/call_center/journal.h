@@ -32,6 +32,10 @@ class Journal {
    * @brief Добавить вызов в журнал.
    */
   void AddRecord(const CallDetailedRecord &cdr);
+  /**
+   * @brief Преобразовать вызов в строку.
+   */
+  static std::string FormatCallDetailedRecord(const CallDetailedRecord &cdr);
 
  private:
   static constexpr auto kFileNameKey_ = "journal_file_name";
@@ -51,10 +55,6 @@ class Journal {
    * @brief Задает формат логов (записей вызовов).
    */
   static void Formatter(const boost::log::record_view &rec, boost::log::formatting_ostream &out);
-  /**
-   * @brief Преобразовать вызов в строку.
-   */
-  static std::string FormatCallDetailedRecord(const CallDetailedRecord &cdr);
   /**
    * @brief Преобразовать временную точку в строку формата: yyyy-mm-dd hh24:mm:ss.fff.
    */
@@ -1,11 +1,18 @@
+#include <boost/asio/signal_set.hpp>
+#include <csignal>
+
 #include "call_center.h"
 #include "configuration/configuration.h"
 #include "configuration/configuration_updater.h"
 #include "core/http/http_server.h"
+#include "core/instrumentation/instrumentation_report.h"
 #include "core/tasks/task_manager_impl.h"
 #include "journal.h"
 #include "main_sink.h"
+#include "operator_autoscaler.h"
 #include "repository/call/call_repository.h"
+#include "repository/debug/debug_repository.h"
+#include "repository/events/events_repository.h"
 #include "repository/metrics/metrics_repository.h"
 
 using namespace call_center;
@@ -14,6 +21,7 @@ using namespace call_center::core::http;
 using namespace call_center::log;
 using namespace call_center::core;
 using namespace call_center::core::tasks;
+using namespace call_center::core::instrumentation;
 using namespace call_center::core::qs::metrics;
 using namespace call_center::repository;
 
@@ -37,20 +45,44 @@ int main() {
     return Operator::Create(task_manager, configuration, logger_provider);
   };
   const auto metrics = QueueingSystemMetrics::Create(task_manager, configuration, logger_provider);
+  const auto operator_autoscaler =
+      OperatorAutoscaler::Create(metrics, task_manager, configuration, logger_provider);
+  operator_autoscaler->Start();
   const auto call_center = CallCenter::Create(
       std::make_unique<Journal>(configuration),
       configuration,
       task_manager,
       logger_provider,
-      std::make_unique<OperatorSet>(configuration, operator_provider, logger_provider, metrics),
+      std::make_unique<OperatorSet>(
+          configuration, operator_provider, logger_provider, metrics, operator_autoscaler
+      ),
       std::make_unique<CallQueue>(configuration, logger_provider),
       metrics
   );
   const auto http_server =
       HttpServer::Create(task_manager->IoContext(), tcp::endpoint{address, port}, logger_provider);
-  http_server->AddRepository(CallRepository::Create(call_center, configuration, logger_provider));
-  http_server->AddRepository(MetricsRepository::Create(metrics, logger_provider));
+  http_server->AddRepository(
+      CallRepository::Create(call_center, task_manager, configuration, logger_provider)
+  );
+  http_server->AddRepository(
+      MetricsRepository::Create(
+          metrics, task_manager->GetSchedulerMetrics(), configuration, logger_provider
+      )
+  );
+  http_server->AddRepository(DebugRepository::Create(metrics, logger_provider));
+  http_server->AddRepository(EventsRepository::Create(call_center, logger_provider));
   task_manager->Start();
   http_server->Start();
-  task_manager->Join();
+
+  net::io_context signal_context;
+  net::signal_set signals(signal_context, SIGINT, SIGTERM);
+  signals.async_wait([&task_manager](const boost::system::error_code &error, int) {
+    if (!error) {
+      task_manager->Stop();
+    }
+  });
+  signal_context.run();
+
+  logger_provider.Get("Main")->Info() << "Instrumentation report: "
+                                      << InstrumentationReport::Collect(metrics->GetArrivalCount());
 }
@@ -37,20 +37,22 @@ bool Operator::IsBusy() const {
 }
 
 void Operator::HandleCall(
-    const std::shared_ptr<CallDetailedRecord> &call, const OnFinishHandle &on_finish
+    const std::shared_ptr<CallDetailedRecord> &call, OnFinishHandle on_finish
 ) {
   assert(status_ == Status::kFree);
   status_ = Status::kBusy;
 
-  const auto finish_handle = [op = shared_from_this(), on_finish]() mutable {
-    op->status_ = Status::kFree;
-    on_finish();
-  };
   const auto delay = GetCallDelay();
 
   logger_->Info() << "Handle call '" << boost::uuids::to_string(call->GetId()) << "' for " << delay;
 
-  task_manager_->PostTaskDelayed(delay, finish_handle);
+  task_manager_->PostTaskDelayed(
+      delay,
+      [op = shared_from_this(), on_finish = std::move(on_finish)]() {
+        op->status_ = Status::kFree;
+        on_finish(op);
+      }
+  );
 }
 
 void Operator::UpdateDistributionParameters() {
@@ -3,7 +3,6 @@
 
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
-#include <functional>
 #include <memory>
 #include <random>
 
@@ -11,6 +10,7 @@
 #include "configuration/configuration.h"
 #include "core/queueing_system/server.h"
 #include "core/tasks/task_manager.h"
+#include "core/utils/functional.h"
 
 namespace call_center {
 
@@ -28,8 +28,13 @@ class Operator : public std::enable_shared_from_this<Operator>, public core::qs:
     kBusy   ///< Занят обработкой вызова.
   };
 
-  /// Обратный вызов при завершении обслуживания вызова.
-  using OnFinishHandle = std::function<void()>;
+  /// Обратный вызов при завершении обслуживания вызова, получает освободившегося оператора.
+  ///
+  /// Размер буфера выбран так, чтобы задача завершения обслуживания (указатель на оператора и
+  /// данный обратный вызов) целиком помещалась во внутренний буфер задачи @link
+  /// core::tasks::TaskManager::TaskFunction @endlink.
+  using OnFinishHandle =
+      core::utils::functional::UniqueFunction<void(const std::shared_ptr<Operator> &), 32>;
   /// Единицы измерения продолжительности обработки вызова.
   using DelayDuration = std::chrono::seconds;
 
@@ -59,7 +64,7 @@ class Operator : public std::enable_shared_from_this<Operator>, public core::qs:
    * @param on_finish обратный вызов при завершении обслуживания
    */
   virtual void HandleCall(
-      const std::shared_ptr<CallDetailedRecord> &call, const OnFinishHandle &on_finish
+      const std::shared_ptr<CallDetailedRecord> &call, OnFinishHandle on_finish
   );
 
  protected:
@@ -0,0 +1,189 @@
+#include "operator_autoscaler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/queueing_system/metrics/erlang.h"
+
+namespace call_center {
+
+using namespace core::qs::metrics;
+
+std::shared_ptr<OperatorAutoscaler> OperatorAutoscaler::Create(
+    std::shared_ptr<QueueingSystemMetrics> metrics,
+    std::shared_ptr<core::tasks::TaskManager> task_manager,
+    std::shared_ptr<config::Configuration> configuration,
+    const log::LoggerProvider &logger_provider
+) {
+  return std::shared_ptr<OperatorAutoscaler>(new OperatorAutoscaler(
+      std::move(metrics), std::move(task_manager), std::move(configuration), logger_provider
+  ));
+}
+
+OperatorAutoscaler::OperatorAutoscaler(
+    std::shared_ptr<QueueingSystemMetrics> metrics,
+    std::shared_ptr<core::tasks::TaskManager> task_manager,
+    std::shared_ptr<config::Configuration> configuration,
+    const log::LoggerProvider &logger_provider
+)
+    : metrics_(std::move(metrics)),
+      task_manager_(std::move(task_manager)),
+      configuration_(std::move(configuration)),
+      logger_(logger_provider.Get("OperatorAutoscaler")) {
+}
+
+void OperatorAutoscaler::Start() {
+  if (started_.test_and_set()) {
+    return;
+  }
+  logger_->Info() << "Start operator autoscaling";
+  prev_wait_time_histogram_ = metrics_->GetWaitTimeHistogram();
+  ScheduleUpdate();
+}
+
+void OperatorAutoscaler::Stop() {
+  if (!started_.test()) {
+    return;
+  }
+  logger_->Info() << "Stop operator autoscaling";
+  started_.clear();
+}
+
+std::optional<size_t> OperatorAutoscaler::GetOperatorCount() const {
+  const auto operator_count = operator_count_.load(std::memory_order_relaxed);
+  if (operator_count == 0) {
+    return std::nullopt;
+  }
+  return operator_count;
+}
+
+size_t OperatorAutoscaler::CalculateDesiredOperatorCount(
+    const size_t operator_count, const Measurements &measurements, const Settings &settings
+) {
+  using erlang::Seconds;
+
+  const auto load = measurements.arrival_rate * Seconds(measurements.service_time).count();
+  auto desired_count = erlang::GetRequiredServerCount(
+                           load,
+                           measurements.service_time,
+                           settings.target_answer_time,
+                           settings.target_service_level,
+                           settings.max_count
+  )
+                           .value_or(settings.max_count);
+  if (measurements.wait_time > settings.target_answer_time ||
+      measurements.loss_probability > settings.max_loss_probability) {
+    desired_count = std::max(desired_count, operator_count + 1);
+  }
+  return std::clamp(desired_count, settings.min_count, settings.max_count);
+}
+
+size_t OperatorAutoscaler::CalculateOperatorCount(
+    const size_t operator_count, const size_t desired_count, const size_t scale_down_periods
+) {
+  const auto count = static_cast<double>(operator_count);
+  if (desired_count > operator_count) {
+    const auto max_step =
+        std::max<size_t>(1, static_cast<size_t>(std::ceil(count * kMaxScaleUpRatio)));
+    return std::min(desired_count, operator_count + max_step);
+  }
+  const auto below_threshold =
+      static_cast<double>(desired_count) < count * (1 - kScaleDownThreshold);
+  if (below_threshold && scale_down_periods >= kScaleDownPeriods) {
+    const auto max_step =
+        std::max<size_t>(1, static_cast<size_t>(std::floor(count * kMaxScaleDownRatio)));
+    return std::max(desired_count, operator_count - std::min(max_step, operator_count));
+  }
+  return operator_count;
+}
+
+void OperatorAutoscaler::ScheduleUpdate() {
+  if (!started_.test()) {
+    return;
+  }
+  const std::chrono::seconds period(
+      configuration_->GetNumber<uint64_t>(kPeriodKey, kDefaultPeriod_, 1)
+  );
+  task_manager_->PostTaskDelayed(period, [autoscaler = shared_from_this(), period]() {
+    autoscaler->Update(period);
+    autoscaler->ScheduleUpdate();
+  });
+}
+
+void OperatorAutoscaler::Update(const std::chrono::seconds period) {
+  const auto measurements = Measure(period);
+  if (!configuration_->GetProperty<bool>(kEnabledKey, kDefaultEnabled_)) {
+    if (operator_count_.exchange(0, std::memory_order_relaxed) != 0) {
+      logger_->Info() << "Operator autoscaling disabled";
+    }
+    scale_down_periods_ = 0;
+    return;
+  }
+
+  const auto settings = ReadSettings();
+  auto operator_count = operator_count_.load(std::memory_order_relaxed);
+  if (operator_count == 0) {
+    operator_count = metrics_->GetServerCount();
+  }
+  const auto desired_count =
+      CalculateDesiredOperatorCount(operator_count, measurements, settings);
+  const auto below_threshold = static_cast<double>(desired_count) <
+                               static_cast<double>(operator_count) * (1 - kScaleDownThreshold);
+  scale_down_periods_ = below_threshold ? scale_down_periods_ + 1 : 0;
+  const auto new_count = std::clamp(
+      CalculateOperatorCount(operator_count, desired_count, scale_down_periods_),
+      settings.min_count,
+      settings.max_count
+  );
+
+  if (new_count != operator_count) {
+    logger_->Info() << "Change operator count: " << operator_count << " -> " << new_count
+                    << " (desired: " << desired_count
+                    << ", arrival rate: " << measurements.arrival_rate
+                    << ", wait time: " << measurements.wait_time.count()
+                    << "ms, loss: " << measurements.loss_probability << ")";
+    scale_down_periods_ = 0;
+  }
+  operator_count_.store(new_count, std::memory_order_relaxed);
+  metrics_->RecordScalingDecision(operator_count, desired_count, new_count);
+}
+
+OperatorAutoscaler::Measurements OperatorAutoscaler::Measure(const std::chrono::seconds period) {
+  Measurements measurements;
+  const auto window = metrics_->GetWindowMetrics(period);
+  measurements.arrival_rate = window.GetArrivalRate();
+  if (window.serviced_count > 0) {
+    service_time_ = window.service_time_sum / window.serviced_count;
+  }
+  measurements.service_time = service_time_;
+  if (window.arrival_count > 0) {
+    measurements.loss_probability =
+        static_cast<double>(window.dropout_count) / static_cast<double>(window.arrival_count);
+  }
+
+  auto wait_time_histogram = metrics_->GetWaitTimeHistogram();
+  auto period_wait_time_histogram = wait_time_histogram;
+  period_wait_time_histogram.Subtract(prev_wait_time_histogram_);
+  prev_wait_time_histogram_ = std::move(wait_time_histogram);
+  measurements.wait_time = period_wait_time_histogram.GetPercentile(kWaitPercentile);
+  return measurements;
+}
+
+OperatorAutoscaler::Settings OperatorAutoscaler::ReadSettings() const {
+  Settings settings;
+  settings.min_count = configuration_->GetNumber<size_t>(kMinCountKey, kDefaultMinCount_, 1);
+  settings.max_count = std::max(
+      configuration_->GetNumber<size_t>(kMaxCountKey, kDefaultMaxCount_, 1), settings.min_count
+  );
+  settings.target_answer_time = std::chrono::seconds(
+      configuration_->GetNumber<uint64_t>(kTargetAnswerTimeKey, kDefaultTargetAnswerTime_)
+  );
+  settings.target_service_level = configuration_->GetNumber<double>(
+      kTargetServiceLevelKey, kDefaultTargetServiceLevel_, 0, 1
+  );
+  settings.max_loss_probability =
+      configuration_->GetNumber<double>(kMaxLossKey, kDefaultMaxLoss_, 0, 1);
+  return settings;
+}
+
+}  // namespace call_center
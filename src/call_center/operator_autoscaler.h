@@ -0,0 +1,179 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_OPERATOR_AUTOSCALER_H_
+#define CALL_CENTER_SRC_CALL_CENTER_OPERATOR_AUTOSCALER_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+
+#include "configuration/configuration.h"
+#include "core/queueing_system/metrics/hdr_histogram.h"
+#include "core/queueing_system/metrics/queueing_system_metrics.h"
+#include "core/tasks/task_manager.h"
+#include "log/logger_provider.h"
+
+namespace call_center {
+
+/**
+ * @brief Регулятор количества операторов по текущим метрикам системы.
+ *
+ * Периодически рассчитывает по формуле Erlang C количество операторов, необходимое для целевого
+ * уровня обслуживания при измеренных за период интенсивности поступления и времени обслуживания.
+ * Если за период перцентиль времени ожидания или доля отклоненных вызовов превышают целевые
+ * значения, количество увеличивается хотя бы на одного оператора. Увеличение выполняется сразу,
+ * уменьшение - только если рассчитанное количество заметно меньше текущего в течение нескольких
+ * периодов подряд. Изменение за один период ограничено. Каждое решение записывается в метрики.
+ *
+ * Пока регулирование выключено в конфигурации, количество операторов задается ключом
+ * @link OperatorSet::kOperatorCountKey @endlink.
+ */
+class OperatorAutoscaler : public std::enable_shared_from_this<OperatorAutoscaler> {
+ public:
+  using Duration = core::qs::metrics::QueueingSystemMetrics::Duration;
+
+  /// Ключ в конфигурации, включающий регулирование количества операторов.
+  static constexpr auto kEnabledKey = "operator_autoscaling_enabled";
+  /// Ключ в конфигурации, соответствующий минимальному количеству операторов.
+  static constexpr auto kMinCountKey = "operator_autoscaling_min_count";
+  /// Ключ в конфигурации, соответствующий максимальному количеству операторов.
+  static constexpr auto kMaxCountKey = "operator_autoscaling_max_count";
+  /// Ключ в конфигурации, соответствующий периоду регулирования в секундах.
+  static constexpr auto kPeriodKey = "operator_autoscaling_period";
+  /// Ключ в конфигурации, соответствующий целевому времени ожидания ответа в секундах.
+  static constexpr auto kTargetAnswerTimeKey = "operator_autoscaling_target_answer_time";
+  /// Ключ в конфигурации, соответствующий целевой доле вызовов, ожидающих не дольше целевого
+  /// времени.
+  static constexpr auto kTargetServiceLevelKey = "operator_autoscaling_target_service_level";
+  /// Ключ в конфигурации, соответствующий допустимой доле отклоненных вызовов.
+  static constexpr auto kMaxLossKey = "operator_autoscaling_max_loss";
+
+  /// Перцентиль времени ожидания, сравниваемый с целевым временем.
+  static constexpr double kWaitPercentile = 0.9;
+  /// Относительное превышение текущего количества над рассчитанным, начиная с которого
+  /// количество уменьшается.
+  static constexpr double kScaleDownThreshold = 0.1;
+  /// Количество периодов подряд с превышением, после которого количество уменьшается.
+  static constexpr size_t kScaleDownPeriods = 3;
+  /// Наибольшее относительное увеличение количества за период.
+  static constexpr double kMaxScaleUpRatio = 0.5;
+  /// Наибольшее относительное уменьшение количества за период.
+  static constexpr double kMaxScaleDownRatio = 0.1;
+
+  /**
+   * @brief Измерения за последний период регулирования.
+   */
+  struct Measurements {
+    /// Интенсивность поступления вызовов (в секунду).
+    double arrival_rate = 0;
+    /// Среднее время обслуживания.
+    Duration service_time{0};
+    /// Перцентиль @link kWaitPercentile @endlink времени ожидания.
+    Duration wait_time{0};
+    /// Доля отклоненных вызовов.
+    double loss_probability = 0;
+  };
+
+  /**
+   * @brief Параметры регулирования.
+   */
+  struct Settings {
+    size_t min_count = 1;
+    size_t max_count = 1;
+    Duration target_answer_time{0};
+    double target_service_level = 0;
+    double max_loss_probability = 0;
+  };
+
+  static std::shared_ptr<OperatorAutoscaler> Create(
+      std::shared_ptr<core::qs::metrics::QueueingSystemMetrics> metrics,
+      std::shared_ptr<core::tasks::TaskManager> task_manager,
+      std::shared_ptr<config::Configuration> configuration,
+      const log::LoggerProvider &logger_provider
+  );
+
+  OperatorAutoscaler(const OperatorAutoscaler &other) = delete;
+  OperatorAutoscaler &operator=(const OperatorAutoscaler &other) = delete;
+
+  /**
+   * @brief Запустить периодическое регулирование.
+   */
+  void Start();
+  /**
+   * @brief Остановить регулирование.
+   */
+  void Stop();
+  /**
+   * @brief Количество операторов, установленное регулятором.
+   * @return std::nullopt - если регулирование выключено
+   */
+  [[nodiscard]] std::optional<size_t> GetOperatorCount() const;
+
+  /**
+   * @brief Рассчитать необходимое количество операторов по измерениям.
+   * @param operator_count текущее количество операторов
+   */
+  static size_t CalculateDesiredOperatorCount(
+      size_t operator_count, const Measurements &measurements, const Settings &settings
+  );
+  /**
+   * @brief Рассчитать новое количество операторов с учетом гистерезиса и ограничения скорости.
+   * @param operator_count текущее количество операторов
+   * @param desired_count необходимое количество операторов
+   * @param scale_down_periods количество периодов подряд, в которых текущее количество заметно
+   * больше необходимого, включая текущий
+   */
+  static size_t CalculateOperatorCount(
+      size_t operator_count, size_t desired_count, size_t scale_down_periods
+  );
+
+ private:
+  static constexpr bool kDefaultEnabled_ = false;
+  static constexpr size_t kDefaultMinCount_ = 1;
+  static constexpr size_t kDefaultMaxCount_ = 100;
+  static constexpr uint64_t kDefaultPeriod_ = 10;
+  static constexpr uint64_t kDefaultTargetAnswerTime_ = 20;
+  static constexpr double kDefaultTargetServiceLevel_ = 0.8;
+  static constexpr double kDefaultMaxLoss_ = 0.01;
+
+  std::atomic_flag started_ = false;
+  const std::shared_ptr<core::qs::metrics::QueueingSystemMetrics> metrics_;
+  const std::shared_ptr<core::tasks::TaskManager> task_manager_;
+  const std::shared_ptr<config::Configuration> configuration_;
+  const std::unique_ptr<log::Logger> logger_;
+  /// Установленное количество операторов, 0 - если регулирование выключено.
+  std::atomic<size_t> operator_count_ = 0;
+  /// Количество периодов подряд, в которых текущее количество заметно больше необходимого.
+  size_t scale_down_periods_ = 0;
+  /// Время ожидания на момент предыдущего регулирования.
+  core::qs::metrics::HdrHistogram::Snapshot prev_wait_time_histogram_;
+  /// Среднее время обслуживания, измеренное последним.
+  Duration service_time_{0};
+
+  OperatorAutoscaler(
+      std::shared_ptr<core::qs::metrics::QueueingSystemMetrics> metrics,
+      std::shared_ptr<core::tasks::TaskManager> task_manager,
+      std::shared_ptr<config::Configuration> configuration,
+      const log::LoggerProvider &logger_provider
+  );
+
+  /**
+   * @brief Запланировать очередное регулирование.
+   */
+  void ScheduleUpdate();
+  /**
+   * @brief Выполнить регулирование по измерениям за прошедший период.
+   */
+  void Update(std::chrono::seconds period);
+  /**
+   * @brief Измерения за прошедший период.
+   */
+  Measurements Measure(std::chrono::seconds period);
+  /**
+   * @brief Прочитать параметры регулирования из конфигурации.
+   */
+  [[nodiscard]] Settings ReadSettings() const;
+};
+
+}  // namespace call_center
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_OPERATOR_AUTOSCALER_H_
@@ -12,14 +12,15 @@ OperatorSet::OperatorSet(
     std::shared_ptr<config::Configuration> configuration,
     OperatorProvider operator_provider,
     const log::LoggerProvider &logger_provider,
-    std::shared_ptr<QueueingSystemMetrics> metrics
+    std::shared_ptr<QueueingSystemMetrics> metrics,
+    std::shared_ptr<const OperatorAutoscaler> autoscaler
 )
     : configuration_(std::move(configuration)),
       logger_(logger_provider.Get("OperatorSet")),
       operator_provider_(std::move(operator_provider)),
-      metrics_(std::move(metrics)) {
+      metrics_(std::move(metrics)),
+      autoscaler_(std::move(autoscaler)) {
   AddOperators(ReadOperatorCount());
-  metrics_->SetServers(operators_);
 }
 
 std::shared_ptr<Operator> OperatorSet::EraseFree() {
@@ -35,6 +36,20 @@ std::shared_ptr<Operator> OperatorSet::EraseFree() {
   return erased;
 }
 
+std::vector<OperatorSet::OperatorPtr> OperatorSet::EraseFree(const size_t count) {
+  std::vector<OperatorPtr> erased;
+  std::lock_guard lock(mutex_);
+
+  UpdateOperatorCount();
+  erased.reserve(std::min(count, free_operators_.size()));
+  while (erased.size() < count && !free_operators_.empty()) {
+    erased.push_back(*free_operators_.begin());
+    free_operators_.erase(free_operators_.begin());
+  }
+  logger_->Debug() << "Take " << erased.size() << " free operators";
+  return erased;
+}
+
 void OperatorSet::InsertFree(const std::shared_ptr<Operator> &op) {
   std::lock_guard lock(mutex_);
   if (!operators_.contains(op)) {
@@ -47,12 +62,16 @@ void OperatorSet::InsertFree(const std::shared_ptr<Operator> &op) {
 }
 
 size_t OperatorSet::ReadOperatorCount(const size_t default_value) const {
+  if (autoscaler_) {
+    if (const auto operator_count = autoscaler_->GetOperatorCount()) {
+      return *operator_count;
+    }
+  }
   return configuration_->GetNumber<size_t>(kOperatorCountKey, default_value, 1);
 }
 
 size_t OperatorSet::GetSize() const {
-  std::shared_lock lock(mutex_);
-  return operators_.size();
+  return operator_count_.load(std::memory_order_relaxed);
 }
 
 size_t OperatorSet::GetFreeOperatorCount() const {
@@ -76,7 +95,6 @@ void OperatorSet::UpdateOperatorCount() {
       const auto to_remove = cur_count - new_count;
       RemoveOperators(to_remove);
     }
-    metrics_->SetServers(free_operators_);
   }
 }
 
@@ -85,7 +103,9 @@ void OperatorSet::AddOperators(const size_t count) {
     const auto op = operator_provider_();
     operators_.emplace(op);
     free_operators_.emplace(op);
+    metrics_->AddServer(op);
   }
+  operator_count_.store(operators_.size(), std::memory_order_relaxed);
 }
 
 void OperatorSet::RemoveOperators(const size_t count) {
@@ -96,7 +116,9 @@ void OperatorSet::RemoveOperators(const size_t count) {
     const auto erased = *free_operators_.begin();
     operators_.erase(erased);
     free_operators_.erase(erased);
+    metrics_->RemoveServer(erased);
   }
+  operator_count_.store(operators_.size(), std::memory_order_relaxed);
 }
 
 bool OperatorSet::OperatorEquals::operator()(const OperatorPtr &first, const OperatorPtr &second)
@@ -3,13 +3,17 @@
 
 #include <boost/functional/hash.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <atomic>
 #include <unordered_set>
+#include <vector>
 
 #include "configuration/configuration.h"
 #include "core/containers/concurrent_hash_set.h"
+#include "core/instrumentation/instrumented_mutex.h"
 #include "core/queueing_system/metrics/queueing_system_metrics.h"
 #include "core/utils/uuids.h"
 #include "operator.h"
+#include "operator_autoscaler.h"
 
 namespace call_center {
 
@@ -24,11 +28,16 @@ class OperatorSet {
   /// Ключ в конфигурации, соответствующий значению количества обслуживающих операторов.
   static constexpr auto kOperatorCountKey = "operator_count";
 
+  /**
+   * @param autoscaler регулятор, количество операторов которого используется вместо значения из
+   * конфигурации, пока регулирование включено (может быть nullptr)
+   */
   OperatorSet(
       std::shared_ptr<config::Configuration> configuration,
       OperatorProvider operator_provider,
       const log::LoggerProvider &logger_provider,
-      std::shared_ptr<core::qs::metrics::QueueingSystemMetrics> metrics
+      std::shared_ptr<core::qs::metrics::QueueingSystemMetrics> metrics,
+      std::shared_ptr<const OperatorAutoscaler> autoscaler = nullptr
   );
   OperatorSet(const OperatorSet &other) = delete;
   OperatorSet &operator=(const OperatorSet &other) = delete;
@@ -38,12 +47,18 @@ class OperatorSet {
    * @return std::nullopt - если свободных операторов нет.
    */
   std::shared_ptr<Operator> EraseFree();
+  /**
+   * @brief Получить под одной блокировкой до count свободных операторов.
+   */
+  std::vector<OperatorPtr> EraseFree(size_t count);
   /**
    * @brief Вернуть освободившегося оператора в множество.
    */
   void InsertFree(const OperatorPtr &op);
   /**
    * @brief Общее количество операторов (свободных и занятых).
+   *
+   * Не захватывает блокировку: количество обновляется при добавлении и удалении операторов.
    */
   [[nodiscard]] size_t GetSize() const;
   /**
@@ -68,14 +83,17 @@ class OperatorSet {
 
   std::unordered_set<OperatorPtr, OperatorHash, OperatorEquals> free_operators_;
   std::unordered_set<OperatorPtr, OperatorHash, OperatorEquals> operators_;
+  /// Размер operators_, доступный без блокировки.
+  std::atomic_size_t operator_count_ = 0;
   const std::shared_ptr<config::Configuration> configuration_;
-  mutable std::shared_mutex mutex_;
+  mutable core::instrumentation::SharedMutex mutex_{"OperatorSet"};
   std::unique_ptr<log::Logger> logger_;
   OperatorProvider operator_provider_;
   std::shared_ptr<core::qs::metrics::QueueingSystemMetrics> metrics_;
+  std::shared_ptr<const OperatorAutoscaler> autoscaler_;
 
   /**
-   * @brief Прочитать значение количества операторов в множестве из конфигурации.
+   * @brief Прочитать значение количества операторов в множестве из регулятора или конфигурации.
    */
   [[nodiscard]] size_t ReadOperatorCount(size_t default_value = kDefaultOperatorCount_) const;
   /**
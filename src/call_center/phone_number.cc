@@ -0,0 +1,13 @@
+#include "phone_number.h"
+
+namespace call_center {
+
+std::string PhoneNumber::ToString() const {
+  return std::string(Format().View());
+}
+
+std::ostream &operator<<(std::ostream &out, const PhoneNumber &phone_number) {
+  return out << phone_number.Format().View();
+}
+
+}  // namespace call_center
@@ -0,0 +1,146 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_PHONE_NUMBER_H_
+#define CALL_CENTER_SRC_CALL_CENTER_PHONE_NUMBER_H_
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "core/utils/hash.h"
+
+namespace call_center {
+
+/**
+ * @brief Номер телефона в формате E.164: до 15 цифр, первая из которых не ноль.
+ *
+ * Цифры хранятся одним целым числом (8 байт), поэтому сравнение, хеширование и копирование номера
+ * не требуют строк в куче. Номер нормализуется при разборе: допускаются начальный '+' и
+ * разделители ' ', '-', '.', '(' и ')', которые отбрасываются.
+ */
+class PhoneNumber {
+ public:
+  /// Максимальное количество цифр номера по E.164.
+  static constexpr size_t kMaxDigitCount = 15;
+  /// Максимальная длина текстового представления: '+' и цифры.
+  static constexpr size_t kMaxFormattedSize = kMaxDigitCount + 1;
+
+  /**
+   * @brief Текстовое представление номера в фиксированном буфере: '+' и цифры.
+   */
+  struct Formatted {
+    std::array<char, kMaxFormattedSize> chars{};
+    size_t size = 0;
+
+    [[nodiscard]] constexpr std::string_view View() const {
+      return {chars.data(), size};
+    }
+  };
+
+  /**
+   * @param digits цифры номера в виде числа
+   * @throws std::invalid_argument - если номер пустой (0) или длиннее @link kMaxDigitCount @endlink
+   * цифр
+   */
+  constexpr explicit PhoneNumber(uint64_t digits);
+
+  /**
+   * @brief Разобрать и нормализовать номер.
+   * @return std::nullopt - если строка не является номером в формате E.164
+   */
+  static constexpr std::optional<PhoneNumber> Parse(std::string_view str);
+
+  /**
+   * @brief Цифры номера в виде числа.
+   */
+  [[nodiscard]] constexpr uint64_t GetDigits() const {
+    return digits_;
+  }
+  [[nodiscard]] constexpr size_t GetDigitCount() const;
+  /**
+   * @brief Текстовое представление номера без выделения памяти.
+   */
+  [[nodiscard]] constexpr Formatted Format() const;
+  [[nodiscard]] std::string ToString() const;
+
+  constexpr auto operator<=>(const PhoneNumber &other) const = default;
+
+ private:
+  static constexpr uint64_t kMaxDigits = 999'999'999'999'999;
+
+  uint64_t digits_;
+};
+
+/**
+ * @brief Вывод текстового представления номера в поток std::ostream.
+ */
+std::ostream &operator<<(std::ostream &out, const PhoneNumber &phone_number);
+
+constexpr PhoneNumber::PhoneNumber(const uint64_t digits) : digits_(digits) {
+  if (digits == 0 || digits > kMaxDigits) {
+    throw std::invalid_argument("Phone number must contain 1 to 15 digits");
+  }
+}
+
+constexpr std::optional<PhoneNumber> PhoneNumber::Parse(std::string_view str) {
+  if (str.starts_with('+')) {
+    str.remove_prefix(1);
+  }
+  uint64_t digits = 0;
+  size_t digit_count = 0;
+  for (const auto ch : str) {
+    if (ch >= '0' && ch <= '9') {
+      if (digit_count == 0 && ch == '0') {
+        return std::nullopt;
+      }
+      if (++digit_count > kMaxDigitCount) {
+        return std::nullopt;
+      }
+      digits = digits * 10 + static_cast<uint64_t>(ch - '0');
+    } else if (ch != ' ' && ch != '-' && ch != '.' && ch != '(' && ch != ')') {
+      return std::nullopt;
+    }
+  }
+  if (digit_count == 0) {
+    return std::nullopt;
+  }
+  return PhoneNumber(digits);
+}
+
+constexpr size_t PhoneNumber::GetDigitCount() const {
+  size_t count = 0;
+  for (auto digits = digits_; digits > 0; digits /= 10) {
+    ++count;
+  }
+  return count;
+}
+
+constexpr PhoneNumber::Formatted PhoneNumber::Format() const {
+  Formatted result;
+  result.size = GetDigitCount() + 1;
+  result.chars[0] = '+';
+  auto digits = digits_;
+  for (size_t i = result.size - 1; i > 0; --i) {
+    result.chars[i] = static_cast<char>('0' + digits % 10);
+    digits /= 10;
+  }
+  return result;
+}
+
+}  // namespace call_center
+
+/**
+ * @brief Хеш номера телефона: перемешивание битов числа (финализатор SplitMix64).
+ */
+template <>
+struct std::hash<call_center::PhoneNumber> {
+  constexpr size_t operator()(const call_center::PhoneNumber &phone_number) const noexcept {
+    return call_center::core::utils::hash::Mix64(phone_number.GetDigits());
+  }
+};
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_PHONE_NUMBER_H_
@@ -0,0 +1,24 @@
+#include "call_batch_request_dto.h"
+
+#include <stdexcept>
+
+namespace call_center::repository {
+
+CallBatchRequestDto tag_invoke(
+    const json::value_to_tag<CallBatchRequestDto> &, const json::value &json
+) {
+  const json::array &json_phones = json.as_object().at("phones").as_array();
+
+  CallBatchRequestDto dto;
+  dto.phones.reserve(json_phones.size());
+  for (const auto &json_phone : json_phones) {
+    const auto phone = PhoneNumber::Parse(json_phone.as_string());
+    if (!phone) {
+      throw std::invalid_argument("Invalid phone number");
+    }
+    dto.phones.push_back(*phone);
+  }
+  return dto;
+}
+
+}  // namespace call_center::repository
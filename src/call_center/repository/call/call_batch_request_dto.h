@@ -0,0 +1,27 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_BATCH_REQUEST_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_BATCH_REQUEST_DTO_H_
+
+#include <boost/json.hpp>
+#include <vector>
+
+#include "phone_number.h"
+
+namespace call_center::repository {
+namespace json = boost::json;
+
+struct CallBatchRequestDto {
+  /// Нормализованные номера инициаторов вызовов в порядке запроса.
+  std::vector<PhoneNumber> phones;
+
+  /**
+   * @brief Преобразование из json в объект.
+   * @throws std::invalid_argument - если хотя бы один номер не соответствует формату E.164
+   */
+  friend CallBatchRequestDto tag_invoke(
+      const json::value_to_tag<CallBatchRequestDto> &, const json::value &json
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_BATCH_REQUEST_DTO_H_
@@ -0,0 +1,24 @@
+#include "call_batch_response_dto.h"
+
+namespace call_center::repository {
+
+void tag_invoke(
+    const json::value_from_tag &, json::value &json, const CallBatchResponseDto &response
+) {
+  json::array json_results;
+  json_results.reserve(response.results.size());
+  for (const auto &result : response.results) {
+    json_results.push_back({{"phone", result.phone}, {"call_status", result.call_status}});
+  }
+  json = {{"results", std::move(json_results)}};
+}
+
+CallBatchResponseDto::Result::Result(const PhoneNumber phone, const CallStatus status)
+    : Result(phone, to_string(status)) {
+}
+
+CallBatchResponseDto::Result::Result(const PhoneNumber phone, std::string call_status)
+    : phone(phone.ToString()), call_status(std::move(call_status)) {
+}
+
+}  // namespace call_center::repository
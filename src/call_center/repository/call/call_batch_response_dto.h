@@ -0,0 +1,43 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_BATCH_RESPONSE_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_BATCH_RESPONSE_DTO_H_
+
+#include <boost/json.hpp>
+#include <string>
+#include <vector>
+
+#include "call_status.h"
+#include "phone_number.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+struct CallBatchResponseDto {
+  /// Статус вызова, отклоненного из-за превышения интенсивности вызовов с префикса номера.
+  static constexpr auto kRateLimitedStatus = "rate limited";
+
+  /**
+   * @brief Результат обработки одного вызова пакета.
+   */
+  struct Result {
+    std::string phone;
+    std::string call_status;
+
+    Result(PhoneNumber phone, CallStatus status);
+    Result(PhoneNumber phone, std::string call_status);
+  };
+
+  /// Результаты в порядке номеров в запросе.
+  std::vector<Result> results;
+
+  /**
+   * @brief Преоразование из объекта в json.
+   */
+  friend void tag_invoke(
+      const json::value_from_tag &, json::value &json, const CallBatchResponseDto &response
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_BATCH_RESPONSE_DTO_H_
@@ -1,10 +1,16 @@
 #include "call_repository.h"
 
+#include <boost/asio/use_awaitable.hpp>
 #include <boost/json.hpp>
+#include <boost/uuid/uuid_io.hpp>
 #include <chrono>
+#include <stdexcept>
 
+#include "call_batch_response_dto.h"
 #include "call_request_dto.h"
 #include "call_response_dto.h"
+#include "call_result_dto.h"
+#include "core/utils/uuids.h"
 
 using namespace std::chrono_literals;
 namespace json = boost::json;
@@ -13,50 +19,218 @@ namespace call_center::repository {
 
 std::shared_ptr<CallRepository> CallRepository::Create(
     std::shared_ptr<CallCenter> call_center,
+    std::shared_ptr<core::tasks::TaskManager> task_manager,
     std::shared_ptr<config::Configuration> configuration,
     const log::LoggerProvider &logger_provider
 ) {
-  return std::shared_ptr<CallRepository>(
-      new CallRepository(std::move(call_center), std::move(configuration), logger_provider)
-  );
+  return std::shared_ptr<CallRepository>(new CallRepository(
+      std::move(call_center), std::move(task_manager), std::move(configuration), logger_provider
+  ));
 }
 
 CallRepository::CallRepository(
     std::shared_ptr<CallCenter> call_center,
+    std::shared_ptr<core::tasks::TaskManager> task_manager,
     std::shared_ptr<config::Configuration> configuration,
     const log::LoggerProvider &logger_provider
 )
     : HttpRepository("call"),
       logger_(logger_provider.Get("CallRepository")),
       call_center_(std::move(call_center)),
-      configuration_(std::move(configuration)) {
+      configuration_(std::move(configuration)),
+      rate_limiter_(configuration_, logger_provider),
+      results_(configuration_),
+      webhook_(CallWebhook::Create(std::move(task_manager), configuration_, logger_provider)),
+      rate_limited_response_(std::make_shared<const Response>(
+          MakeResponse(b_http::status::too_many_requests, false, {})
+      )),
+      overload_response_(std::make_shared<const Response>(MakeResponse(
+          b_http::status::service_unavailable,
+          false,
+          serialize(json::value_from(CallResponseDto(CallStatus::kOverload)))
+      ))) {
 }
 
-void CallRepository::HandleRequest(
-    const b_http::request<b_http::string_body> &request, const OnHandle &on_handle
+std::shared_ptr<const CallRepository::Response> CallRepository::AdmitRequest(
+    const RequestHeader &header, const net::ip::address &client
+) {
+  if (header.method() != b_http::verb::post) {
+    return nullptr;
+  }
+  if (!rate_limiter_.AdmitClient(client)) {
+    return rate_limited_response_;
+  }
+  if (call_center_->IsOverloaded()) {
+    return overload_response_;
+  }
+  return nullptr;
+}
+
+net::awaitable<CallRepository::Response> CallRepository::HandleRequestAsync(
+    const Request &request, const net::ip::address &client
+) {
+  const auto sub_path = GetSubPath(request.target());
+  if (sub_path == "batch") {
+    co_return co_await HandleBatchRequestAsync(request, client);
+  }
+  if (!sub_path.empty()) {
+    co_return HandleResultRequest(request, sub_path);
+  }
+  if (GetQueryParameter(request.target(), "async") == "1") {
+    co_return HandleAsyncRequest(request);
+  }
+  auto dto = ParseRequest(request);
+  if (auto *response = std::get_if<Response>(&dto)) {
+    co_return std::move(*response);
+  }
+  const auto cdr =
+      co_await call_center_->Process(std::get<CallRequestDto>(dto).phone, net::use_awaitable);
+  co_return MakeResponse(b_http::status::ok, false, MakeResponseBody(*cdr));
+}
+
+net::awaitable<CallRepository::Response> CallRepository::HandleBatchRequestAsync(
+    const Request &request, const net::ip::address &client
+) {
+  auto batch = ParseBatchRequest(request, client);
+  if (auto *response = std::get_if<Response>(&batch)) {
+    co_return std::move(*response);
+  }
+  const auto &parsed_batch = std::get<Batch>(batch);
+  const auto cdrs =
+      co_await call_center_->ProcessBatch(parsed_batch.admitted_phones, net::use_awaitable);
+  co_return MakeResponse(b_http::status::ok, false, MakeBatchResponseBody(parsed_batch, cdrs));
+}
+
+CallRepository::Response CallRepository::HandleAsyncRequest(const Request &request) {
+  auto dto = ParseRequest(request);
+  if (auto *response = std::get_if<Response>(&dto)) {
+    return std::move(*response);
+  }
+  const auto phone = std::get<CallRequestDto>(dto).phone;
+  const auto id = call_center_->Submit(
+      phone, [repo = shared_from_this()](const CallDetailedRecord &cdr) {
+        repo->OnAsyncCallFinished(cdr);
+      }
+  );
+  results_.AddPending(id, phone);
+  // вызов мог быть отклонен до добавления в кэш
+  const auto result = results_.Find(id).value_or(CallResultCache::Result{.phone = phone});
+  return MakeResponse(
+      b_http::status::accepted, false, serialize(json::value_from(CallResultDto(id, result)))
+  );
+}
+
+CallRepository::Response CallRepository::HandleResultRequest(
+    const Request &request, const std::string_view id
+) {
+  if (auto response = CheckMethod(request, b_http::verb::get)) {
+    return std::move(*response);
+  }
+  const auto call_id = core::utils::uuids::Parse(id);
+  if (!call_id) {
+    logger_->Info() << "Invalid call id: " << id;
+    return MakeResponse(b_http::status::bad_request, false, {});
+  }
+  const auto result = results_.Find(*call_id);
+  if (!result) {
+    logger_->Info() << "Unknown call id: " << id;
+    return MakeResponse(b_http::status::not_found, false, {});
+  }
+  return MakeResponse(
+      b_http::status::ok, false, serialize(json::value_from(CallResultDto(*call_id, *result)))
+  );
+}
+
+void CallRepository::OnAsyncCallFinished(const CallDetailedRecord &cdr) {
+  assert(cdr.WasFinished());
+  const CallResultCache::Result result{
+      .phone = cdr.GetCallerPhoneNumber(), .status = cdr.GetStatus()
+  };
+  results_.Complete(cdr.GetId(), result.phone, *result.status);
+  webhook_->Notify(CallResultDto(cdr.GetId(), result));
+}
+
+std::optional<CallRepository::Response> CallRepository::CheckMethod(
+    const Request &request, const b_http::verb method
 ) {
   logger_->Info() << "Start handle request: " << to_string(request.method()) << " "
                   << request.target();
-  if (request.method() != b_http::verb::post) {
+  if (request.method() != method) {
     logger_->Info() << "Cannot handle request with illegal method (" << to_string(request.method())
                     << ")";
-    on_handle(MakeResponse(b_http::status::method_not_allowed, false, {}));
-    return;
+    return MakeResponse(b_http::status::method_not_allowed, false, {});
+  }
+  return std::nullopt;
+}
+
+std::variant<CallRequestDto, CallRepository::Response> CallRepository::ParseRequest(
+    const Request &request
+) {
+  if (auto response = CheckMethod(request, b_http::verb::post)) {
+    return std::move(*response);
   }
 
   auto dto = ParseRequestBody(request.body());
   if (!dto) {
-    on_handle(MakeResponse(b_http::status::bad_request, false, {}));
-    return;
+    return MakeResponse(b_http::status::bad_request, false, {});
+  }
+  if (!rate_limiter_.AdmitCaller(dto->phone)) {
+    return *rate_limited_response_;
+  }
+  return std::move(*dto);
+}
+
+std::variant<CallRepository::Batch, CallRepository::Response> CallRepository::ParseBatchRequest(
+    const Request &request, const net::ip::address &client
+) {
+  if (auto response = CheckMethod(request, b_http::verb::post)) {
+    return std::move(*response);
+  }
+
+  auto dto = ParseBatchRequestBody(request.body());
+  if (!dto) {
+    return MakeResponse(b_http::status::bad_request, false, {});
+  }
+  const auto max_size =
+      configuration_->GetNumber<size_t>(kBatchMaxSizeKey, kDefaultBatchMaxSize_, 1);
+  if (dto->phones.size() > max_size) {
+    logger_->Info() << "Batch size " << dto->phones.size() << " exceeds limit " << max_size;
+    return MakeResponse(b_http::status::payload_too_large, false, {});
+  }
+
+  // маркер за первый вызов взят при допуске запроса
+  size_t client_admitted_count = 0;
+  if (!dto->phones.empty()) {
+    client_admitted_count = 1 + rate_limiter_.AdmitClient(client, dto->phones.size() - 1);
+  }
+  Batch batch;
+  batch.admitted.reserve(dto->phones.size());
+  batch.admitted_phones.reserve(client_admitted_count);
+  for (size_t i = 0; i < dto->phones.size(); ++i) {
+    const auto phone = dto->phones[i];
+    const bool admitted = i < client_admitted_count && rate_limiter_.AdmitCaller(phone);
+    batch.admitted.push_back(admitted);
+    if (admitted) {
+      batch.admitted_phones.push_back(phone);
+    }
+  }
+  batch.phones = std::move(dto->phones);
+  return batch;
+}
+
+std::optional<CallBatchRequestDto> CallRepository::ParseBatchRequestBody(
+    const std::string_view &body
+) const {
+  try {
+    const auto json_body = json::parse(body);
+    return json::value_to<CallBatchRequestDto>(json_body);
+  } catch ([[maybe_unused]] const json::system_error &error) {
+    logger_->Info() << "Invalid batch request body: " << body;
+    return std::nullopt;
+  } catch ([[maybe_unused]] const std::invalid_argument &error) {
+    logger_->Info() << "Invalid phone number in batch request body: " << body;
+    return std::nullopt;
   }
-  auto on_call_processing_finish = [repo = shared_from_this(), on_handle](const auto &call) {
-    auto response = repo->MakeResponse(b_http::status::ok, false, MakeResponseBody(call));
-    on_handle(std::move(response));
-  };
-  const auto call = std::make_shared<CallDetailedRecord>(
-      dto->phone, configuration_, std::move(on_call_processing_finish)
-  );
-  call_center_->PushCall(call);
 }
 
 std::optional<CallRequestDto> CallRepository::ParseRequestBody(const std::string_view &body) const {
@@ -66,6 +240,9 @@ std::optional<CallRequestDto> CallRepository::ParseRequestBody(const std::string
   } catch ([[maybe_unused]] const json::system_error &error) {
     logger_->Info() << "Invalid request body: " << body;
     return std::nullopt;
+  } catch ([[maybe_unused]] const std::invalid_argument &error) {
+    logger_->Info() << "Invalid phone number in request body: " << body;
+    return std::nullopt;
   }
 }
 
@@ -75,4 +252,22 @@ std::string CallRepository::MakeResponseBody(const CallDetailedRecord &cdr) {
   return serialize(json::value_from(call_response_dto));
 }
 
+std::string CallRepository::MakeBatchResponseBody(
+    const Batch &batch, const std::vector<std::shared_ptr<const CallDetailedRecord>> &cdrs
+) {
+  CallBatchResponseDto response;
+  response.results.reserve(batch.phones.size());
+  auto cdr = cdrs.begin();
+  for (size_t i = 0; i < batch.phones.size(); ++i) {
+    if (!batch.admitted[i]) {
+      response.results.emplace_back(batch.phones[i], CallBatchResponseDto::kRateLimitedStatus);
+      continue;
+    }
+    assert(cdr != cdrs.end() && (*cdr)->WasFinished());
+    response.results.emplace_back(batch.phones[i], *(*cdr)->GetStatus());
+    ++cdr;
+  }
+  return serialize(json::value_from(response));
+}
+
 }  // namespace call_center::repository
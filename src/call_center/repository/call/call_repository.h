@@ -1,25 +1,48 @@
 #ifndef CALL_CENTER_SRC_CALL_CENTER_DATA_QUERY_REPOSITORY_H_
 #define CALL_CENTER_SRC_CALL_CENTER_DATA_QUERY_REPOSITORY_H_
 
+#include <variant>
+#include <vector>
+
 #include "call_center.h"
 #include "call_detailed_record.h"
+#include "call_batch_request_dto.h"
+#include "call_rate_limiter.h"
 #include "call_request_dto.h"
+#include "call_result_cache.h"
+#include "call_webhook.h"
 #include "core/http/http.h"
 #include "core/http/http_repository.h"
+#include "core/tasks/task_manager.h"
 
 /// Реализации HTTP-репозиториев.
 namespace call_center::repository {
 
 namespace b_http = http::http;
+namespace net = http::net;
 
 /**
  * @brief Репозиторий для обработки вызовов.
+ *
+ * Запрос `POST /call` обрабатывает один вызов, `POST /call/batch` - пакет вызовов (см.
+ * @link CallCenter::ProcessBatch @endlink), ответ на который содержит статусы вызовов в порядке
+ * номеров в запросе. Каждый вызов пакета учитывается ограничением интенсивности вызовов с адреса
+ * клиента как отдельный запрос.
+ *
+ * Запрос `POST /call?async=1` не удерживает соединение до завершения обработки: вызов принимается
+ * и сразу отправляется ответ 202 с его идентификатором. Результат сохраняется в ограниченном
+ * @link CallResultCache кэше@endlink и возвращается запросом `GET /call/{id}`, а также может быть
+ * отправлен @link CallWebhook уведомлением@endlink.
  */
 class CallRepository : public http::HttpRepository,
                        public std::enable_shared_from_this<CallRepository> {
  public:
+  /// Ключ в конфигурации, соответствующий максимальному количеству вызовов в пакете.
+  static constexpr auto kBatchMaxSizeKey = "call_batch_max_size";
+
   static std::shared_ptr<CallRepository> Create(
       std::shared_ptr<CallCenter> call_center,
+      std::shared_ptr<core::tasks::TaskManager> task_manager,
       std::shared_ptr<config::Configuration> configuration,
       const log::LoggerProvider &logger_provider
   );
@@ -27,21 +50,65 @@ class CallRepository : public http::HttpRepository,
   CallRepository(const CallRepository &other) = delete;
   CallRepository &operator=(const CallRepository &other) = delete;
 
-  void HandleRequest(const b_http::request<b_http::string_body> &request, const OnHandle &on_handle)
-      override;
+  net::awaitable<Response> HandleRequestAsync(
+      const Request &request, const net::ip::address &client
+  ) override;
+  /**
+   * @brief Отклонить вызов без чтения тела запроса, если превышена
+   * @link CallRateLimiter::AdmitClient интенсивность вызовов с адреса клиента@endlink либо ЦОВ
+   * @link CallCenter::IsOverloaded перегружен@endlink.
+   *
+   * Отклоненному запросу отправляется заранее сформированный ответ без копирования: 429 при
+   * превышении интенсивности, 503 со статусом 'overload' при перегрузке. Запись о вызове при этом
+   * не создается, а ЦОВ не блокируется.
+   */
+  std::shared_ptr<const Response> AdmitRequest(
+      const RequestHeader &header, const net::ip::address &client
+  ) override;
 
  private:
+  /**
+   * @brief Пакет вызовов, прошедший проверку.
+   */
+  struct Batch {
+    /// Номера в порядке запроса.
+    std::vector<PhoneNumber> phones;
+    /// Признаки номеров, допущенных ограничениями интенсивности вызовов с адреса клиента и
+    /// @link CallRateLimiter::AdmitCaller с префикса номера@endlink.
+    std::vector<bool> admitted;
+    /// Допущенные номера, передаваемые в ЦОВ.
+    std::vector<PhoneNumber> admitted_phones;
+  };
+
+  static constexpr size_t kDefaultBatchMaxSize_ = 1000;
+
   const std::unique_ptr<log::Logger> logger_;
   const std::shared_ptr<CallCenter> call_center_;
   const std::shared_ptr<config::Configuration> configuration_;
+  CallRateLimiter rate_limiter_;
+  /// Результаты вызовов, принятых без ожидания обработки.
+  CallResultCache results_;
+  const std::shared_ptr<CallWebhook> webhook_;
+  /// Ответ на вызов, отклоненный из-за превышения интенсивности вызовов.
+  const std::shared_ptr<const Response> rate_limited_response_;
+  /// Ответ на вызов, отклоненный при допуске из-за перегрузки.
+  const std::shared_ptr<const Response> overload_response_;
 
   /**
    * @brief Сформировать ответ из обработанного вызова.
    */
   static std::string MakeResponseBody(const CallDetailedRecord &cdr);
+  /**
+   * @brief Сформировать ответ из обработанного пакета вызовов.
+   * @param cdrs записи о допущенных вызовах в порядке @link Batch::admitted_phones @endlink
+   */
+  static std::string MakeBatchResponseBody(
+      const Batch &batch, const std::vector<std::shared_ptr<const CallDetailedRecord>> &cdrs
+  );
 
   CallRepository(
       std::shared_ptr<CallCenter> call_center,
+      std::shared_ptr<core::tasks::TaskManager> task_manager,
       std::shared_ptr<config::Configuration> configuration,
       const log::LoggerProvider &logger_provider
   );
@@ -50,6 +117,48 @@ class CallRepository : public http::HttpRepository,
    * @brief Сформировать объект вызова из тела запроса.
    */
   std::optional<CallRequestDto> ParseRequestBody(const std::string_view &body) const;
+  /**
+   * @brief Проверить запрос и сформировать из него объект вызова.
+   * @return ответ с ошибкой - если запрос не может быть обработан
+   */
+  std::variant<CallRequestDto, Response> ParseRequest(const Request &request);
+  /**
+   * @brief Сформировать объект пакета вызовов из тела запроса.
+   */
+  std::optional<CallBatchRequestDto> ParseBatchRequestBody(const std::string_view &body) const;
+  /**
+   * @brief Проверить запрос пакета вызовов и сформировать из него пакет.
+   *
+   * Первый вызов пакета уже учтен при @link AdmitRequest допуске запроса@endlink, за каждый
+   * следующий из корзины адреса клиента берется еще один маркер. Вызовы, на которые маркеров не
+   * хватило, отклоняются со статусом @link CallBatchResponseDto::kRateLimitedStatus @endlink.
+   * @param client адрес клиента, отправившего запрос
+   * @return ответ с ошибкой - если запрос не может быть обработан
+   */
+  std::variant<Batch, Response> ParseBatchRequest(
+      const Request &request, const net::ip::address &client
+  );
+  net::awaitable<Response> HandleBatchRequestAsync(
+      const Request &request, const net::ip::address &client
+  );
+  /**
+   * @brief Принять вызов без ожидания его обработки.
+   * @return ответ 202 с идентификатором вызова либо ответ с ошибкой
+   */
+  Response HandleAsyncRequest(const Request &request);
+  /**
+   * @brief Результат вызова, принятого без ожидания обработки, по его идентификатору.
+   */
+  Response HandleResultRequest(const Request &request, std::string_view id);
+  /**
+   * @brief Сохранить результат вызова, принятого без ожидания обработки, и отправить уведомление.
+   */
+  void OnAsyncCallFinished(const CallDetailedRecord &cdr);
+  /**
+   * @brief Проверить метод запроса.
+   * @return ответ с ошибкой - если метод отличается от ожидаемого
+   */
+  std::optional<Response> CheckMethod(const Request &request, b_http::verb method);
 };
 
 }  // namespace call_center::repository
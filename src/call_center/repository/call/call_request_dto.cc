@@ -1,11 +1,17 @@
 #include "call_request_dto.h"
 
+#include <stdexcept>
+
 namespace call_center::repository {
 
 CallRequestDto tag_invoke(const json::value_to_tag<CallRequestDto> &, const json::value &json) {
   const json::object &json_obj = json.as_object();
 
-  return {.phone = std::string(json_obj.at("phone").as_string())};
+  const auto phone = PhoneNumber::Parse(json_obj.at("phone").as_string());
+  if (!phone) {
+    throw std::invalid_argument("Invalid phone number");
+  }
+  return {.phone = *phone};
 }
 
 }  // namespace call_center::repository
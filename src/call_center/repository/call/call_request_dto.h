@@ -2,16 +2,19 @@
 #define CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_REQUEST_DTO_H_
 
 #include <boost/json.hpp>
-#include <string>
+
+#include "phone_number.h"
 
 namespace call_center::repository {
 namespace json = boost::json;
 
 struct CallRequestDto {
-  std::string phone;
+  /// Нормализованный номер инициатора вызова.
+  PhoneNumber phone;
 
   /**
    * @brief Преобразование из json в объект.
+   * @throws std::invalid_argument - если номер не соответствует формату E.164
    */
   friend CallRequestDto tag_invoke(
       const json::value_to_tag<CallRequestDto> &, const json::value &json
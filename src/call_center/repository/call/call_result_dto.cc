@@ -0,0 +1,21 @@
+#include "call_result_dto.h"
+
+#include <boost/uuid/uuid_io.hpp>
+
+namespace call_center::repository {
+
+void tag_invoke(const json::value_from_tag &, json::value &json, const CallResultDto &call_result) {
+  json = {
+      {"id", call_result.id},
+      {"phone", call_result.phone},
+      {"call_status", call_result.call_status}
+  };
+}
+
+CallResultDto::CallResultDto(const CallResultCache::Id &id, const CallResultCache::Result &result)
+    : id(boost::uuids::to_string(id)),
+      phone(result.phone.ToString()),
+      call_status(result.status ? to_string(*result.status) : kPendingStatus) {
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,36 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_RESULT_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_RESULT_DTO_H_
+
+#include <boost/json.hpp>
+#include <string>
+
+#include "call_result_cache.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+/**
+ * @brief Результат вызова, принятого без ожидания обработки.
+ */
+struct CallResultDto {
+  /// Статус вызова, который еще обрабатывается.
+  static constexpr auto kPendingStatus = "pending";
+
+  std::string id;
+  std::string phone;
+  std::string call_status;
+
+  CallResultDto(const CallResultCache::Id &id, const CallResultCache::Result &result);
+
+  /**
+   * @brief Преоразование из объекта в json.
+   */
+  friend void tag_invoke(
+      const json::value_from_tag &, json::value &json, const CallResultDto &call_result
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_DATA_CALL_RESULT_DTO_H_
@@ -0,0 +1,110 @@
+#include "call_webhook.h"
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/beast/core.hpp>
+
+namespace call_center::repository {
+
+using namespace core::http;
+
+std::shared_ptr<CallWebhook> CallWebhook::Create(
+    std::shared_ptr<core::tasks::TaskManager> task_manager,
+    std::shared_ptr<config::Configuration> configuration,
+    const log::LoggerProvider &logger_provider
+) {
+  return std::shared_ptr<CallWebhook>(
+      new CallWebhook(std::move(task_manager), std::move(configuration), logger_provider)
+  );
+}
+
+CallWebhook::CallWebhook(
+    std::shared_ptr<core::tasks::TaskManager> task_manager,
+    std::shared_ptr<config::Configuration> configuration,
+    const log::LoggerProvider &logger_provider
+)
+    : logger_(logger_provider.Get("CallWebhook")),
+      task_manager_(std::move(task_manager)),
+      configuration_(std::move(configuration)) {
+}
+
+void CallWebhook::Notify(const CallResultDto &result) {
+  const auto port = configuration_->GetNumber<uint16_t>(kPortKey, kDefaultPort_);
+  if (port == 0) {
+    return;
+  }
+  const auto max_in_flight =
+      configuration_->GetNumber<size_t>(kMaxInFlightKey, kDefaultMaxInFlight_);
+  if (in_flight_count_.fetch_add(1, std::memory_order_relaxed) >= max_in_flight) {
+    in_flight_count_.fetch_sub(1, std::memory_order_relaxed);
+    const auto dropped_count = dropped_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+    logger_->Warning() << "Webhook notification for call " << result.id << " dropped: "
+                       << max_in_flight << " notifications are in flight, " << dropped_count
+                       << " dropped in total";
+    return;
+  }
+  // уведомитель должен существовать до завершения отправки
+  net::co_spawn(
+      task_manager_->IoContext(),
+      [self = shared_from_this(),
+       endpoint = tcp::endpoint(net::ip::address_v4::loopback(), port),
+       target = configuration_->GetProperty<std::string>(kTargetKey, kDefaultTarget_),
+       body = serialize(json::value_from(result))]() mutable {
+        return self->Send(endpoint, std::move(target), std::move(body));
+      },
+      [self = shared_from_this()](const std::exception_ptr &exception) {
+        self->in_flight_count_.fetch_sub(1, std::memory_order_relaxed);
+        if (exception) {
+          self->logger_->Warning() << "Webhook notification failed with an exception";
+        }
+      }
+  );
+}
+
+size_t CallWebhook::GetInFlightCount() const {
+  return in_flight_count_.load(std::memory_order_relaxed);
+}
+
+uint64_t CallWebhook::GetDroppedCount() const {
+  return dropped_count_.load(std::memory_order_relaxed);
+}
+
+net::awaitable<void> CallWebhook::Send(
+    const tcp::endpoint endpoint, const std::string target, const std::string body
+) {
+  beast::tcp_stream stream(co_await net::this_coro::executor);
+  stream.expires_after(kTimeout_);
+  beast::error_code ec;
+  co_await stream.async_connect(endpoint, net::redirect_error(net::use_awaitable, ec));
+  if (ec) {
+    logger_->Warning() << "Failed to connect to webhook " << endpoint << ": " << ec.message();
+    co_return;
+  }
+
+  http::request<http::string_body> request{http::verb::post, target, 11};
+  request.set(http::field::host, endpoint.address().to_string());
+  request.set(http::field::content_type, "application/json");
+  request.body() = body;
+  request.prepare_payload();
+  co_await http::async_write(stream, request, net::redirect_error(net::use_awaitable, ec));
+  if (ec) {
+    logger_->Warning() << "Failed to send webhook request: " << ec.message();
+    co_return;
+  }
+
+  beast::flat_buffer buffer;
+  http::response<http::string_body> response;
+  co_await http::async_read(stream, buffer, response, net::redirect_error(net::use_awaitable, ec));
+  if (ec) {
+    logger_->Warning() << "Failed to read webhook response: " << ec.message();
+    co_return;
+  }
+  stream.socket().shutdown(tcp::socket::shutdown_both, ec);
+  if (response.result_int() >= 300) {
+    logger_->Warning() << "Webhook responded with " << response.result();
+  }
+}
+
+}  // namespace call_center::repository
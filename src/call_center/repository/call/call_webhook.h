@@ -0,0 +1,89 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_CALL_CALL_WEBHOOK_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_CALL_CALL_WEBHOOK_H_
+
+#include <boost/asio/awaitable.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "call_result_dto.h"
+#include "configuration/configuration.h"
+#include "core/http/http.h"
+#include "core/tasks/task_manager.h"
+#include "log/logger.h"
+#include "log/logger_provider.h"
+
+namespace call_center::repository {
+
+/**
+ * @brief Уведомление о результатах вызовов, принятых без ожидания обработки.
+ *
+ * Результат отправляется запросом POST с телом @link CallResultDto @endlink на локальный адрес
+ * (127.0.0.1) и порт из конфигурации, поэтому уведомления не могут быть направлены на внешние
+ * узлы. Уведомление отправляется однократно, ошибки только журналируются. Пока порт не задан,
+ * уведомления не отправляются.
+ *
+ * Количество одновременно отправляемых уведомлений ограничено: если получатель не успевает
+ * отвечать, новые уведомления отбрасываются и подсчитываются, а не открывают новые соединения.
+ */
+class CallWebhook : public std::enable_shared_from_this<CallWebhook> {
+ public:
+  /// Ключ в конфигурации, соответствующий локальному порту получателя уведомлений.
+  static constexpr auto kPortKey = "call_webhook_port";
+  /// Ключ в конфигурации, соответствующий цели запроса уведомления.
+  static constexpr auto kTargetKey = "call_webhook_target";
+  /// Ключ в конфигурации, соответствующий наибольшему количеству отправляемых уведомлений.
+  static constexpr auto kMaxInFlightKey = "call_webhook_max_in_flight";
+
+  static std::shared_ptr<CallWebhook> Create(
+      std::shared_ptr<core::tasks::TaskManager> task_manager,
+      std::shared_ptr<config::Configuration> configuration,
+      const log::LoggerProvider &logger_provider
+  );
+
+  CallWebhook(const CallWebhook &other) = delete;
+  CallWebhook &operator=(const CallWebhook &other) = delete;
+
+  /**
+   * @brief Отправить уведомление о результате вызова, если уведомления включены.
+   *
+   * Отправка выполняется асинхронно в контексте ввода-вывода. Если уже отправляется наибольшее
+   * количество уведомлений, то уведомление отбрасывается.
+   */
+  void Notify(const CallResultDto &result);
+  /**
+   * @brief Количество отправляемых в данный момент уведомлений.
+   */
+  [[nodiscard]] size_t GetInFlightCount() const;
+  /**
+   * @brief Количество уведомлений, отброшенных из-за ограничения одновременных отправок.
+   */
+  [[nodiscard]] uint64_t GetDroppedCount() const;
+
+ private:
+  static constexpr uint16_t kDefaultPort_ = 0;
+  static constexpr auto kDefaultTarget_ = "/";
+  static constexpr size_t kDefaultMaxInFlight_ = 64;
+  static constexpr auto kTimeout_ = std::chrono::seconds(5);
+
+  const std::unique_ptr<log::Logger> logger_;
+  const std::shared_ptr<core::tasks::TaskManager> task_manager_;
+  const std::shared_ptr<config::Configuration> configuration_;
+  std::atomic<size_t> in_flight_count_ = 0;
+  std::atomic<uint64_t> dropped_count_ = 0;
+
+  CallWebhook(
+      std::shared_ptr<core::tasks::TaskManager> task_manager,
+      std::shared_ptr<config::Configuration> configuration,
+      const log::LoggerProvider &logger_provider
+  );
+
+  core::http::net::awaitable<void> Send(
+      core::http::tcp::endpoint endpoint, std::string target, std::string body
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_CALL_CALL_WEBHOOK_H_
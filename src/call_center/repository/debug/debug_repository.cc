@@ -0,0 +1,57 @@
+#include "debug_repository.h"
+
+#include "instrumentation_response_dto.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+using core::instrumentation::InstrumentationReport;
+
+std::shared_ptr<DebugRepository> DebugRepository::Create(
+    std::shared_ptr<const qs::metrics::QueueingSystemMetrics> metrics,
+    const log::LoggerProvider &logger_provider
+) {
+  return std::shared_ptr<DebugRepository>(new DebugRepository(std::move(metrics), logger_provider)
+  );
+}
+
+DebugRepository::DebugRepository(
+    std::shared_ptr<const qs::metrics::QueueingSystemMetrics> metrics,
+    const log::LoggerProvider &logger_provider
+)
+    : HttpRepository("debug"),
+      logger_(logger_provider.Get("DebugRepository")),
+      metrics_(std::move(metrics)) {
+}
+
+void DebugRepository::HandleRequest(
+    const b_http::request<b_http::string_body> &request,
+    const net::ip::address &,
+    OnHandle on_handle
+) {
+  logger_->Info() << "Start handle request: " << to_string(request.method()) << " "
+                  << request.target();
+  if (request.method() != b_http::verb::get) {
+    logger_->Info() << "Cannot handle request with illegal method (" << to_string(request.method())
+                    << ")";
+    on_handle(MakeResponse(b_http::status::method_not_allowed, false, {}));
+    return;
+  }
+
+  const auto sub_path = GetSubPath(request.target());
+  if (sub_path == "instrumentation") {
+    on_handle(MakeResponse(b_http::status::ok, false, MakeGetInstrumentationResponseBody()));
+  } else {
+    logger_->Info() << "Unknown debug path: " << sub_path;
+    on_handle(MakeResponse(b_http::status::not_found, false, {}));
+  }
+}
+
+std::string DebugRepository::MakeGetInstrumentationResponseBody() const {
+  const InstrumentationResponseDto response_dto(
+      InstrumentationReport::Collect(metrics_->GetArrivalCount())
+  );
+  return serialize(json::value_from(response_dto));
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,55 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_DEBUG_DEBUG_REPOSITORY_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_DEBUG_DEBUG_REPOSITORY_H_
+
+#include "core/http/http.h"
+#include "core/http/http_repository.h"
+#include "core/queueing_system/metrics/queueing_system_metrics.h"
+#include "log/logger_provider.h"
+
+namespace call_center::repository {
+
+namespace qs = core::qs;
+namespace b_http = core::http::http;
+using namespace core::http;
+
+/**
+ * @brief HTTP-репозиторий для отладочных запросов.
+ *
+ * Обрабатывает запросы:
+ * - /debug/instrumentation - количество выделений памяти на вызов, время ожидания и удержания
+ *   блокировок (заполняется только в сборке с CMake-опцией CALL_CENTER_INSTRUMENTATION).
+ */
+class DebugRepository : public HttpRepository, public std::enable_shared_from_this<DebugRepository> {
+ public:
+  static std::shared_ptr<DebugRepository> Create(
+      std::shared_ptr<const qs::metrics::QueueingSystemMetrics> metrics,
+      const log::LoggerProvider &logger_provider
+  );
+
+  DebugRepository(const DebugRepository &other) = delete;
+  DebugRepository &operator=(const DebugRepository &other) = delete;
+
+  void HandleRequest(
+      const b_http::request<b_http::string_body> &request,
+      const net::ip::address &client,
+      OnHandle on_handle
+  ) override;
+
+ private:
+  const std::unique_ptr<log::Logger> logger_;
+  const std::shared_ptr<const qs::metrics::QueueingSystemMetrics> metrics_;
+
+  /**
+   * @brief Сформировать тело ответа на запрос о выделениях памяти и ожидании блокировок.
+   */
+  std::string MakeGetInstrumentationResponseBody() const;
+
+  DebugRepository(
+      std::shared_ptr<const qs::metrics::QueueingSystemMetrics> metrics,
+      const log::LoggerProvider &logger_provider
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_DEBUG_DEBUG_REPOSITORY_H_
@@ -0,0 +1,49 @@
+#include "instrumentation_response_dto.h"
+
+#include "core/utils/numbers.h"
+
+namespace call_center::repository {
+
+using namespace std::chrono;
+using namespace core::utils::numbers;
+using core::instrumentation::InstrumentationReport;
+
+void tag_invoke(
+    const json::value_from_tag &, json::value &json, const InstrumentationResponseDto &dto
+) {
+  const auto &report = dto.report;
+  const auto to_us = [](const auto value) {
+    return round(duration<double, std::micro>(value).count(), 1e-3);
+  };
+
+  json::array locks;
+  locks.reserve(report.locks.size());
+  for (const auto &lock : report.locks) {
+    locks.push_back(json::object{
+        {"name", lock.name},
+        {"acquire_count", lock.acquire_count},
+        {"contended_count", lock.contended_count},
+        {"wait_time", to_us(lock.wait_time)},
+        {"max_wait_time", to_us(lock.max_wait_time)},
+        {"hold_time", to_us(lock.hold_time)},
+        {"max_hold_time", to_us(lock.max_hold_time)}});
+  }
+
+  json = json::object{
+      {"enabled", report.enabled},
+      {"call_count", report.call_count},
+      {"allocations",
+       json::object{
+           {"count", report.allocations.allocation_count},
+           {"live_count", report.allocations.GetLiveCount()},
+           {"bytes", report.allocations.allocated_bytes},
+           {"count_per_call", round(report.GetAllocationsPerCall(), 1e-3)},
+           {"bytes_per_call", round(report.GetAllocatedBytesPerCall(), 1e-3)}}},
+      {"locks", std::move(locks)}};
+}
+
+InstrumentationResponseDto::InstrumentationResponseDto(InstrumentationReport report)
+    : report(std::move(report)) {
+}
+
+}  // namespace call_center::repository
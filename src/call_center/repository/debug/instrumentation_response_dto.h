@@ -0,0 +1,32 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_DEBUG_INSTRUMENTATION_RESPONSE_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_DEBUG_INSTRUMENTATION_RESPONSE_DTO_H_
+
+#include <boost/json.hpp>
+
+#include "core/instrumentation/instrumentation_report.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+/**
+ * @brief Ответ на запрос о выделениях памяти и ожидании блокировок.
+ *
+ * Время ожидания и удержания блокировок задается в микросекундах.
+ */
+struct InstrumentationResponseDto {
+  core::instrumentation::InstrumentationReport report;
+
+  explicit InstrumentationResponseDto(core::instrumentation::InstrumentationReport report);
+
+  /**
+   * @brief Преобразование из объекта в json.
+   */
+  friend void tag_invoke(
+      const json::value_from_tag &, json::value &json, const InstrumentationResponseDto &dto
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_DEBUG_INSTRUMENTATION_RESPONSE_DTO_H_
@@ -0,0 +1,118 @@
+#include "events_repository.h"
+
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <charconv>
+
+#include "events_response_dto.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+std::shared_ptr<EventsRepository> EventsRepository::Create(
+    std::shared_ptr<const CallCenter> call_center, const log::LoggerProvider &logger_provider
+) {
+  return std::shared_ptr<EventsRepository>(
+      new EventsRepository(std::move(call_center), logger_provider)
+  );
+}
+
+EventsRepository::EventsRepository(
+    std::shared_ptr<const CallCenter> call_center, const log::LoggerProvider &logger_provider
+)
+    : HttpRepository("events"),
+      logger_(logger_provider.Get("EventsRepository")),
+      call_center_(std::move(call_center)) {
+}
+
+net::awaitable<EventsRepository::Response> EventsRepository::HandleRequestAsync(
+    const Request &request, const net::ip::address &
+) {
+  auto query = ParseQuery(request);
+  if (auto *response = std::get_if<Response>(&query)) {
+    co_return std::move(*response);
+  }
+  const auto &[requested_cursor, wait] = std::get<Query>(query);
+  const auto &events = call_center_->GetEvents();
+  const auto cursor = std::min(requested_cursor.value_or(events.GetHead()), events.GetHead());
+
+  net::steady_timer timer(co_await net::this_coro::executor);
+  const auto deadline = std::chrono::steady_clock::now() + wait;
+  std::chrono::milliseconds poll_interval = kMinPollInterval_;
+  while (events.GetHead() == cursor) {
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+      break;
+    }
+    timer.expires_after(
+        std::min<std::chrono::steady_clock::duration>(poll_interval, deadline - now)
+    );
+    poll_interval = std::min(poll_interval * 2, kMaxPollInterval_);
+    boost::system::error_code ec;
+    co_await timer.async_wait(net::redirect_error(net::use_awaitable, ec));
+    if (ec) {
+      break;
+    }
+  }
+  co_return MakeEventsResponse(cursor);
+}
+
+std::variant<EventsRepository::Query, EventsRepository::Response> EventsRepository::ParseQuery(
+    const Request &request
+) {
+  logger_->Info() << "Start handle request: " << to_string(request.method()) << " "
+                  << request.target();
+  if (request.method() != b_http::verb::get) {
+    logger_->Info() << "Cannot handle request with illegal method (" << to_string(request.method())
+                    << ")";
+    return MakeResponse(b_http::status::method_not_allowed, false, {});
+  }
+  if (!GetSubPath(request.target()).empty()) {
+    logger_->Info() << "Unknown events path: " << GetSubPath(request.target());
+    return MakeResponse(b_http::status::not_found, false, {});
+  }
+
+  Query query{.cursor = std::nullopt, .wait = kDefaultWait_};
+  if (const auto cursor = GetQueryParameter(request.target(), "cursor")) {
+    query.cursor = ParseNumber(*cursor);
+    if (!query.cursor) {
+      logger_->Info() << "Invalid events cursor: " << *cursor;
+      return MakeResponse(b_http::status::bad_request, false, {});
+    }
+  }
+  if (const auto wait = GetQueryParameter(request.target(), "wait")) {
+    const auto seconds = ParseNumber(*wait);
+    if (!seconds) {
+      logger_->Info() << "Invalid events wait: " << *wait;
+      return MakeResponse(b_http::status::bad_request, false, {});
+    }
+    query.wait = std::chrono::seconds(
+        std::min<uint64_t>(*seconds, static_cast<uint64_t>(kMaxWait_.count()))
+    );
+  }
+  return query;
+}
+
+std::optional<uint64_t> EventsRepository::ParseNumber(const std::string_view str) {
+  uint64_t number = 0;
+  const auto result = std::from_chars(str.data(), str.data() + str.size(), number);
+  if (result.ec != std::errc() || result.ptr != str.data() + str.size()) {
+    return std::nullopt;
+  }
+  return number;
+}
+
+EventsRepository::Response EventsRepository::MakeEventsResponse(const Sequence cursor) {
+  const auto result = call_center_->GetEvents().Read(cursor, kMaxEventsPerResponse_);
+  if (result.dropped > 0) {
+    logger_->Info() << "Subscriber lagged behind, dropped events: " << result.dropped;
+  }
+  return MakeResponse(
+      b_http::status::ok, false, serialize(json::value_from(EventsResponseDto(result)))
+  );
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,88 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_EVENTS_EVENTS_REPOSITORY_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_EVENTS_EVENTS_REPOSITORY_H_
+
+#include <chrono>
+#include <optional>
+#include <variant>
+
+#include "call_center.h"
+#include "core/http/http.h"
+#include "core/http/http_repository.h"
+#include "log/logger_provider.h"
+
+namespace call_center::repository {
+
+namespace b_http = core::http::http;
+using namespace core::http;
+
+/**
+ * @brief HTTP-репозиторий событий обработки вызовов (long polling).
+ *
+ * Обрабатывает запрос /events?cursor=N&wait=S: возвращает события начиная с курсора N, а если их
+ * нет - ждет новых событий до S секунд (без параметра wait ответ отправляется сразу). Курсор для
+ * следующего запроса содержится в ответе, без курсора возвращаются только события, поступившие
+ * после запроса. Каждый подписчик хранит свой курсор сам, поэтому ЦОВ не знает о подписчиках:
+ * медленный подписчик не задерживает обработку вызовов, а лишь пропускает перезаписанные события и
+ * получает их количество.
+ *
+ * Ожидание выполняется периодической проверкой номера последнего события, чтобы запись события
+ * не обращалась к подписчикам. Интервал проверки удваивается, пока событий нет, поэтому
+ * ожидающий подписчик почти не создает нагрузки, а задержка доставки события не превышает
+ * максимального интервала. Время ожидания ограничено, т.к. соединение закрывается по таймауту.
+ */
+class EventsRepository : public HttpRepository,
+                         public std::enable_shared_from_this<EventsRepository> {
+ public:
+  static std::shared_ptr<EventsRepository> Create(
+      std::shared_ptr<const CallCenter> call_center, const log::LoggerProvider &logger_provider
+  );
+
+  EventsRepository(const EventsRepository &other) = delete;
+  EventsRepository &operator=(const EventsRepository &other) = delete;
+
+  net::awaitable<Response> HandleRequestAsync(
+      const Request &request, const net::ip::address &client
+  ) override;
+
+ private:
+  using Sequence = CallCenter::EventRing::Sequence;
+
+  /**
+   * @brief Параметры запроса.
+   */
+  struct Query {
+    std::optional<Sequence> cursor;
+    std::chrono::seconds wait;
+  };
+
+  static constexpr size_t kMaxEventsPerResponse_ = 1000;
+  static constexpr std::chrono::seconds kDefaultWait_{0};
+  static constexpr std::chrono::seconds kMaxWait_{20};
+  static constexpr std::chrono::milliseconds kMinPollInterval_{10};
+  static constexpr std::chrono::milliseconds kMaxPollInterval_{320};
+
+  const std::unique_ptr<log::Logger> logger_;
+  const std::shared_ptr<const CallCenter> call_center_;
+
+  EventsRepository(
+      std::shared_ptr<const CallCenter> call_center, const log::LoggerProvider &logger_provider
+  );
+
+  /**
+   * @brief Проверить запрос и прочитать его параметры.
+   * @return ответ с ошибкой - если запрос не может быть обработан
+   */
+  std::variant<Query, Response> ParseQuery(const Request &request);
+  /**
+   * @brief Разобрать неотрицательное целое число из параметра запроса.
+   */
+  static std::optional<uint64_t> ParseNumber(std::string_view str);
+  /**
+   * @brief Сформировать ответ из событий начиная с курсора.
+   */
+  Response MakeEventsResponse(Sequence cursor);
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_EVENTS_EVENTS_REPOSITORY_H_
@@ -0,0 +1,42 @@
+#include "events_response_dto.h"
+
+#include <boost/uuid/uuid_io.hpp>
+#include <chrono>
+
+namespace call_center::repository {
+
+EventsResponseDto::Event::Event(const CallEvent &event)
+    : type(to_string(event.type)),
+      id(boost::uuids::to_string(event.call_id)),
+      phone(event.caller_phone_number.ToString()) {
+  const auto time_since_epoch = std::chrono::utc_clock::to_sys(event.time).time_since_epoch();
+  time = std::chrono::duration_cast<std::chrono::milliseconds>(time_since_epoch).count();
+  if (event.status) {
+    call_status = to_string(*event.status);
+  }
+}
+
+EventsResponseDto::EventsResponseDto(const CallCenter::EventRing::ReadResult &result)
+    : cursor(result.next), dropped(result.dropped) {
+  events.reserve(result.items.size());
+  for (const auto &event : result.items) {
+    events.emplace_back(event);
+  }
+}
+
+void tag_invoke(const json::value_from_tag &, json::value &json, const EventsResponseDto &dto) {
+  json::array json_events;
+  json_events.reserve(dto.events.size());
+  for (const auto &event : dto.events) {
+    json::object json_event{
+        {"type", event.type}, {"id", event.id}, {"phone", event.phone}, {"time", event.time}
+    };
+    if (event.call_status) {
+      json_event["call_status"] = *event.call_status;
+    }
+    json_events.emplace_back(std::move(json_event));
+  }
+  json = {{"cursor", dto.cursor}, {"dropped", dto.dropped}, {"events", std::move(json_events)}};
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,51 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_EVENTS_EVENTS_RESPONSE_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_EVENTS_EVENTS_RESPONSE_DTO_H_
+
+#include <boost/json.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "call_center.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+/**
+ * @brief Ответ на запрос событий обработки вызовов.
+ *
+ * Время события задается в миллисекундах от начала эпохи Unix.
+ */
+struct EventsResponseDto {
+  struct Event {
+    std::string type;
+    std::string id;
+    std::string phone;
+    int64_t time = 0;
+    /// std::nullopt - если вызов еще не завершен.
+    std::optional<std::string> call_status;
+
+    explicit Event(const CallEvent &event);
+  };
+
+  /// Курсор для следующего запроса.
+  uint64_t cursor = 0;
+  /// Количество событий, пропущенных из-за отставания от буфера событий.
+  uint64_t dropped = 0;
+  std::vector<Event> events;
+
+  explicit EventsResponseDto(const CallCenter::EventRing::ReadResult &result);
+
+  /**
+   * @brief Преобразование из объекта в json.
+   */
+  friend void tag_invoke(
+      const json::value_from_tag &, json::value &json, const EventsResponseDto &dto
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_EVENTS_EVENTS_RESPONSE_DTO_H_
@@ -1,6 +1,14 @@
 #include "metrics_repository.h"
 
+#include <charconv>
+
+#include "call_detailed_record.h"
 #include "metrics_response_dto.h"
+#include "operators_metrics_response_dto.h"
+#include "prometheus_writer.h"
+#include "scheduler_metrics_response_dto.h"
+#include "staffing_response_dto.h"
+#include "window_metrics_response_dto.h"
 
 namespace call_center::repository {
 
@@ -8,23 +16,33 @@ using namespace std::chrono_literals;
 namespace json = boost::json;
 
 std::shared_ptr<MetricsRepository> MetricsRepository::Create(
-    std::shared_ptr<const QueueingSystemMetrics> metrics, const log::LoggerProvider &logger_provider
+    std::shared_ptr<const QueueingSystemMetrics> metrics,
+    std::shared_ptr<const core::tasks::SchedulerMetrics> scheduler_metrics,
+    std::shared_ptr<config::Configuration> configuration,
+    const log::LoggerProvider &logger_provider
 ) {
-  return std::shared_ptr<MetricsRepository>(
-      new MetricsRepository(std::move(metrics), logger_provider)
-  );
+  return std::shared_ptr<MetricsRepository>(new MetricsRepository(
+      std::move(metrics), std::move(scheduler_metrics), std::move(configuration), logger_provider
+  ));
 }
 
 MetricsRepository::MetricsRepository(
-    std::shared_ptr<const QueueingSystemMetrics> metrics, const log::LoggerProvider &logger_provider
+    std::shared_ptr<const QueueingSystemMetrics> metrics,
+    std::shared_ptr<const core::tasks::SchedulerMetrics> scheduler_metrics,
+    std::shared_ptr<config::Configuration> configuration,
+    const log::LoggerProvider &logger_provider
 )
     : HttpRepository("metrics"),
       logger_(logger_provider.Get("MetricsRepository")),
-      metrics_(std::move(metrics)) {
+      metrics_(std::move(metrics)),
+      scheduler_metrics_(std::move(scheduler_metrics)),
+      configuration_(std::move(configuration)) {
 }
 
 void MetricsRepository::HandleRequest(
-    const b_http::request<b_http::string_body> &request, const OnHandle &on_handle
+    const b_http::request<b_http::string_body> &request,
+    const net::ip::address &,
+    OnHandle on_handle
 ) {
   logger_->Info() << "Start handle request: " << to_string(request.method()) << " "
                   << request.target();
@@ -34,17 +52,256 @@ void MetricsRepository::HandleRequest(
     on_handle(MakeResponse(b_http::status::method_not_allowed, false, {}));
     return;
   }
-  on_handle(MakeResponse(b_http::status::ok, false, MakeGetMetricsResponseBody()));
+
+  const auto sub_path = GetSubPath(request.target());
+  if (sub_path.empty()) {
+    const auto window_parameter = GetQueryParameter(request.target(), "window");
+    if (!window_parameter) {
+      on_handle(MakeResponse(b_http::status::ok, false, MakeGetMetricsResponseBody()));
+    } else if (const auto window = ParseWindow(*window_parameter)) {
+      on_handle(
+          MakeResponse(b_http::status::ok, false, MakeGetWindowMetricsResponseBody(*window))
+      );
+    } else {
+      logger_->Info() << "Invalid metrics window: " << *window_parameter;
+      on_handle(MakeResponse(b_http::status::bad_request, false, {}));
+    }
+  } else if (sub_path == "scheduler") {
+    on_handle(MakeResponse(b_http::status::ok, false, MakeGetSchedulerMetricsResponseBody()));
+  } else if (sub_path == "operators") {
+    on_handle(MakeResponse(b_http::status::ok, false, MakeGetOperatorsMetricsResponseBody()));
+  } else if (sub_path == "staffing") {
+    on_handle(MakeResponse(b_http::status::ok, false, MakeGetStaffingResponseBody()));
+  } else if (sub_path == "prometheus") {
+    auto response =
+        MakeResponse(b_http::status::ok, false, MakeGetPrometheusMetricsResponseBody());
+    response.set(b_http::field::content_type, PrometheusWriter::kContentType);
+    on_handle(std::move(response));
+  } else {
+    logger_->Info() << "Unknown metrics path: " << sub_path;
+    on_handle(MakeResponse(b_http::status::not_found, false, {}));
+  }
 }
 
 std::string MetricsRepository::MakeGetMetricsResponseBody() const {
+  const auto snapshot = metrics_->GetSnapshot();
   const MetricsReponseDto response_dto(
-      metrics_->GetWaitTimeMetric(),
-      metrics_->GetQueueSizeMetric(),
-      metrics_->GetBusyServerCountMetric(),
-      metrics_->GetServiceLoadInErlang()
+      snapshot.wait_time,
+      snapshot.queue_size,
+      snapshot.busy_server_count,
+      snapshot.service_load_erlang,
+      snapshot.wait_time_histogram,
+      snapshot.service_time_histogram,
+      snapshot.total_time_histogram,
+      snapshot.queue_size_ewma,
+      snapshot.busy_server_count_ewma,
+      snapshot.service_load_erlang_ewma
   );
   return serialize(json::value_from(response_dto));
 }
 
+std::string MetricsRepository::MakeGetWindowMetricsResponseBody(const std::chrono::seconds window
+) const {
+  const WindowMetricsResponseDto response_dto(metrics_->GetWindowMetrics(window));
+  return serialize(json::value_from(response_dto));
+}
+
+std::optional<std::chrono::seconds> MetricsRepository::ParseWindow(std::string_view window) {
+  std::chrono::seconds unit = 1s;
+  if (window.ends_with('m')) {
+    unit = 1min;
+    window.remove_suffix(1);
+  } else if (window.ends_with('s')) {
+    window.remove_suffix(1);
+  }
+  uint64_t count = 0;
+  const auto result = std::from_chars(window.data(), window.data() + window.size(), count);
+  if (result.ec != std::errc() || result.ptr != window.data() + window.size()) {
+    return std::nullopt;
+  }
+  if (count == 0 || count > static_cast<uint64_t>(SlidingWindowMetrics::kMaxWindow / unit)) {
+    return std::nullopt;
+  }
+  return unit * count;
+}
+
+std::string MetricsRepository::MakeGetSchedulerMetricsResponseBody() const {
+  const SchedulerMetricsResponseDto response_dto(scheduler_metrics_->GetSnapshot());
+  return serialize(json::value_from(response_dto));
+}
+
+std::string MetricsRepository::MakeGetOperatorsMetricsResponseBody() const {
+  const OperatorsMetricsResponseDto response_dto(metrics_->GetServersMetrics());
+  return serialize(json::value_from(response_dto));
+}
+
+std::string MetricsRepository::MakeGetStaffingResponseBody() const {
+  namespace erlang = core::qs::metrics::erlang;
+  using erlang::Seconds;
+
+  const auto snapshot = metrics_->GetSnapshot();
+  StaffingResponseDto response_dto;
+  const auto time_between_requests = snapshot.time_between_requests.GetAvg();
+  if (time_between_requests.count() > 0) {
+    response_dto.arrival_rate = 1 / Seconds(time_between_requests).count();
+  }
+  response_dto.service_time = snapshot.service_time_histogram.GetAvg();
+  response_dto.offered_load_erlang =
+      response_dto.arrival_rate * response_dto.service_time.count();
+  response_dto.operator_count = metrics_->GetServerCount();
+  response_dto.target_answer_time = std::chrono::seconds(configuration_->GetNumber<uint64_t>(
+      kStaffingTargetAnswerTimeKey, kDefaultStaffingTargetAnswerTime_, 0
+  ));
+  response_dto.target_service_level = configuration_->GetNumber<double>(
+      kStaffingTargetServiceLevelKey, kDefaultStaffingTargetServiceLevel_, 0, 1
+  );
+  response_dto.patience = std::chrono::seconds(configuration_->GetProperty<uint64_t>(
+      CallDetailedRecord::kMaxWaitKey, CallDetailedRecord::kDefaultMaxWait.count()
+  ));
+
+  response_dto.erlang_c = erlang::PredictErlangC(
+      response_dto.operator_count,
+      response_dto.offered_load_erlang,
+      response_dto.service_time,
+      response_dto.target_answer_time
+  );
+  response_dto.erlang_a = erlang::PredictErlangA(
+      response_dto.operator_count,
+      response_dto.arrival_rate,
+      response_dto.service_time,
+      response_dto.patience
+  );
+  response_dto.required_operator_count = erlang::GetRequiredServerCount(
+      response_dto.offered_load_erlang,
+      response_dto.service_time,
+      response_dto.target_answer_time,
+      response_dto.target_service_level,
+      kMaxStaffingOperatorCount_
+  );
+  return serialize(json::value_from(response_dto));
+}
+
+std::string MetricsRepository::MakeGetPrometheusMetricsResponseBody() const {
+  std::string body;
+  body.reserve(prometheus_body_size_.load(std::memory_order_relaxed));
+  PrometheusWriter writer(body);
+  const auto snapshot = metrics_->GetSnapshot();
+
+  writer.WriteCounter(
+      "call_center_arrivals_total", "Number of accepted calls.", snapshot.arrival_count
+  );
+  writer.WriteCounter(
+      "call_center_serviced_total", "Number of serviced calls.", snapshot.serviced_count
+  );
+  writer.WriteCounter(
+      "call_center_dropouts_total", "Number of refused calls.", snapshot.dropout_count
+  );
+  writer.WriteGauge(
+      "call_center_probability_of_loss",
+      "Fraction of accepted calls that were refused.",
+      snapshot.probability_of_loss
+  );
+  writer.WriteHistogram(
+      "call_center_wait_time_seconds",
+      "Queue wait time of serviced calls.",
+      snapshot.wait_time_histogram
+  );
+  writer.WriteMetric(
+      "call_center_wait_time_stats_seconds",
+      "Queue wait time of serviced calls: min, max, avg and percentiles.",
+      snapshot.wait_time,
+      snapshot.wait_time_histogram
+  );
+  writer.WriteHistogram(
+      "call_center_service_time_seconds",
+      "Service time of serviced calls.",
+      snapshot.service_time_histogram
+  );
+  writer.WriteHistogram(
+      "call_center_total_time_seconds",
+      "Time in system of serviced calls.",
+      snapshot.total_time_histogram
+  );
+  writer.WriteMetric(
+      "call_center_refused_wait_time_seconds",
+      "Queue wait time of refused calls.",
+      snapshot.refused_wait_time
+  );
+  writer.WriteMetric(
+      "call_center_time_between_requests_seconds",
+      "Time between consecutive call arrivals.",
+      snapshot.time_between_requests
+  );
+  writer.WriteGauge(
+      "call_center_average_service_time_seconds",
+      "Average service time of serviced calls.",
+      std::chrono::duration<double>(snapshot.service_time.GetAvg()).count()
+  );
+  writer.WriteMetric(
+      "call_center_queue_size", "Number of calls in the queue.", snapshot.queue_size
+  );
+  writer.WriteMetric(
+      "call_center_busy_operators", "Number of busy operators.", snapshot.busy_server_count
+  );
+  writer.WriteMetric(
+      "call_center_requests_in_system",
+      "Number of calls in the queue or in service.",
+      snapshot.in_system_count
+  );
+  writer.WriteGauge(
+      "call_center_service_load_erlang",
+      "Serviced load in Erlang since recording start.",
+      snapshot.service_load_erlang
+  );
+
+  const std::pair<const char *, EwmaGauge::Snapshot> ewma_gauges[] = {
+      {"call_center_queue_size_ewma", snapshot.queue_size_ewma},
+      {"call_center_busy_operators_ewma", snapshot.busy_server_count_ewma},
+      {"call_center_service_load_erlang_ewma", snapshot.service_load_erlang_ewma}};
+  for (const auto &[name, ewma] : ewma_gauges) {
+    writer.WriteHeader(name, PrometheusWriter::Type::kGauge, "Exponentially weighted average.");
+    for (size_t i = 0; i < EwmaGauge::kTimeConstants.size(); ++i) {
+      const auto labels =
+          "window=\"" + std::to_string(EwmaGauge::kTimeConstants[i].count()) + "m\"";
+      writer.WriteSample(name, labels, ewma[i]);
+    }
+  }
+
+  std::array<SlidingWindowMetrics::Snapshot, kPrometheusWindows_.size()> windows;
+  for (size_t i = 0; i < windows.size(); ++i) {
+    windows[i] = metrics_->GetWindowMetrics(kPrometheusWindows_[i]);
+  }
+  writer.WriteWindowMetrics("call_center_window", windows);
+
+  const auto &scaling = snapshot.scaling;
+  writer.WriteCounter(
+      "call_center_autoscaler_decisions_total",
+      "Number of operator autoscaling decisions.",
+      scaling.decision_count
+  );
+  writer.WriteCounter(
+      "call_center_autoscaler_scale_ups_total",
+      "Number of autoscaling decisions that added operators.",
+      scaling.scale_up_count
+  );
+  writer.WriteCounter(
+      "call_center_autoscaler_scale_downs_total",
+      "Number of autoscaling decisions that removed operators.",
+      scaling.scale_down_count
+  );
+  writer.WriteGauge(
+      "call_center_autoscaler_desired_operators",
+      "Operator count calculated by the last autoscaling decision.",
+      static_cast<double>(scaling.desired_count)
+  );
+  writer.WriteGauge(
+      "call_center_autoscaler_target_operators",
+      "Operator count set by the last autoscaling decision.",
+      static_cast<double>(scaling.target_count)
+  );
+
+  prometheus_body_size_.store(body.size(), std::memory_order_relaxed);
+  return body;
+}
+
 }  // namespace call_center::repository
@@ -1,9 +1,15 @@
 #ifndef METRICS_REPOSITORY_H
 #define METRICS_REPOSITORY_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
+
+#include "configuration/configuration.h"
 #include "core/http/http.h"
 #include "core/http/http_repository.h"
 #include "core/queueing_system/metrics/queueing_system_metrics.h"
+#include "core/tasks/scheduler_metrics.h"
 
 namespace call_center::repository {
 
@@ -13,32 +19,93 @@ using namespace core::http;
 
 /**
  * @brief HTTP-репозиторий для обработки запросов, связанных с метриками.
+ *
+ * Обрабатывает запросы:
+ * - /metrics - метрики системы массового обслуживания;
+ * - /metrics?window=60s - метрики системы массового обслуживания за последний промежуток времени
+ *   (в секундах "s" или минутах "m");
+ * - /metrics/scheduler - метрики планировщика задач;
+ * - /metrics/operators - метрики работающих и удаленных операторов;
+ * - /metrics/staffing - прогноз по формулам Erlang C и Erlang A и необходимое количество
+ *   операторов по измеренным интенсивности поступления и времени обслуживания;
+ * - /metrics/prometheus - метрики системы массового обслуживания в текстовом формате Prometheus.
  */
 class MetricsRepository : public HttpRepository,
                           public std::enable_shared_from_this<MetricsRepository> {
  public:
+  /// Ключ в конфигурации, соответствующий целевому времени ожидания ответа в секундах.
+  static constexpr auto kStaffingTargetAnswerTimeKey = "staffing_target_answer_time";
+  /// Ключ в конфигурации, соответствующий целевой доле вызовов, ожидающих не дольше целевого
+  /// времени.
+  static constexpr auto kStaffingTargetServiceLevelKey = "staffing_target_service_level";
+
   static std::shared_ptr<MetricsRepository> Create(
       std::shared_ptr<const qs::metrics::QueueingSystemMetrics> metrics,
+      std::shared_ptr<const core::tasks::SchedulerMetrics> scheduler_metrics,
+      std::shared_ptr<config::Configuration> configuration,
       const log::LoggerProvider &logger_provider
   );
 
   MetricsRepository(const MetricsRepository &other) = delete;
   MetricsRepository &operator=(const MetricsRepository &other) = delete;
 
-  void HandleRequest(const b_http::request<b_http::string_body> &request, const OnHandle &on_handle)
-      override;
+  void HandleRequest(
+      const b_http::request<b_http::string_body> &request,
+      const net::ip::address &client,
+      OnHandle on_handle
+  ) override;
 
  private:
+  static constexpr uint64_t kDefaultStaffingTargetAnswerTime_ = 20;
+  static constexpr double kDefaultStaffingTargetServiceLevel_ = 0.8;
+  /// Ограничение поиска необходимого количества операторов.
+  static constexpr size_t kMaxStaffingOperatorCount_ = 1'000'000;
+  /// Промежутки времени, метрики за которые отдаются в формате Prometheus.
+  static constexpr std::array<std::chrono::seconds, 3> kPrometheusWindows_ = {
+      std::chrono::minutes(1), std::chrono::minutes(5), std::chrono::minutes(15)};
+
   const std::unique_ptr<log::Logger> logger_;
   const std::shared_ptr<const qs::metrics::QueueingSystemMetrics> metrics_;
+  const std::shared_ptr<const core::tasks::SchedulerMetrics> scheduler_metrics_;
+  const std::shared_ptr<config::Configuration> configuration_;
+  /// Размер последнего ответа в формате Prometheus, используется для резервирования буфера.
+  mutable std::atomic_size_t prometheus_body_size_ = 0;
 
   /**
    * @brief Сформировать тело ответа на запрос о получении метрик.
    */
   std::string MakeGetMetricsResponseBody() const;
+  /**
+   * @brief Сформировать тело ответа на запрос о получении метрик за последний промежуток времени.
+   */
+  std::string MakeGetWindowMetricsResponseBody(std::chrono::seconds window) const;
+  /**
+   * @brief Сформировать тело ответа на запрос о получении метрик планировщика задач.
+   */
+  std::string MakeGetSchedulerMetricsResponseBody() const;
+  /**
+   * @brief Сформировать тело ответа на запрос о получении метрик операторов.
+   */
+  std::string MakeGetOperatorsMetricsResponseBody() const;
+  /**
+   * @brief Сформировать тело ответа на запрос о расчете количества операторов.
+   */
+  std::string MakeGetStaffingResponseBody() const;
+  /**
+   * @brief Сформировать тело ответа на запрос о получении метрик в формате Prometheus.
+   */
+  std::string MakeGetPrometheusMetricsResponseBody() const;
+
+  /**
+   * @brief Разобрать длину промежутка времени, например: "60", "60s", "5m".
+   * @return std::nullopt - если формат неверен или промежуток не поддерживается
+   */
+  static std::optional<std::chrono::seconds> ParseWindow(std::string_view window);
 
   MetricsRepository(
       std::shared_ptr<const qs::metrics::QueueingSystemMetrics> metrics,
+      std::shared_ptr<const core::tasks::SchedulerMetrics> scheduler_metrics,
+      std::shared_ptr<config::Configuration> configuration,
       const log::LoggerProvider &logger_provider
   );
 };
@@ -5,24 +5,82 @@ namespace call_center::repository {
 void tag_invoke(
     const json::value_from_tag &, json::value &json, const MetricsReponseDto &metrics_response
 ) {
+  auto wait_time = MetricsReponseDto::MetricToJson(metrics_response.wait_time_metric);
+  MetricsReponseDto::AddPercentiles(wait_time.as_object(), metrics_response.wait_time_histogram);
   json = json::object{
-      {"wait_time", MetricsReponseDto::MetricToJson(metrics_response.wait_time_metric)},
+      {"wait_time", std::move(wait_time)},
+      {"service_time", MetricsReponseDto::HistogramToJson(metrics_response.service_time_histogram)},
+      {"total_time", MetricsReponseDto::HistogramToJson(metrics_response.total_time_histogram)},
       {"queue_size", MetricsReponseDto::MetricToJson(metrics_response.queue_size_metric)},
       {"busy_operators_count",
        MetricsReponseDto::MetricToJson(metrics_response.busy_operators_count_metric)},
-      {"service_load_erlang", metrics_response.service_load_in_erlang}};
+      {"service_load_erlang", metrics_response.service_load_in_erlang},
+      {"ewma",
+       json::object{
+           {"queue_size", MetricsReponseDto::EwmaToJson(metrics_response.queue_size_ewma)},
+           {"busy_operators_count",
+            MetricsReponseDto::EwmaToJson(metrics_response.busy_operators_count_ewma)},
+           {"service_load_erlang",
+            MetricsReponseDto::EwmaToJson(metrics_response.service_load_in_erlang_ewma)}}}};
+}
+
+namespace {
+
+double ToSeconds(const MetricsReponseDto::Duration value) {
+  return round(floor<duration<double>>(value).count(), 1e-3);
+}
+
+}  // namespace
+
+json::value MetricsReponseDto::HistogramToJson(const HdrHistogram::Snapshot &histogram) {
+  json::object json{
+      {"min", ToSeconds(histogram.GetMin())},
+      {"max", ToSeconds(histogram.max)},
+      {"avg", ToSeconds(histogram.GetAvg())}};
+  AddPercentiles(json, histogram);
+  return json;
+}
+
+void MetricsReponseDto::AddPercentiles(
+    json::object &json, const HdrHistogram::Snapshot &histogram
+) {
+  static constexpr std::pair<const char *, double> kPercentiles[] = {
+      {"p50", 0.5}, {"p90", 0.9}, {"p99", 0.99}, {"p99.9", 0.999}};
+  for (const auto &[name, percentile] : kPercentiles) {
+    json[name] = ToSeconds(histogram.GetPercentile(percentile));
+  }
 }
 
 MetricsReponseDto::MetricsReponseDto(
     const Metric<Duration> &wait_time_metric,
     const Metric<size_t, double> &queue_size_metric,
     const Metric<size_t, double> &busy_operators_count_metric,
-    const double service_load_in_erlang
+    const double service_load_in_erlang,
+    const HdrHistogram::Snapshot &wait_time_histogram,
+    const HdrHistogram::Snapshot &service_time_histogram,
+    const HdrHistogram::Snapshot &total_time_histogram,
+    const EwmaGauge::Snapshot &queue_size_ewma,
+    const EwmaGauge::Snapshot &busy_operators_count_ewma,
+    const EwmaGauge::Snapshot &service_load_in_erlang_ewma
 )
     : wait_time_metric(wait_time_metric),
       queue_size_metric(queue_size_metric),
       busy_operators_count_metric(busy_operators_count_metric),
-      service_load_in_erlang(service_load_in_erlang) {
+      service_load_in_erlang(service_load_in_erlang),
+      wait_time_histogram(wait_time_histogram),
+      service_time_histogram(service_time_histogram),
+      total_time_histogram(total_time_histogram),
+      queue_size_ewma(queue_size_ewma),
+      busy_operators_count_ewma(busy_operators_count_ewma),
+      service_load_in_erlang_ewma(service_load_in_erlang_ewma) {
+}
+
+json::value MetricsReponseDto::EwmaToJson(const EwmaGauge::Snapshot &ewma) {
+  json::object json;
+  for (size_t i = 0; i < EwmaGauge::kTimeConstants.size(); ++i) {
+    json[std::to_string(EwmaGauge::kTimeConstants[i].count()) + "m"] = round(ewma[i], 1e-3);
+  }
+  return json;
 }
 
 }  // namespace call_center::repository
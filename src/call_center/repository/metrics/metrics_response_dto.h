@@ -3,6 +3,8 @@
 
 #include <boost/json.hpp>
 
+#include "core/queueing_system/metrics/ewma_gauge.h"
+#include "core/queueing_system/metrics/hdr_histogram.h"
 #include "core/queueing_system/metrics/metric.h"
 #include "core/queueing_system/metrics/queueing_system_metrics.h"
 #include "core/utils/numbers.h"
@@ -23,12 +25,24 @@ struct MetricsReponseDto {
   Metric<size_t, double> queue_size_metric;
   Metric<size_t, double> busy_operators_count_metric;
   double service_load_in_erlang;
+  HdrHistogram::Snapshot wait_time_histogram;
+  HdrHistogram::Snapshot service_time_histogram;
+  HdrHistogram::Snapshot total_time_histogram;
+  EwmaGauge::Snapshot queue_size_ewma;
+  EwmaGauge::Snapshot busy_operators_count_ewma;
+  EwmaGauge::Snapshot service_load_in_erlang_ewma;
 
   MetricsReponseDto(
       const Metric<Duration> &wait_time_metric,
       const Metric<size_t, double> &queue_size_metric,
       const Metric<size_t, double> &busy_operators_count_metric,
-      double service_load_in_erlang
+      double service_load_in_erlang,
+      const HdrHistogram::Snapshot &wait_time_histogram,
+      const HdrHistogram::Snapshot &service_time_histogram,
+      const HdrHistogram::Snapshot &total_time_histogram,
+      const EwmaGauge::Snapshot &queue_size_ewma,
+      const EwmaGauge::Snapshot &busy_operators_count_ewma,
+      const EwmaGauge::Snapshot &service_load_in_erlang_ewma
   );
 
   /**
@@ -43,6 +57,18 @@ struct MetricsReponseDto {
    */
   template <typename Metric>
   static json::value MetricToJson(Metric metric);
+  /**
+   * @brief Преобразование распределения длительностей в json (в секундах).
+   */
+  static json::value HistogramToJson(const HdrHistogram::Snapshot &histogram);
+  /**
+   * @brief Добавить к объекту перцентили распределения длительностей (в секундах).
+   */
+  static void AddPercentiles(json::object &json, const HdrHistogram::Snapshot &histogram);
+  /**
+   * @brief Преобразование скользящих средних в json.
+   */
+  static json::value EwmaToJson(const EwmaGauge::Snapshot &ewma);
 };
 
 template <typename Metric>
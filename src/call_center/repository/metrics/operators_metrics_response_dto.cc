@@ -0,0 +1,40 @@
+#include "operators_metrics_response_dto.h"
+
+#include <boost/uuid/uuid_io.hpp>
+
+#include "metrics_response_dto.h"
+
+namespace call_center::repository {
+
+using core::qs::metrics::QueueingSystemMetrics;
+
+void tag_invoke(
+    const json::value_from_tag &, json::value &json, const OperatorsMetricsResponseDto &dto
+) {
+  const auto &snapshot = dto.snapshot;
+  json::array operators;
+  operators.reserve(snapshot.servers.size());
+  for (const auto &server : snapshot.servers) {
+    operators.push_back(json::object{
+        {"index", server.index},
+        {"id", boost::uuids::to_string(server.id)},
+        {"serviced_count", server.service_time.GetCount()},
+        {"service_time", MetricsReponseDto::MetricToJson(server.service_time)},
+        {"utilization", round(server.utilization, 1e-3)}});
+  }
+  json = json::object{
+      {"operators", std::move(operators)},
+      {"retired",
+       json::object{
+           {"operator_count", snapshot.retired_count},
+           {"serviced_count", snapshot.retired_service_time.GetCount()},
+           {"service_time", MetricsReponseDto::MetricToJson(snapshot.retired_service_time)}}}};
+}
+
+OperatorsMetricsResponseDto::OperatorsMetricsResponseDto(
+    QueueingSystemMetrics::ServersSnapshot snapshot
+)
+    : snapshot(std::move(snapshot)) {
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,35 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_OPERATORS_METRICS_RESPONSE_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_OPERATORS_METRICS_RESPONSE_DTO_H_
+
+#include <boost/json.hpp>
+
+#include "core/queueing_system/metrics/queueing_system_metrics.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+/**
+ * @brief Ответ на запрос о получении метрик операторов.
+ *
+ * Содержит метрики работающих операторов и объединенные метрики удаленных операторов.
+ * Длительности задаются в секундах.
+ */
+struct OperatorsMetricsResponseDto {
+  core::qs::metrics::QueueingSystemMetrics::ServersSnapshot snapshot;
+
+  explicit OperatorsMetricsResponseDto(
+      core::qs::metrics::QueueingSystemMetrics::ServersSnapshot snapshot
+  );
+
+  /**
+   * @brief Преобразование из объекта в json.
+   */
+  friend void tag_invoke(
+      const json::value_from_tag &, json::value &json, const OperatorsMetricsResponseDto &dto
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_OPERATORS_METRICS_RESPONSE_DTO_H_
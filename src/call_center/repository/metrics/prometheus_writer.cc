@@ -0,0 +1,199 @@
+#include "prometheus_writer.h"
+
+#include <charconv>
+#include <cmath>
+#include <vector>
+
+namespace call_center::repository {
+
+using core::qs::metrics::HdrHistogram;
+using core::qs::metrics::SlidingWindowMetrics;
+
+namespace {
+
+/**
+ * @brief Метка окна в формате параметра window запроса /metrics: в минутах, если окно делится на
+ * минуту, иначе в секундах.
+ */
+std::string MakeWindowLabel(const std::chrono::seconds window) {
+  const auto count = window.count();
+  const auto value =
+      count % 60 == 0 ? std::to_string(count / 60) + "m" : std::to_string(count) + "s";
+  return "window=\"" + value + "\"";
+}
+
+}  // namespace
+
+PrometheusWriter::PrometheusWriter(std::string &buffer) : buffer_(buffer) {
+}
+
+void PrometheusWriter::WriteHeader(
+    const std::string_view name, const Type type, const std::string_view help
+) {
+  buffer_.append("# HELP ").append(name).append(" ").append(help).append("\n");
+  buffer_.append("# TYPE ").append(name);
+  switch (type) {
+    case Type::kCounter:
+      buffer_.append(" counter\n");
+      break;
+    case Type::kGauge:
+      buffer_.append(" gauge\n");
+      break;
+    case Type::kHistogram:
+      buffer_.append(" histogram\n");
+      break;
+  }
+}
+
+void PrometheusWriter::WriteSample(
+    const std::string_view name, const std::string_view labels, const double value
+) {
+  WriteName(name, labels);
+  WriteValue(value);
+  buffer_ += '\n';
+}
+
+void PrometheusWriter::WriteSample(
+    const std::string_view name, const std::string_view labels, const uint64_t value
+) {
+  WriteName(name, labels);
+  WriteValue(value);
+  buffer_ += '\n';
+}
+
+void PrometheusWriter::WriteCounter(
+    const std::string_view name, const std::string_view help, const uint64_t value
+) {
+  WriteHeader(name, Type::kCounter, help);
+  WriteSample(name, {}, value);
+}
+
+void PrometheusWriter::WriteGauge(
+    const std::string_view name, const std::string_view help, const double value
+) {
+  WriteHeader(name, Type::kGauge, help);
+  WriteSample(name, {}, value);
+}
+
+void PrometheusWriter::WriteHistogram(
+    const std::string_view name,
+    const std::string_view help,
+    const HdrHistogram::Snapshot &histogram
+) {
+  WriteHeader(name, Type::kHistogram, help);
+
+  size_t bucket = 0;
+  uint64_t cumulative_count = 0;
+  for (const auto bound : kHistogramBounds) {
+    for (; bucket < HdrHistogram::kBucketCount &&
+           HdrHistogram::GetBucketUpperBound(bucket) <= bound;
+         ++bucket) {
+      cumulative_count += histogram.buckets[bucket];
+    }
+    buffer_.append(name).append("_bucket{le=\"");
+    WriteValue(static_cast<double>(bound) / 1000);
+    buffer_.append("\"} ");
+    WriteValue(cumulative_count);
+    buffer_ += '\n';
+  }
+  buffer_.append(name).append("_bucket{le=\"+Inf\"} ");
+  WriteValue(histogram.count);
+  buffer_ += '\n';
+
+  buffer_.append(name).append("_sum ");
+  WriteValue(std::chrono::duration<double>(histogram.sum).count());
+  buffer_ += '\n';
+  buffer_.append(name).append("_count ");
+  WriteValue(histogram.count);
+  buffer_ += '\n';
+}
+
+void PrometheusWriter::WriteWindowMetrics(
+    const std::string_view prefix, const std::span<const SlidingWindowMetrics::Snapshot> windows
+) {
+  std::vector<std::string> labels;
+  labels.reserve(windows.size());
+  for (const auto &window : windows) {
+    labels.push_back(MakeWindowLabel(window.window));
+  }
+  const auto write_family = [&](const std::string_view suffix,
+                                const std::string_view help,
+                                const auto &get_value) {
+    const auto name = std::string(prefix).append(suffix);
+    WriteHeader(name, Type::kGauge, help);
+    for (size_t i = 0; i < windows.size(); ++i) {
+      WriteSample(name, labels[i], get_value(windows[i]));
+    }
+  };
+
+  write_family("_arrivals", "Number of requests arrived in the window.", [](const auto &window) {
+    return window.arrival_count;
+  });
+  write_family("_serviced", "Number of requests serviced in the window.", [](const auto &window) {
+    return window.serviced_count;
+  });
+  write_family("_dropouts", "Number of requests refused in the window.", [](const auto &window) {
+    return window.dropout_count;
+  });
+  write_family(
+      "_arrival_rate",
+      "Requests arrived per second in the window.",
+      [](const auto &window) {
+        return window.GetArrivalRate();
+      }
+  );
+
+  const auto wait_time_name = std::string(prefix).append("_wait_time_seconds");
+  WriteHeader(wait_time_name, Type::kGauge, "Queue wait time of requests serviced in the window.");
+  for (size_t i = 0; i < windows.size(); ++i) {
+    const auto &window = windows[i];
+    WriteSample(wait_time_name, labels[i] + R"(,stat="avg")", ToDouble(window.GetAvgWaitTime()));
+    WriteSample(wait_time_name, labels[i] + R"(,stat="max")", ToDouble(window.max_wait_time));
+  }
+
+  write_family(
+      "_service_load_erlang",
+      "Serviced load in Erlang in the window.",
+      [](const auto &window) {
+        return window.GetServiceLoadInErlang();
+      }
+  );
+}
+
+void PrometheusWriter::WriteCount(
+    const std::string_view name, const std::string_view help, const uint64_t count
+) {
+  std::string count_name(name);
+  count_name += "_count";
+  WriteCounter(count_name, help, count);
+}
+
+void PrometheusWriter::WriteName(const std::string_view name, const std::string_view labels) {
+  buffer_.append(name);
+  if (!labels.empty()) {
+    buffer_.append("{").append(labels).append("}");
+  }
+  buffer_ += ' ';
+}
+
+void PrometheusWriter::WriteValue(const double value) {
+  if (std::isnan(value)) {
+    buffer_.append("NaN");
+    return;
+  }
+  if (std::isinf(value)) {
+    buffer_.append(value > 0 ? "+Inf" : "-Inf");
+    return;
+  }
+  std::array<char, 32> chars{};
+  const auto result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+  buffer_.append(chars.data(), result.ptr);
+}
+
+void PrometheusWriter::WriteValue(const uint64_t value) {
+  std::array<char, 24> chars{};
+  const auto result = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+  buffer_.append(chars.data(), result.ptr);
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,172 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_PROMETHEUS_WRITER_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_PROMETHEUS_WRITER_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "core/queueing_system/metrics/hdr_histogram.h"
+#include "core/queueing_system/metrics/metric.h"
+#include "core/queueing_system/metrics/sliding_window_metrics.h"
+
+namespace call_center::repository {
+
+/**
+ * @brief Запись метрик в текстовом формате Prometheus (text exposition format 0.0.4).
+ *
+ * Значения дописываются непосредственно в переданный буфер без промежуточного представления.
+ * Длительности записываются в секундах.
+ */
+class PrometheusWriter {
+ public:
+  /// Значение заголовка Content-Type для текстового формата.
+  static constexpr auto kContentType = "text/plain; version=0.0.4; charset=utf-8";
+  /// Верхние границы корзин гистограмм в миллисекундах (корзина "+Inf" добавляется всегда).
+  static constexpr std::array<uint64_t, 16> kHistogramBounds = {
+      5, 10, 25, 50, 100, 250, 500, 1'000, 2'500, 5'000, 10'000, 30'000, 60'000, 120'000, 300'000,
+      600'000};
+  /// Процентили, записываемые вместе с метрикой (те же, что в ответе /metrics).
+  static constexpr std::array<std::pair<std::string_view, double>, 4> kPercentiles = {
+      {{R"(stat="p50")", 0.5},
+       {R"(stat="p90")", 0.9},
+       {R"(stat="p99")", 0.99},
+       {R"(stat="p99.9")", 0.999}}};
+
+  /**
+   * @brief Тип метрики.
+   */
+  enum class Type { kCounter, kGauge, kHistogram };
+
+  /**
+   * @param buffer буфер, в конец которого дописываются метрики
+   */
+  explicit PrometheusWriter(std::string &buffer);
+
+  /**
+   * @brief Записать строки # HELP и # TYPE семейства метрик.
+   */
+  void WriteHeader(std::string_view name, Type type, std::string_view help);
+  /**
+   * @brief Записать значение метрики.
+   * @param labels метки без фигурных скобок, например: window="1m"
+   */
+  void WriteSample(std::string_view name, std::string_view labels, double value);
+  void WriteSample(std::string_view name, std::string_view labels, uint64_t value);
+  /**
+   * @brief Записать счетчик вместе с заголовком.
+   */
+  void WriteCounter(std::string_view name, std::string_view help, uint64_t value);
+  /**
+   * @brief Записать показатель вместе с заголовком.
+   */
+  void WriteGauge(std::string_view name, std::string_view help, double value);
+  /**
+   * @brief Записать гистограмму с корзинами @link kHistogramBounds @endlink.
+   *
+   * Количество значений в корзине определяется по корзинам HdrHistogram, верхняя граница которых
+   * не превышает границу корзины, поэтому для больших значений оно может быть немного занижено.
+   */
+  void WriteHistogram(
+      std::string_view name,
+      std::string_view help,
+      const core::qs::metrics::HdrHistogram::Snapshot &histogram
+  );
+  /**
+   * @brief Записать минимальное, максимальное и среднее значения метрики как показатель с меткой
+   * stat и количество значений как счетчик с суффиксом _count.
+   */
+  template <typename T, typename AvgT>
+  void WriteMetric(
+      std::string_view name, std::string_view help, const core::qs::metrics::Metric<T, AvgT> &metric
+  );
+  /**
+   * @brief Записать метрику, как @link WriteMetric @endlink, дополнив ее процентилями
+   * @link kPercentiles @endlink из гистограммы тех же значений.
+   */
+  template <typename T, typename AvgT>
+  void WriteMetric(
+      std::string_view name,
+      std::string_view help,
+      const core::qs::metrics::Metric<T, AvgT> &metric,
+      const core::qs::metrics::HdrHistogram::Snapshot &histogram
+  );
+  /**
+   * @brief Записать метрики за последние промежутки времени как показатели с меткой window,
+   * например: window="5m".
+   *
+   * Записываются количество поступивших, обслуженных и отклоненных запросов, интенсивность
+   * поступления, среднее и максимальное время ожидания (метка stat) и обслуженная нагрузка, как в
+   * ответе /metrics?window=.
+   * @param prefix префикс имен метрик
+   */
+  void WriteWindowMetrics(
+      std::string_view prefix,
+      std::span<const core::qs::metrics::SlidingWindowMetrics::Snapshot> windows
+  );
+
+ private:
+  std::string &buffer_;
+
+  void WriteName(std::string_view name, std::string_view labels);
+  void WriteValue(double value);
+  void WriteValue(uint64_t value);
+  template <typename T, typename AvgT>
+  void WriteStats(std::string_view name, const core::qs::metrics::Metric<T, AvgT> &metric);
+  void WriteCount(std::string_view name, std::string_view help, uint64_t count);
+
+  template <typename T>
+  static double ToDouble(T value);
+};
+
+template <typename T, typename AvgT>
+void PrometheusWriter::WriteMetric(
+    const std::string_view name,
+    const std::string_view help,
+    const core::qs::metrics::Metric<T, AvgT> &metric
+) {
+  WriteHeader(name, Type::kGauge, help);
+  WriteStats(name, metric);
+  WriteCount(name, help, metric.GetCount());
+}
+
+template <typename T, typename AvgT>
+void PrometheusWriter::WriteMetric(
+    const std::string_view name,
+    const std::string_view help,
+    const core::qs::metrics::Metric<T, AvgT> &metric,
+    const core::qs::metrics::HdrHistogram::Snapshot &histogram
+) {
+  WriteHeader(name, Type::kGauge, help);
+  WriteStats(name, metric);
+  for (const auto &[labels, percentile] : kPercentiles) {
+    WriteSample(name, labels, ToDouble(histogram.GetPercentile(percentile)));
+  }
+  WriteCount(name, help, metric.GetCount());
+}
+
+template <typename T, typename AvgT>
+void PrometheusWriter::WriteStats(
+    const std::string_view name, const core::qs::metrics::Metric<T, AvgT> &metric
+) {
+  WriteSample(name, R"(stat="min")", ToDouble(metric.GetMin()));
+  WriteSample(name, R"(stat="max")", ToDouble(metric.GetMax()));
+  WriteSample(name, R"(stat="avg")", ToDouble(metric.GetAvg()));
+}
+
+template <typename T>
+double PrometheusWriter::ToDouble(const T value) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    return static_cast<double>(value);
+  } else {
+    return std::chrono::duration<double>(value).count();
+  }
+}
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_PROMETHEUS_WRITER_H_
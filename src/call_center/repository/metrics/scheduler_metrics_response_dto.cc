@@ -0,0 +1,58 @@
+#include "scheduler_metrics_response_dto.h"
+
+#include "core/utils/numbers.h"
+
+namespace call_center::repository {
+
+using namespace std::chrono;
+using namespace core::utils::numbers;
+using core::tasks::SchedulerMetrics;
+
+void tag_invoke(
+    const json::value_from_tag &, json::value &json, const SchedulerMetricsResponseDto &dto
+) {
+  json::object tasks;
+  for (const auto &category : dto.snapshot.categories) {
+    tasks[SchedulerMetrics::ToString(category.category)] = json::object{
+        {"count", category.run_time.count},
+        {"wait_time", SchedulerMetricsResponseDto::HistogramToJson(category.wait_time)},
+        {"run_time", SchedulerMetricsResponseDto::HistogramToJson(category.run_time)}};
+  }
+
+  json::array threads;
+  threads.reserve(dto.snapshot.threads.size());
+  for (const auto &thread : dto.snapshot.threads) {
+    threads.push_back(json::object{
+        {"id", thread.id},
+        {"active", thread.active},
+        {"utilization", round(thread.utilization, 1e-3)},
+        {"busy_time", round(duration<double>(thread.busy_time).count(), 1e-3)},
+        {"lifetime", round(duration<double>(thread.lifetime).count(), 1e-3)}});
+  }
+
+  json = json::object{
+      {"active_thread_count", dto.snapshot.active_thread_count},
+      {"utilization", round(dto.snapshot.utilization, 1e-3)},
+      {"tasks", std::move(tasks)},
+      {"threads", std::move(threads)}};
+}
+
+SchedulerMetricsResponseDto::SchedulerMetricsResponseDto(SchedulerMetrics::Snapshot snapshot)
+    : snapshot(std::move(snapshot)) {
+}
+
+json::value SchedulerMetricsResponseDto::HistogramToJson(
+    const core::tasks::LatencyHistogram::Snapshot &histogram
+) {
+  const auto to_micros = [](const auto value) {
+    return floor<microseconds>(value).count();
+  };
+  return json::object{
+      {"avg", to_micros(histogram.GetAvg())},
+      {"p50", to_micros(histogram.GetPercentile(0.5))},
+      {"p90", to_micros(histogram.GetPercentile(0.9))},
+      {"p99", to_micros(histogram.GetPercentile(0.99))},
+      {"max", to_micros(histogram.max)}};
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,37 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_SCHEDULER_METRICS_RESPONSE_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_SCHEDULER_METRICS_RESPONSE_DTO_H_
+
+#include <boost/json.hpp>
+
+#include "core/tasks/scheduler_metrics.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+/**
+ * @brief Ответ на запрос о получении метрик планировщика задач.
+ *
+ * Все длительности в гистограммах задаются в микросекундах.
+ */
+struct SchedulerMetricsResponseDto {
+  core::tasks::SchedulerMetrics::Snapshot snapshot;
+
+  explicit SchedulerMetricsResponseDto(core::tasks::SchedulerMetrics::Snapshot snapshot);
+
+  /**
+   * @brief Преобразование из объекта в json.
+   */
+  friend void tag_invoke(
+      const json::value_from_tag &, json::value &json, const SchedulerMetricsResponseDto &dto
+  );
+
+  /**
+   * @brief Преобразование гистограммы в json.
+   */
+  static json::value HistogramToJson(const core::tasks::LatencyHistogram::Snapshot &histogram);
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_SCHEDULER_METRICS_RESPONSE_DTO_H_
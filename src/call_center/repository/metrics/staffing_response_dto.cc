@@ -0,0 +1,51 @@
+#include "staffing_response_dto.h"
+
+#include <cmath>
+
+#include "core/utils/numbers.h"
+
+namespace call_center::repository {
+
+using namespace core::utils::numbers;
+
+namespace {
+
+/**
+ * @brief Округленное значение или null, если значение бесконечно.
+ */
+json::value ToJson(const double value) {
+  if (!std::isfinite(value)) {
+    return nullptr;
+  }
+  return round(value, 1e-3);
+}
+
+}  // namespace
+
+void tag_invoke(const json::value_from_tag &, json::value &json, const StaffingResponseDto &dto) {
+  json::value required_operator_count = nullptr;
+  if (dto.required_operator_count) {
+    required_operator_count = *dto.required_operator_count;
+  }
+  json = json::object{
+      {"arrival_rate", ToJson(dto.arrival_rate)},
+      {"service_time", ToJson(dto.service_time.count())},
+      {"offered_load_erlang", ToJson(dto.offered_load_erlang)},
+      {"operator_count", dto.operator_count},
+      {"target_answer_time", ToJson(dto.target_answer_time.count())},
+      {"target_service_level", ToJson(dto.target_service_level)},
+      {"erlang_c",
+       json::object{
+           {"wait_probability", ToJson(dto.erlang_c.wait_probability)},
+           {"service_level", ToJson(dto.erlang_c.service_level)},
+           {"average_wait", ToJson(dto.erlang_c.average_wait.count())}}},
+      {"erlang_a",
+       json::object{
+           {"patience", ToJson(dto.patience.count())},
+           {"wait_probability", ToJson(dto.erlang_a.wait_probability)},
+           {"abandonment_probability", ToJson(dto.erlang_a.abandonment_probability)},
+           {"average_wait", ToJson(dto.erlang_a.average_wait.count())}}},
+      {"required_operator_count", std::move(required_operator_count)}};
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,43 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_STAFFING_RESPONSE_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_STAFFING_RESPONSE_DTO_H_
+
+#include <boost/json.hpp>
+#include <optional>
+
+#include "core/queueing_system/metrics/erlang.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+/**
+ * @brief Ответ на запрос о расчете количества операторов по формулам Эрланга.
+ *
+ * Длительности задаются в секундах, интенсивность поступления - в вызовах в секунду.
+ */
+struct StaffingResponseDto {
+  using Seconds = core::qs::metrics::erlang::Seconds;
+
+  double arrival_rate = 0;
+  Seconds service_time{0};
+  double offered_load_erlang = 0;
+  size_t operator_count = 0;
+  Seconds target_answer_time{0};
+  double target_service_level = 0;
+  Seconds patience{0};
+  core::qs::metrics::erlang::ErlangCPrediction erlang_c;
+  core::qs::metrics::erlang::ErlangAPrediction erlang_a;
+  /// std::nullopt - если цель недостижима в пределах ограничения поиска.
+  std::optional<size_t> required_operator_count;
+
+  /**
+   * @brief Преобразование из объекта в json.
+   */
+  friend void tag_invoke(
+      const json::value_from_tag &, json::value &json, const StaffingResponseDto &dto
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_STAFFING_RESPONSE_DTO_H_
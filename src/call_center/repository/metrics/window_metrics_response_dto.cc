@@ -0,0 +1,35 @@
+#include "window_metrics_response_dto.h"
+
+#include "core/utils/numbers.h"
+
+namespace call_center::repository {
+
+using namespace std::chrono;
+using namespace core::utils::numbers;
+using core::qs::metrics::SlidingWindowMetrics;
+
+void tag_invoke(
+    const json::value_from_tag &, json::value &json, const WindowMetricsResponseDto &dto
+) {
+  const auto &snapshot = dto.snapshot;
+  const auto to_seconds = [](const auto value) {
+    return round(duration<double>(value).count(), 1e-3);
+  };
+  json = json::object{
+      {"window", snapshot.window.count()},
+      {"arrival_count", snapshot.arrival_count},
+      {"serviced_count", snapshot.serviced_count},
+      {"dropout_count", snapshot.dropout_count},
+      {"arrival_rate", round(snapshot.GetArrivalRate(), 1e-3)},
+      {"wait_time",
+       json::object{
+           {"avg", to_seconds(snapshot.GetAvgWaitTime())},
+           {"max", to_seconds(snapshot.max_wait_time)}}},
+      {"service_load_erlang", round(snapshot.GetServiceLoadInErlang(), 1e-3)}};
+}
+
+WindowMetricsResponseDto::WindowMetricsResponseDto(SlidingWindowMetrics::Snapshot snapshot)
+    : snapshot(snapshot) {
+}
+
+}  // namespace call_center::repository
@@ -0,0 +1,32 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_WINDOW_METRICS_RESPONSE_DTO_H_
+#define CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_WINDOW_METRICS_RESPONSE_DTO_H_
+
+#include <boost/json.hpp>
+
+#include "core/queueing_system/metrics/sliding_window_metrics.h"
+
+namespace call_center::repository {
+
+namespace json = boost::json;
+
+/**
+ * @brief Ответ на запрос о получении метрик системы за последний промежуток времени.
+ *
+ * Длительности задаются в секундах.
+ */
+struct WindowMetricsResponseDto {
+  core::qs::metrics::SlidingWindowMetrics::Snapshot snapshot;
+
+  explicit WindowMetricsResponseDto(core::qs::metrics::SlidingWindowMetrics::Snapshot snapshot);
+
+  /**
+   * @brief Преобразование из объекта в json.
+   */
+  friend void tag_invoke(
+      const json::value_from_tag &, json::value &json, const WindowMetricsResponseDto &dto
+  );
+};
+
+}  // namespace call_center::repository
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_REPOSITORY_METRICS_WINDOW_METRICS_RESPONSE_DTO_H_
@@ -0,0 +1,90 @@
+#include "arrival_source.h"
+
+#include <stdexcept>
+
+namespace call_center::sim {
+
+namespace {
+
+/**
+ * @brief Номер звонящего по порядковому номеру вызова, уникальный в пределах моделирования.
+ */
+PhoneNumber MakePhoneNumber(const size_t index) {
+  /// Номера моделирования начинаются с неиспользуемого кода страны 999.
+  constexpr uint64_t kFirstPhoneNumber = 999'000'000'000'000;
+  return PhoneNumber(kFirstPhoneNumber + index);
+}
+
+}  // namespace
+
+PoissonArrivalSource::PoissonArrivalSource(
+    const double arrival_rate, const size_t count, const uint64_t seed
+)
+    : generator_(seed), distribution_(arrival_rate), count_(count) {
+  if (!(arrival_rate > 0)) {
+    throw std::invalid_argument("Arrival rate must be positive");
+  }
+}
+
+std::optional<Arrival> PoissonArrivalSource::Next() {
+  if (index_ >= count_) {
+    return std::nullopt;
+  }
+  time_ += distribution_(generator_);
+  const auto time =
+      std::chrono::round<Arrival::Duration>(std::chrono::duration<double>(time_));
+  return Arrival{time, MakePhoneNumber(index_++)};
+}
+
+TraceArrivalSource::TraceArrivalSource(std::istream &input) : input_(input) {
+}
+
+std::optional<Arrival> TraceArrivalSource::Next() {
+  std::string line;
+  while (std::getline(input_, line)) {
+    ++line_number_;
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+
+    const auto separator = line.find(';');
+    const auto time_str = line.substr(0, separator);
+    double seconds = 0;
+    size_t parsed = 0;
+    try {
+      seconds = std::stod(time_str, &parsed);
+    } catch (const std::logic_error &) {
+      parsed = 0;
+    }
+    if (parsed == 0 || parsed != time_str.size() || seconds < 0) {
+      throw std::invalid_argument(
+          "Invalid arrival time at line " + std::to_string(line_number_) + ": " + line
+      );
+    }
+
+    const auto time =
+        std::chrono::round<Arrival::Duration>(std::chrono::duration<double>(seconds));
+    if (time < last_time_) {
+      throw std::invalid_argument(
+          "Arrival time decreases at line " + std::to_string(line_number_) + ": " + line
+      );
+    }
+    last_time_ = time;
+
+    const auto phone_str = separator == std::string::npos
+                               ? std::string_view()
+                               : std::string_view(line).substr(separator + 1);
+    const auto phone_number =
+        phone_str.empty() ? MakePhoneNumber(index_) : PhoneNumber::Parse(phone_str);
+    if (!phone_number) {
+      throw std::invalid_argument(
+          "Invalid phone number at line " + std::to_string(line_number_) + ": " + line
+      );
+    }
+    ++index_;
+    return Arrival{time, *phone_number};
+  }
+  return std::nullopt;
+}
+
+}  // namespace call_center::sim
@@ -0,0 +1,93 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_SIM_ARRIVAL_SOURCE_H_
+#define CALL_CENTER_SRC_CALL_CENTER_SIM_ARRIVAL_SOURCE_H_
+
+#include <chrono>
+#include <istream>
+#include <optional>
+#include <random>
+
+#include "phone_number.h"
+
+namespace call_center::sim {
+
+/**
+ * @brief Поступление вызова при моделировании.
+ */
+struct Arrival {
+  using Duration = std::chrono::nanoseconds;
+
+  /// Время поступления от начала моделирования.
+  Duration time{0};
+  PhoneNumber caller_phone_number;
+};
+
+/**
+ * @brief Источник поступлений вызовов, упорядоченных по времени.
+ */
+class ArrivalSource {
+ public:
+  virtual ~ArrivalSource() = default;
+
+  /**
+   * @brief Следующее поступление.
+   * @return std::nullopt - если поступления закончились
+   */
+  virtual std::optional<Arrival> Next() = 0;
+};
+
+/**
+ * @brief Пуассоновский поток вызовов: интервалы между поступлениями распределены
+ * экспоненциально.
+ */
+class PoissonArrivalSource : public ArrivalSource {
+ public:
+  /**
+   * @param arrival_rate интенсивность поступления (вызовов в секунду)
+   * @param count количество вызовов
+   * @param seed начальное значение генератора случайных чисел
+   */
+  PoissonArrivalSource(double arrival_rate, size_t count, uint64_t seed);
+
+  std::optional<Arrival> Next() override;
+
+ private:
+  using Generator = std::mt19937_64;
+  using Distribution = std::exponential_distribution<double>;
+
+  Generator generator_;
+  Distribution distribution_;
+  const size_t count_;
+  size_t index_ = 0;
+  /// Время последнего поступления в секундах.
+  double time_ = 0;
+};
+
+/**
+ * @brief Поток вызовов из записанной трассы.
+ *
+ * Каждая строка трассы: время поступления в секундах от начала и, через ';', необязательный
+ * номер звонящего в формате E.164. Пустые строки и строки, начинающиеся с '#', пропускаются. Время поступлений
+ * не должно убывать.
+ */
+class TraceArrivalSource : public ArrivalSource {
+ public:
+  /**
+   * @param input поток с трассой, должен существовать, пока используется источник
+   */
+  explicit TraceArrivalSource(std::istream &input);
+
+  /**
+   * @throws std::invalid_argument - если строка трассы некорректна
+   */
+  std::optional<Arrival> Next() override;
+
+ private:
+  std::istream &input_;
+  size_t index_ = 0;
+  size_t line_number_ = 0;
+  Arrival::Duration last_time_{0};
+};
+
+}  // namespace call_center::sim
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_SIM_ARRIVAL_SOURCE_H_
@@ -0,0 +1,127 @@
+#include <boost/program_options.hpp>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "configuration/configuration.h"
+#include "journal.h"
+#include "log/logger_provider.h"
+#include "log/severity_level.h"
+#include "log/sink.h"
+#include "simulation.h"
+
+using namespace call_center;
+using namespace call_center::config;
+using namespace call_center::log;
+using namespace call_center::sim;
+
+namespace po = boost::program_options;
+
+namespace {
+
+using Seconds = std::chrono::duration<double>;
+
+void PrintResult(const Simulation::Result &result) {
+  const auto &metrics = result.metrics;
+  const auto to_seconds = [](const auto duration) {
+    return Seconds(duration).count();
+  };
+
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "Calls:                 " << result.call_count << '\n'
+            << "Events:                " << result.event_count << '\n'
+            << "Simulated time:        " << to_seconds(result.simulated_time) << " s\n"
+            << "Wall time:             " << to_seconds(result.wall_time) << " s\n"
+            << "Calls per wall second: " << result.GetCallsPerSecond() << '\n'
+            << "Serviced:              " << metrics.serviced_count << '\n'
+            << "Refused:               " << metrics.dropout_count << '\n'
+            << "Probability of loss:   " << metrics.probability_of_loss << '\n'
+            << "Wait time avg:         " << to_seconds(metrics.wait_time.GetAvg()) << " s\n"
+            << "Wait time p50:         "
+            << to_seconds(metrics.wait_time_histogram.GetPercentile(0.5)) << " s\n"
+            << "Wait time p90:         "
+            << to_seconds(metrics.wait_time_histogram.GetPercentile(0.9)) << " s\n"
+            << "Wait time p99:         "
+            << to_seconds(metrics.wait_time_histogram.GetPercentile(0.99)) << " s\n"
+            << "Service time avg:      " << to_seconds(metrics.service_time.GetAvg()) << " s\n"
+            << "Queue size avg:        " << metrics.queue_size.GetAvg() << '\n'
+            << "Busy operators avg:    " << metrics.busy_server_count.GetAvg() << '\n'
+            << "Service load:          " << metrics.service_load_erlang << " Erl\n";
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  po::options_description description("call-center-sim options");
+  // clang-format off
+  description.add_options()
+      ("help,h", "show this help")
+      ("config,c", po::value<std::string>()->default_value(Configuration::kDefaultFileName),
+       "configuration file of the call center")
+      ("arrival-rate,r", po::value<double>()->default_value(1),
+       "Poisson arrival rate (calls per second)")
+      ("calls,n", po::value<size_t>()->default_value(100000), "number of Poisson arrivals")
+      ("seed,s", po::value<uint64_t>()->default_value(std::mt19937_64::default_seed),
+       "seed of the Poisson arrivals")
+      ("trace,t", po::value<std::string>(),
+       "replay arrivals from the trace file instead of the Poisson arrivals")
+      ("journal,j", "write calls to the journal configured in the configuration file")
+      ("log-file", po::value<std::string>(), "log file (standard output by default)")
+      ("log-level", po::value<std::string>()->default_value("warning"), "log severity level");
+  // clang-format on
+
+  po::variables_map options;
+  try {
+    po::store(po::parse_command_line(argc, argv, description), options);
+    po::notify(options);
+  } catch (const po::error &ex) {
+    std::cerr << ex.what() << '\n' << description;
+    return EXIT_FAILURE;
+  }
+  if (options.count("help")) {
+    std::cout << description;
+    return EXIT_SUCCESS;
+  }
+
+  const auto level = ParseSeverityLevel(options["log-level"].as<std::string>());
+  if (!level) {
+    std::cerr << "Unknown log level: " << options["log-level"].as<std::string>() << '\n';
+    return EXIT_FAILURE;
+  }
+  const auto sink = options.count("log-file")
+                        ? std::make_shared<Sink>(
+                              options["log-file"].as<std::string>(), *level, SIZE_MAX
+                          )
+                        : std::make_shared<Sink>(*level);
+  const LoggerProvider logger_provider(sink);
+  const auto configuration =
+      Configuration::Create(logger_provider, options["config"].as<std::string>());
+
+  std::ifstream trace;
+  std::unique_ptr<ArrivalSource> arrivals;
+  try {
+    if (options.count("trace")) {
+      trace.open(options["trace"].as<std::string>());
+      if (!trace) {
+        std::cerr << "Cannot open trace file: " << options["trace"].as<std::string>() << '\n';
+        return EXIT_FAILURE;
+      }
+      arrivals = std::make_unique<TraceArrivalSource>(trace);
+    } else {
+      arrivals = std::make_unique<PoissonArrivalSource>(
+          options["arrival-rate"].as<double>(),
+          options["calls"].as<size_t>(),
+          options["seed"].as<uint64_t>()
+      );
+    }
+
+    auto journal = options.count("journal") ? std::make_unique<Journal>(configuration) : nullptr;
+    const auto simulation =
+        Simulation::Create(std::move(arrivals), configuration, logger_provider, std::move(journal));
+    PrintResult(simulation->Run());
+  } catch (const std::invalid_argument &ex) {
+    std::cerr << ex.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+#include "simulation.h"
+
+namespace call_center::sim {
+
+using namespace core::qs::metrics;
+
+double Simulation::Result::GetCallsPerSecond() const {
+  const auto seconds = std::chrono::duration<double>(wall_time).count();
+  if (seconds <= 0) {
+    return 0;
+  }
+  return static_cast<double>(call_count) / seconds;
+}
+
+std::shared_ptr<Simulation> Simulation::Create(
+    std::unique_ptr<ArrivalSource> arrivals,
+    std::shared_ptr<config::Configuration> configuration,
+    const log::LoggerProvider &logger_provider,
+    std::unique_ptr<Journal> journal
+) {
+  return std::shared_ptr<Simulation>(new Simulation(
+      std::move(arrivals), std::move(configuration), logger_provider, std::move(journal)
+  ));
+}
+
+Simulation::Simulation(
+    std::unique_ptr<ArrivalSource> arrivals,
+    std::shared_ptr<config::Configuration> configuration,
+    const log::LoggerProvider &logger_provider,
+    std::unique_ptr<Journal> journal
+)
+    : logger_provider_(logger_provider),
+      configuration_(std::move(configuration)),
+      logger_(logger_provider.Get("Simulation")),
+      clock_(std::make_shared<VirtualClock>()),
+      task_manager_(SimulationTaskManager::Create(clock_, logger_provider)),
+      metrics_(QueueingSystemMetrics::Create(task_manager_, configuration_, logger_provider, clock_)
+      ),
+      autoscaler_(
+          OperatorAutoscaler::Create(metrics_, task_manager_, configuration_, logger_provider)
+      ),
+      call_center_(CallCenter::Create(
+          std::move(journal),
+          configuration_,
+          task_manager_,
+          logger_provider,
+          std::make_unique<OperatorSet>(
+              configuration_,
+              [this]() {
+                return Operator::Create(task_manager_, configuration_, logger_provider_);
+              },
+              logger_provider,
+              metrics_,
+              autoscaler_
+          ),
+          std::make_unique<CallQueue>(configuration_, logger_provider),
+          metrics_
+      )),
+      arrivals_(std::move(arrivals)),
+      start_time_(clock_->Now()) {
+}
+
+Simulation::Result Simulation::Run() {
+  logger_->Info() << "Start simulation";
+  const auto wall_start = std::chrono::steady_clock::now();
+  autoscaler_->Start();
+  ScheduleNextArrival();
+
+  Result result;
+  result.event_count = task_manager_->RunWhile([this]() {
+    return !IsDone();
+  });
+  result.wall_time = std::chrono::steady_clock::now() - wall_start;
+  result.simulated_time = clock_->Now() - start_time_;
+  result.call_count = call_count_;
+  result.metrics = metrics_->GetSnapshot();
+
+  autoscaler_->Stop();
+  metrics_->Stop();
+  task_manager_->Stop();
+  logger_->Info() << "Finish simulation: " << result.call_count << " calls, "
+                  << result.event_count << " events";
+  return result;
+}
+
+void Simulation::ScheduleNextArrival() {
+  auto arrival = arrivals_->Next();
+  if (!arrival) {
+    arrivals_done_ = true;
+    return;
+  }
+  task_manager_->PostTaskAt(
+      start_time_ + arrival->time,
+      [simulation = shared_from_this(), arrival = std::move(*arrival)]() {
+        simulation->HandleArrival(arrival);
+        simulation->ScheduleNextArrival();
+      }
+  );
+}
+
+void Simulation::HandleArrival(const Arrival &arrival) {
+  ++call_count_;
+  const auto call = CallDetailedRecord::Create(
+      arrival.caller_phone_number,
+      configuration_,
+      [simulation = weak_from_this()](const CallDetailedRecord &) {
+        if (const auto locked = simulation.lock()) {
+          ++locked->finished_count_;
+        }
+      },
+      clock_
+  );
+  call_center_->PushCall(call);
+}
+
+bool Simulation::IsDone() const {
+  return arrivals_done_ && finished_count_ == call_count_;
+}
+
+}  // namespace call_center::sim
@@ -0,0 +1,105 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_SIM_SIMULATION_H_
+#define CALL_CENTER_SRC_CALL_CENTER_SIM_SIMULATION_H_
+
+#include <chrono>
+#include <memory>
+
+#include "arrival_source.h"
+#include "call_center.h"
+#include "configuration/configuration.h"
+#include "core/queueing_system/metrics/queueing_system_metrics.h"
+#include "log/logger_provider.h"
+#include "operator_autoscaler.h"
+#include "simulation_task_manager.h"
+#include "virtual_clock.h"
+
+namespace call_center::sim {
+
+/**
+ * @brief Моделирование работы центра обработки вызовов без HTTP-сервера.
+ *
+ * Поступления из @link ArrivalSource источника@endlink передаются в настоящие @link CallCenter
+ * @endlink, @link CallQueue @endlink, @link OperatorSet @endlink и @link
+ * core::qs::metrics::QueueingSystemMetrics @endlink, которые работают на @link
+ * SimulationTaskManager менеджере задач моделирования@endlink и @link VirtualClock виртуальных
+ * часах@endlink. Параметры центра (количество операторов, время обслуживания, размер очереди и
+ * т.д.) читаются из той же конфигурации, что и у сервера.
+ */
+class Simulation : public std::enable_shared_from_this<Simulation> {
+ public:
+  using Duration = VirtualClock::Duration;
+
+  /**
+   * @brief Результат моделирования.
+   */
+  struct Result {
+    /// Количество поступивших вызовов.
+    size_t call_count = 0;
+    /// Количество выполненных событий.
+    size_t event_count = 0;
+    /// Модельное время от начала до завершения обработки последнего вызова.
+    Duration simulated_time{0};
+    /// Реальное время моделирования.
+    std::chrono::nanoseconds wall_time{0};
+    core::qs::metrics::QueueingSystemMetrics::Snapshot metrics;
+
+    /**
+     * @brief Количество смоделированных вызовов в секунду реального времени.
+     */
+    [[nodiscard]] double GetCallsPerSecond() const;
+  };
+
+  /**
+   * @param journal журнал вызовов (может быть nullptr, тогда вызовы не журналируются)
+   */
+  static std::shared_ptr<Simulation> Create(
+      std::unique_ptr<ArrivalSource> arrivals,
+      std::shared_ptr<config::Configuration> configuration,
+      const log::LoggerProvider &logger_provider,
+      std::unique_ptr<Journal> journal = nullptr
+  );
+
+  Simulation(const Simulation &other) = delete;
+  Simulation &operator=(const Simulation &other) = delete;
+
+  /**
+   * @brief Выполнить моделирование до завершения обработки всех поступивших вызовов.
+   */
+  Result Run();
+
+ private:
+  const log::LoggerProvider logger_provider_;
+  const std::shared_ptr<config::Configuration> configuration_;
+  const std::unique_ptr<log::Logger> logger_;
+  const std::shared_ptr<VirtualClock> clock_;
+  const std::shared_ptr<SimulationTaskManager> task_manager_;
+  const std::shared_ptr<core::qs::metrics::QueueingSystemMetrics> metrics_;
+  const std::shared_ptr<OperatorAutoscaler> autoscaler_;
+  const std::shared_ptr<CallCenter> call_center_;
+  const std::unique_ptr<ArrivalSource> arrivals_;
+  const VirtualClock::TimePoint start_time_;
+  size_t call_count_ = 0;
+  size_t finished_count_ = 0;
+  bool arrivals_done_ = false;
+
+  Simulation(
+      std::unique_ptr<ArrivalSource> arrivals,
+      std::shared_ptr<config::Configuration> configuration,
+      const log::LoggerProvider &logger_provider,
+      std::unique_ptr<Journal> journal
+  );
+
+  /**
+   * @brief Запланировать следующее поступление вызова.
+   */
+  void ScheduleNextArrival();
+  /**
+   * @brief Передать поступивший вызов в центр обработки вызовов.
+   */
+  void HandleArrival(const Arrival &arrival);
+  [[nodiscard]] bool IsDone() const;
+};
+
+}  // namespace call_center::sim
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_SIM_SIMULATION_H_
@@ -0,0 +1,97 @@
+#include "simulation_task_manager.h"
+
+#include <algorithm>
+
+namespace call_center::sim {
+
+std::shared_ptr<SimulationTaskManager> SimulationTaskManager::Create(
+    std::shared_ptr<VirtualClock> clock, const log::LoggerProvider &logger_provider
+) {
+  return std::shared_ptr<SimulationTaskManager>(
+      new SimulationTaskManager(std::move(clock), logger_provider)
+  );
+}
+
+SimulationTaskManager::SimulationTaskManager(
+    std::shared_ptr<VirtualClock> clock, const log::LoggerProvider &logger_provider
+)
+    : clock_(std::move(clock)), logger_(logger_provider.Get("SimulationTaskManager")) {
+}
+
+void SimulationTaskManager::Start() {
+}
+
+void SimulationTaskManager::Stop() {
+  stopped_ = true;
+  events_.clear();
+}
+
+void SimulationTaskManager::Join() {
+}
+
+boost::asio::io_context &SimulationTaskManager::IoContext() {
+  return io_context_;
+}
+
+void SimulationTaskManager::PostTask(TaskFunction task) {
+  AddEvent(clock_->Now(), std::move(task));
+}
+
+void SimulationTaskManager::PostTaskDelayedImpl(const Duration_t delay, TaskFunction task) {
+  AddEvent(clock_->Now() + std::max(delay, Duration_t::zero()), std::move(task));
+}
+
+void SimulationTaskManager::PostTaskAtImpl(const TimePoint_t time_point, TaskFunction task) {
+  AddEvent(std::max<TimePoint>(time_point, clock_->Now()), std::move(task));
+}
+
+size_t SimulationTaskManager::RunUntil(const TimePoint time) {
+  const auto count = RunWhile([this, time]() {
+    return !events_.empty() && events_.front().time <= time;
+  });
+  clock_->AdvanceTo(time);
+  return count;
+}
+
+bool SimulationTaskManager::RunNextEvent() {
+  if (events_.empty()) {
+    return false;
+  }
+  std::pop_heap(events_.begin(), events_.end(), EventLater());
+  auto event = std::move(events_.back());
+  events_.pop_back();
+
+  clock_->AdvanceTo(event.time);
+  try {
+    event.task();
+  } catch (const std::exception &ex) {
+    logger_->Error() << "Simulation task failed: " << ex.what();
+  }
+  return true;
+}
+
+std::shared_ptr<const VirtualClock> SimulationTaskManager::GetClock() const {
+  return clock_;
+}
+
+size_t SimulationTaskManager::GetPendingTaskCount() const {
+  return events_.size();
+}
+
+void SimulationTaskManager::AddEvent(const TimePoint time, TaskFunction task) {
+  if (stopped_) {
+    return;
+  }
+  events_.push_back({time, next_sequence_++, std::move(task)});
+  std::push_heap(events_.begin(), events_.end(), EventLater());
+}
+
+bool SimulationTaskManager::EventLater::operator()(const Event &first, const Event &second)
+    const {
+  if (first.time != second.time) {
+    return first.time > second.time;
+  }
+  return first.sequence > second.sequence;
+}
+
+}  // namespace call_center::sim
@@ -0,0 +1,108 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_SIM_SIMULATION_TASK_MANAGER_H_
+#define CALL_CENTER_SRC_CALL_CENTER_SIM_SIMULATION_TASK_MANAGER_H_
+
+#include <boost/asio.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "core/tasks/task_manager.h"
+#include "log/logger_provider.h"
+#include "virtual_clock.h"
+
+namespace call_center::sim {
+
+/**
+ * @brief Менеджер задач для дискретно-событийного моделирования.
+ *
+ * Задачи хранятся в очереди событий, упорядоченной по времени выполнения, и выполняются в
+ * вызывающем потоке. Перед выполнением задачи @link VirtualClock виртуальные часы@endlink
+ * переводятся на время ее выполнения, поэтому моделирование не ждет реального времени. Задачи,
+ * запланированные на одно и то же время, выполняются в порядке добавления.
+ */
+class SimulationTaskManager : public core::tasks::TaskManager {
+ public:
+  using TimePoint = VirtualClock::TimePoint;
+
+  static std::shared_ptr<SimulationTaskManager> Create(
+      std::shared_ptr<VirtualClock> clock, const log::LoggerProvider &logger_provider
+  );
+
+  void Start() override;
+  void Stop() override;
+  void Join() override;
+  /**
+   * @brief Не используется при моделировании, задачи ввода-вывода не выполняются.
+   */
+  boost::asio::io_context &IoContext() override;
+  void PostTask(TaskFunction task) override;
+
+  /**
+   * @brief Выполнять события, пока выполняется условие и очередь событий не пуста.
+   * @param condition условие продолжения, проверяется перед каждым событием
+   * @return количество выполненных событий
+   */
+  template <typename Condition>
+  size_t RunWhile(Condition &&condition);
+  /**
+   * @brief Выполнить все события, запланированные не позднее заданного времени, и перевести часы
+   * на это время.
+   * @return количество выполненных событий
+   */
+  size_t RunUntil(TimePoint time);
+  /**
+   * @brief Выполнить ближайшее событие.
+   * @return false - если очередь событий пуста
+   */
+  bool RunNextEvent();
+  [[nodiscard]] std::shared_ptr<const VirtualClock> GetClock() const;
+  /**
+   * @brief Количество запланированных событий.
+   */
+  [[nodiscard]] size_t GetPendingTaskCount() const;
+
+ protected:
+  void PostTaskDelayedImpl(Duration_t delay, TaskFunction task) override;
+  void PostTaskAtImpl(TimePoint_t time_point, TaskFunction task) override;
+
+ private:
+  struct Event {
+    TimePoint time;
+    /// Порядковый номер события для сохранения порядка добавления при равном времени.
+    uint64_t sequence;
+    TaskFunction task;
+  };
+
+  /**
+   * @brief Сравнение для min-кучи событий: ближайшее событие находится в вершине.
+   */
+  struct EventLater {
+    bool operator()(const Event &first, const Event &second) const;
+  };
+
+  const std::shared_ptr<VirtualClock> clock_;
+  const std::unique_ptr<log::Logger> logger_;
+  boost::asio::io_context io_context_;
+  std::vector<Event> events_;
+  uint64_t next_sequence_ = 0;
+  bool stopped_ = false;
+
+  SimulationTaskManager(
+      std::shared_ptr<VirtualClock> clock, const log::LoggerProvider &logger_provider
+  );
+
+  void AddEvent(TimePoint time, TaskFunction task);
+};
+
+template <typename Condition>
+size_t SimulationTaskManager::RunWhile(Condition &&condition) {
+  size_t count = 0;
+  while (condition() && RunNextEvent()) {
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace call_center::sim
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_SIM_SIMULATION_TASK_MANAGER_H_
@@ -0,0 +1,22 @@
+#include "virtual_clock.h"
+
+namespace call_center::sim {
+
+VirtualClock::VirtualClock(const TimePoint start) : start_(start), now_(start) {
+}
+
+VirtualClock::TimePoint VirtualClock::Now() const {
+  return now_;
+}
+
+void VirtualClock::AdvanceTo(const TimePoint time) {
+  if (time > now_) {
+    now_ = time;
+  }
+}
+
+VirtualClock::Duration VirtualClock::GetElapsedTime() const {
+  return now_ - start_;
+}
+
+}  // namespace call_center::sim
@@ -0,0 +1,41 @@
+#ifndef CALL_CENTER_SRC_CALL_CENTER_SIM_VIRTUAL_CLOCK_H_
+#define CALL_CENTER_SRC_CALL_CENTER_SIM_VIRTUAL_CLOCK_H_
+
+#include <chrono>
+
+#include "core/clock_adapter.h"
+
+/// Дискретно-событийное моделирование центра обработки вызовов.
+namespace call_center::sim {
+
+/**
+ * @brief Виртуальные часы для моделирования.
+ *
+ * Время идет только при переводе вперед. В отличие от тестовых часов не защищены мьютексом:
+ * моделирование выполняется в одном потоке.
+ */
+class VirtualClock : public core::ClockAdapter {
+ public:
+  /**
+   * @param start начальное время
+   */
+  explicit VirtualClock(TimePoint start = std::chrono::floor<Duration>(Clock::now()));
+
+  [[nodiscard]] TimePoint Now() const override;
+  /**
+   * @brief Перевести часы вперед на заданное время, перевод назад игнорируется.
+   */
+  void AdvanceTo(TimePoint time);
+  /**
+   * @brief Время, прошедшее с начального.
+   */
+  [[nodiscard]] Duration GetElapsedTime() const;
+
+ private:
+  const TimePoint start_;
+  TimePoint now_;
+};
+
+}  // namespace call_center::sim
+
+#endif  // CALL_CENTER_SRC_CALL_CENTER_SIM_VIRTUAL_CLOCK_H_
@@ -0,0 +1,71 @@
+#include "latency_stats.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace call_center::bench {
+
+void LatencyStats::Distribution::Record(const Duration value) {
+  const auto clamped = std::max(value, Duration::zero());
+  ++buckets[Histogram::GetBucketIndex(clamped.count())];
+  ++count;
+  sum += clamped;
+  min = std::min(min, clamped);
+  max = std::max(max, clamped);
+}
+
+void LatencyStats::Distribution::Merge(const Distribution &other) {
+  for (size_t i = 0; i < buckets.size(); ++i) {
+    buckets[i] += other.buckets[i];
+  }
+  count += other.count;
+  sum += other.sum;
+  min = std::min(min, other.min);
+  max = std::max(max, other.max);
+}
+
+LatencyStats::Duration LatencyStats::Distribution::GetMin() const {
+  return count == 0 ? Duration::zero() : min;
+}
+
+LatencyStats::Duration LatencyStats::Distribution::GetAvg() const {
+  if (count == 0) {
+    return Duration::zero();
+  }
+  return std::chrono::duration_cast<Duration>(sum / count);
+}
+
+LatencyStats::Duration LatencyStats::Distribution::GetPercentile(const double percentile) const {
+  if (count == 0) {
+    return Duration::zero();
+  }
+  const auto rank = std::max(
+      static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 1.0) * count)), uint64_t{1}
+  );
+  uint64_t accumulated = 0;
+  for (size_t i = 0; i < buckets.size(); ++i) {
+    accumulated += buckets[i];
+    if (accumulated >= rank) {
+      return std::min(Duration(Histogram::GetBucketUpperBound(i)), max);
+    }
+  }
+  return max;
+}
+
+void LatencyStats::Record(const std::string &outcome, const Duration latency) {
+  outcomes_[outcome].Record(latency);
+}
+
+const std::map<std::string, LatencyStats::Distribution> &LatencyStats::GetOutcomes() const {
+  return outcomes_;
+}
+
+LatencyStats::Distribution LatencyStats::GetTotal() const {
+  Distribution total;
+  for (const auto &[outcome, distribution] : outcomes_) {
+    total.Merge(distribution);
+  }
+  return total;
+}
+
+}  // namespace call_center::bench
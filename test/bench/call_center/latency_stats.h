@@ -0,0 +1,77 @@
+#ifndef CALL_CENTER_TEST_BENCH_CALL_CENTER_LATENCY_STATS_H_
+#define CALL_CENTER_TEST_BENCH_CALL_CENTER_LATENCY_STATS_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+
+#include "core/queueing_system/metrics/hdr_histogram.h"
+
+/// Нагрузочное тестирование центра обработки вызовов.
+namespace call_center::bench {
+
+/**
+ * @brief Распределения задержек ответов, разделенные по результату запроса.
+ *
+ * Результат запроса - статус вызова из ответа сервера (см. @link CallStatus @endlink) либо
+ * описание ошибки. Значения хранятся в микросекундах в корзинах той же схемы, что и у @link
+ * core::qs::metrics::HdrHistogram @endlink, поэтому относительная погрешность перцентилей не
+ * превышает ~3%. Не является потокобезопасным: генератор нагрузки записывает задержки в одном
+ * потоке.
+ */
+class LatencyStats {
+ public:
+  using Duration = std::chrono::microseconds;
+
+  /**
+   * @brief Распределение задержек.
+   */
+  struct Distribution {
+    using Histogram = core::qs::metrics::HdrHistogram;
+
+    std::array<uint64_t, Histogram::kBucketCount> buckets{};
+    uint64_t count = 0;
+    Duration sum{0};
+    Duration min{std::numeric_limits<Duration::rep>::max()};
+    Duration max{0};
+
+    /**
+     * @brief Добавить новое значение.
+     */
+    void Record(Duration value);
+    /**
+     * @brief Добавить значения из другого распределения.
+     */
+    void Merge(const Distribution &other);
+    [[nodiscard]] Duration GetMin() const;
+    [[nodiscard]] Duration GetAvg() const;
+    /**
+     * @brief Оценка перцентиля сверху (по верхней границе корзины).
+     * @param percentile значение из [0, 1]
+     */
+    [[nodiscard]] Duration GetPercentile(double percentile) const;
+  };
+
+  /**
+   * @brief Добавить задержку запроса с заданным результатом.
+   */
+  void Record(const std::string &outcome, Duration latency);
+  /**
+   * @brief Распределения задержек по результатам запросов.
+   */
+  [[nodiscard]] const std::map<std::string, Distribution> &GetOutcomes() const;
+  /**
+   * @brief Распределение задержек всех запросов.
+   */
+  [[nodiscard]] Distribution GetTotal() const;
+
+ private:
+  std::map<std::string, Distribution> outcomes_;
+};
+
+}  // namespace call_center::bench
+
+#endif  // CALL_CENTER_TEST_BENCH_CALL_CENTER_LATENCY_STATS_H_
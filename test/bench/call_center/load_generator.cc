@@ -0,0 +1,134 @@
+#include "load_generator.h"
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/json.hpp>
+#include <random>
+
+namespace call_center::bench {
+
+namespace beast = core::http::beast;
+namespace http = core::http::http;
+namespace json = boost::json;
+
+namespace {
+
+constexpr auto kCallTarget = "/call";
+
+}  // namespace
+
+double LoadGenerator::Result::GetThroughput() const {
+  const auto seconds = std::chrono::duration<double>(elapsed_time).count();
+  if (seconds <= 0) {
+    return 0;
+  }
+  return static_cast<double>(latency.GetTotal().count) / seconds;
+}
+
+LoadGenerator::LoadGenerator(Options options)
+    : options_(std::move(options)), next_phone_(std::random_device()()) {
+}
+
+LoadGenerator::Result LoadGenerator::Run() {
+  result_ = {};
+  start_time_ = Clock::now();
+  end_time_ = start_time_ + options_.duration;
+  if (options_.mode == Mode::kOpenLoop) {
+    net::co_spawn(io_context_, RunOpenLoop(), net::detached);
+  } else {
+    for (size_t i = 0; i < options_.concurrency; ++i) {
+      net::co_spawn(io_context_, RunClosedLoopClient(), net::detached);
+    }
+  }
+  io_context_.run();
+  io_context_.restart();
+  result_.elapsed_time = Clock::now() - start_time_;
+  return std::move(result_);
+}
+
+net::awaitable<void> LoadGenerator::RunOpenLoop() {
+  const auto executor = co_await net::this_coro::executor;
+  const auto interval = std::chrono::duration<double>(1 / options_.arrival_rate);
+  net::steady_timer timer(executor);
+  for (size_t i = 0;; ++i) {
+    const auto send_time =
+        start_time_ + std::chrono::duration_cast<Clock::duration>(interval * static_cast<double>(i));
+    if (send_time >= end_time_) {
+      co_return;
+    }
+    timer.expires_at(send_time);
+    co_await timer.async_wait(net::use_awaitable);
+    if (in_flight_count_ >= options_.max_in_flight) {
+      ++result_.skipped_count;
+      continue;
+    }
+    net::co_spawn(executor, Call(send_time), net::detached);
+  }
+}
+
+net::awaitable<void> LoadGenerator::RunClosedLoopClient() {
+  while (Clock::now() < end_time_) {
+    co_await Call(Clock::now());
+  }
+}
+
+net::awaitable<void> LoadGenerator::Call(const Clock::time_point start) {
+  ++in_flight_count_;
+  ++result_.sent_count;
+  const auto outcome = co_await SendCall();
+  result_.latency.Record(
+      outcome, std::chrono::duration_cast<LatencyStats::Duration>(Clock::now() - start)
+  );
+  --in_flight_count_;
+}
+
+net::awaitable<std::string> LoadGenerator::SendCall() {
+  beast::tcp_stream stream(co_await net::this_coro::executor);
+  stream.expires_after(options_.request_timeout);
+  beast::error_code ec;
+  co_await stream.async_connect(options_.endpoint, net::redirect_error(net::use_awaitable, ec));
+  if (ec) {
+    co_return kErrorOutcome;
+  }
+
+  http::request<http::string_body> request{http::verb::post, kCallTarget, 11};
+  request.set(http::field::host, options_.endpoint.address().to_string());
+  request.set(http::field::content_type, "application/json");
+  request.body() = json::serialize(json::object{{"phone", NextPhoneNumber()}});
+  request.prepare_payload();
+  co_await http::async_write(stream, request, net::redirect_error(net::use_awaitable, ec));
+  if (ec) {
+    co_return kErrorOutcome;
+  }
+
+  beast::flat_buffer buffer;
+  http::response<http::string_body> response;
+  co_await http::async_read(stream, buffer, response, net::redirect_error(net::use_awaitable, ec));
+  if (ec) {
+    co_return kErrorOutcome;
+  }
+  stream.socket().shutdown(tcp::socket::shutdown_both, ec);
+  if (response.result() != http::status::ok) {
+    co_return "http " + std::to_string(response.result_int());
+  }
+
+  try {
+    const auto body = json::parse(response.body());
+    co_return std::string(body.as_object().at("call_status").as_string());
+  } catch (const std::exception &) {
+    co_return kInvalidResponseOutcome;
+  }
+}
+
+std::string LoadGenerator::NextPhoneNumber() {
+  constexpr uint64_t kNumberCount = 10'000'000'000;
+  const auto number = std::to_string(next_phone_++ % kNumberCount);
+  return "+7" + std::string(10 - number.size(), '0') + number;
+}
+
+}  // namespace call_center::bench
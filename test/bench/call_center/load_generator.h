@@ -0,0 +1,124 @@
+#ifndef CALL_CENTER_TEST_BENCH_CALL_CENTER_LOAD_GENERATOR_H_
+#define CALL_CENTER_TEST_BENCH_CALL_CENTER_LOAD_GENERATOR_H_
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/io_context.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "core/http/http.h"
+#include "latency_stats.h"
+
+namespace call_center::bench {
+
+namespace net = core::http::net;
+using tcp = core::http::tcp;
+
+/**
+ * @brief Генератор HTTP-нагрузки на центр обработки вызовов.
+ *
+ * Отправляет запросы POST /call с уникальными номерами и записывает задержку каждого ответа в
+ * @link LatencyStats @endlink с разделением по статусу вызова. Поддерживает два режима:
+ * - открытый цикл: запросы отправляются с постоянной интенсивностью независимо от ответов, а
+ *   задержка отсчитывается от запланированного момента отправки, поэтому замедление сервера не
+ *   скрывается уменьшением нагрузки;
+ * - замкнутый цикл: заданное количество клиентов, каждый из которых отправляет следующий запрос
+ *   сразу после получения ответа на предыдущий.
+ *
+ * Все запросы выполняются в одном потоке, т.к. ответа на вызов приходится ждать время
+ * обслуживания оператором, а не время обработки запроса.
+ */
+class LoadGenerator {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Режим генерации нагрузки.
+   */
+  enum class Mode {
+    kOpenLoop,   ///< Постоянная интенсивность отправки запросов.
+    kClosedLoop  ///< Постоянное количество одновременных клиентов.
+  };
+
+  /**
+   * @brief Параметры нагрузки.
+   */
+  struct Options {
+    tcp::endpoint endpoint{net::ip::address_v4::loopback(), 8080};
+    Mode mode = Mode::kOpenLoop;
+    /// Интенсивность отправки запросов в открытом цикле (запросов в секунду).
+    double arrival_rate = 10;
+    /// Количество клиентов в замкнутом цикле.
+    size_t concurrency = 10;
+    /// Время, в течение которого отправляются запросы.
+    std::chrono::seconds duration{60};
+    /// Максимальное время ожидания ответа.
+    std::chrono::seconds request_timeout{60};
+    /// Максимальное количество одновременных запросов в открытом цикле, запросы сверх него не
+    /// отправляются и учитываются как пропущенные.
+    size_t max_in_flight = 10000;
+  };
+
+  /**
+   * @brief Результат нагрузки.
+   */
+  struct Result {
+    /// Количество отправленных запросов.
+    size_t sent_count = 0;
+    /// Количество запросов, не отправленных из-за ограничения одновременных запросов.
+    size_t skipped_count = 0;
+    /// Время от начала отправки до получения последнего ответа.
+    Clock::duration elapsed_time{0};
+    LatencyStats latency;
+
+    /**
+     * @brief Количество полученных ответов в секунду.
+     */
+    [[nodiscard]] double GetThroughput() const;
+  };
+
+  /// Результат запроса, завершившегося ошибкой соединения или таймаутом.
+  static constexpr auto kErrorOutcome = "error";
+  /// Результат запроса с ответом, в котором нет статуса вызова.
+  static constexpr auto kInvalidResponseOutcome = "invalid response";
+
+  explicit LoadGenerator(Options options);
+  LoadGenerator(const LoadGenerator &other) = delete;
+  LoadGenerator &operator=(const LoadGenerator &other) = delete;
+
+  /**
+   * @brief Выполнить нагрузку и дождаться ответов на все отправленные запросы.
+   */
+  Result Run();
+
+ private:
+  const Options options_;
+  net::io_context io_context_;
+  Result result_;
+  Clock::time_point start_time_;
+  Clock::time_point end_time_;
+  size_t in_flight_count_ = 0;
+  uint64_t next_phone_ = 0;
+
+  net::awaitable<void> RunOpenLoop();
+  net::awaitable<void> RunClosedLoopClient();
+  /**
+   * @brief Отправить запрос и записать задержку ответа.
+   * @param start момент, от которого отсчитывается задержка
+   */
+  net::awaitable<void> Call(Clock::time_point start);
+  /**
+   * @brief Отправить запрос на обработку вызова.
+   * @return результат запроса: статус вызова, код HTTP-ответа или @link kErrorOutcome @endlink
+   */
+  net::awaitable<std::string> SendCall();
+  /**
+   * @brief Номер звонящего, уникальный в пределах нагрузки.
+   */
+  std::string NextPhoneNumber();
+};
+
+}  // namespace call_center::bench
+
+#endif  // CALL_CENTER_TEST_BENCH_CALL_CENTER_LOAD_GENERATOR_H_
@@ -0,0 +1,115 @@
+#include <boost/program_options.hpp>
+#include <iomanip>
+#include <iostream>
+
+#include "load_generator.h"
+
+using namespace call_center::bench;
+
+namespace po = boost::program_options;
+
+namespace {
+
+void PrintDistribution(const std::string &name, const LatencyStats::Distribution &distribution) {
+  const auto to_ms = [](const LatencyStats::Duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  };
+  std::cout << std::left << std::setw(18) << name << std::right << std::setw(10)
+            << distribution.count;
+  for (const auto value :
+       {distribution.GetMin(),
+        distribution.GetAvg(),
+        distribution.GetPercentile(0.5),
+        distribution.GetPercentile(0.9),
+        distribution.GetPercentile(0.99),
+        distribution.GetPercentile(0.999),
+        distribution.max}) {
+    std::cout << std::setw(12) << to_ms(value);
+  }
+  std::cout << '\n';
+}
+
+void PrintResult(const LoadGenerator::Result &result) {
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "Sent:        " << result.sent_count << '\n'
+            << "Skipped:     " << result.skipped_count << '\n'
+            << "Elapsed:     " << std::chrono::duration<double>(result.elapsed_time).count()
+            << " s\n"
+            << "Throughput:  " << result.GetThroughput() << " responses/s\n\n";
+
+  std::cout << std::left << std::setw(18) << "Latency, ms" << std::right << std::setw(10)
+            << "count";
+  for (const auto *column : {"min", "avg", "p50", "p90", "p99", "p99.9", "max"}) {
+    std::cout << std::setw(12) << column;
+  }
+  std::cout << '\n';
+  for (const auto &[outcome, distribution] : result.latency.GetOutcomes()) {
+    PrintDistribution(outcome, distribution);
+  }
+  PrintDistribution("total", result.latency.GetTotal());
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  po::options_description description("call-center-bench options");
+  // clang-format off
+  description.add_options()
+      ("help,h", "show this help")
+      ("host", po::value<std::string>()->default_value("127.0.0.1"), "address of the call center")
+      ("port,p", po::value<uint16_t>()->default_value(8080), "port of the call center")
+      ("mode,m", po::value<std::string>()->default_value("open"),
+       "open (constant arrival rate) or closed (constant number of clients)")
+      ("rate,r", po::value<double>()->default_value(10), "arrival rate in the open mode (calls per second)")
+      ("concurrency,c", po::value<size_t>()->default_value(10), "number of clients in the closed mode")
+      ("duration,d", po::value<int64_t>()->default_value(60), "duration of sending requests in seconds")
+      ("timeout,t", po::value<int64_t>()->default_value(60), "response timeout in seconds")
+      ("max-in-flight", po::value<size_t>()->default_value(10000),
+       "maximum number of concurrent requests in the open mode");
+  // clang-format on
+
+  po::variables_map values;
+  try {
+    po::store(po::parse_command_line(argc, argv, description), values);
+    po::notify(values);
+  } catch (const po::error &ex) {
+    std::cerr << ex.what() << '\n' << description;
+    return EXIT_FAILURE;
+  }
+  if (values.count("help")) {
+    std::cout << description;
+    return EXIT_SUCCESS;
+  }
+
+  LoadGenerator::Options options;
+  boost::system::error_code ec;
+  const auto address = net::ip::make_address(values["host"].as<std::string>(), ec);
+  if (ec) {
+    std::cerr << "Invalid address: " << values["host"].as<std::string>() << '\n';
+    return EXIT_FAILURE;
+  }
+  options.endpoint = tcp::endpoint(address, values["port"].as<uint16_t>());
+  const auto mode = values["mode"].as<std::string>();
+  if (mode == "open") {
+    options.mode = LoadGenerator::Mode::kOpenLoop;
+  } else if (mode == "closed") {
+    options.mode = LoadGenerator::Mode::kClosedLoop;
+  } else {
+    std::cerr << "Unknown mode: " << mode << '\n';
+    return EXIT_FAILURE;
+  }
+  options.arrival_rate = values["rate"].as<double>();
+  options.concurrency = values["concurrency"].as<size_t>();
+  options.duration = std::chrono::seconds(values["duration"].as<int64_t>());
+  options.request_timeout = std::chrono::seconds(values["timeout"].as<int64_t>());
+  options.max_in_flight = values["max-in-flight"].as<size_t>();
+  if (!(options.arrival_rate > 0) || options.concurrency == 0 ||
+      options.duration <= std::chrono::seconds::zero()) {
+    std::cerr << "Rate, concurrency and duration must be positive\n";
+    return EXIT_FAILURE;
+  }
+
+  LoadGenerator generator(options);
+  PrintResult(generator.Run());
+  return EXIT_SUCCESS;
+}
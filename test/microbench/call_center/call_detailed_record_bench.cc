@@ -0,0 +1,39 @@
+#include "call_detailed_record.h"
+
+#include <benchmark/benchmark.h>
+
+#include "microbench_utils.h"
+
+namespace call_center::microbench {
+
+namespace {
+
+std::shared_ptr<config::Configuration> configuration;
+
+void SetUpCallDetailedRecord(const benchmark::State &) {
+  configuration = CreateConfiguration("call_detailed_record", {});
+}
+
+void TearDownCallDetailedRecord(const benchmark::State &) {
+  configuration.reset();
+}
+
+void BM_CallDetailedRecord_Create(benchmark::State &state) {
+  const PhoneNumber caller_phone_number(70'000'000'000 + state.thread_index());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CallDetailedRecord::Create(
+        caller_phone_number, configuration, [](const CallDetailedRecord &) {}
+    ));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_CallDetailedRecord_Create)
+    ->Setup(SetUpCallDetailedRecord)
+    ->Teardown(TearDownCallDetailedRecord)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+
+}  // namespace call_center::microbench
@@ -0,0 +1,80 @@
+#include "call_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+
+#include "microbench_utils.h"
+
+namespace call_center::microbench {
+
+namespace {
+
+using CallPtr = std::shared_ptr<CallDetailedRecord>;
+
+std::shared_ptr<config::Configuration> configuration;
+std::unique_ptr<CallQueue> call_queue;
+
+/// Номера вызовов, заполняющих очередь, и вызовов потоков бенчмарка не пересекаются.
+constexpr uint64_t kQueuedPhoneNumber = 70'000'000'000;
+constexpr uint64_t kThreadPhoneNumber = 79'000'000'000;
+
+CallPtr CreateQueuedCall(const uint64_t caller_phone_number) {
+  auto call = std::make_shared<CallDetailedRecord>(
+      PhoneNumber(caller_phone_number), configuration, [](const CallDetailedRecord &) {}
+  );
+  call->SetArrivalTime();
+  return call;
+}
+
+/**
+ * @brief Создать очередь и заполнить ее state.range(0) вызовами.
+ */
+void SetUpCallQueue(const benchmark::State &state) {
+  configuration = CreateConfiguration(
+      "call_queue", {{CallQueue::kCapacityKey, std::numeric_limits<uint32_t>::max()}}
+  );
+  call_queue = std::make_unique<CallQueue>(configuration, GetLoggerProvider());
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    call_queue->PushToQueue(CreateQueuedCall(kQueuedPhoneNumber + i));
+  }
+}
+
+void TearDownCallQueue(const benchmark::State &) {
+  call_queue.reset();
+  configuration.reset();
+}
+
+/**
+ * @brief Поток добавляет удерживаемый вызов и извлекает из очереди другой, который добавит на
+ * следующей итерации, поэтому размер очереди остается равным state.range(0).
+ */
+void BM_CallQueue_PushPop(benchmark::State &state) {
+  auto call = CreateQueuedCall(kThreadPhoneNumber + state.thread_index());
+  for (auto _ : state) {
+    if (call_queue->PushToQueue(call) != CallQueue::PushResult::kOk) {
+      state.SkipWithError("Call must be pushed to queue");
+      break;
+    }
+    call = call_queue->PopFromQueue();
+    if (!call) {
+      state.SkipWithError("Queue must not be empty");
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_CallQueue_PushPop)
+    ->Setup(SetUpCallQueue)
+    ->Teardown(TearDownCallQueue)
+    ->ArgName("queue_size")
+    ->Arg(0)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+
+}  // namespace call_center::microbench
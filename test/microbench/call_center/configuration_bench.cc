@@ -0,0 +1,47 @@
+#include "configuration/configuration.h"
+
+#include <benchmark/benchmark.h>
+
+#include "microbench_utils.h"
+
+namespace call_center::microbench {
+
+namespace {
+
+constexpr auto kPropertyKey = "operator_count";
+
+std::shared_ptr<config::Configuration> configuration;
+
+/**
+ * @brief Создать конфигурацию с кешированием значений, если state.range(0) не равен 0.
+ */
+void SetUpConfiguration(const benchmark::State &state) {
+  configuration = CreateConfiguration(
+      "configuration",
+      {{config::Configuration::kCachingKey, state.range(0) != 0}, {kPropertyKey, 10}}
+  );
+}
+
+void TearDownConfiguration(const benchmark::State &) {
+  configuration.reset();
+}
+
+void BM_Configuration_GetProperty(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(configuration->GetProperty<uint64_t>(kPropertyKey, 0));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Configuration_GetProperty)
+    ->Setup(SetUpConfiguration)
+    ->Teardown(TearDownConfiguration)
+    ->ArgName("caching")
+    ->Arg(1)
+    ->Arg(0)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+
+}  // namespace call_center::microbench
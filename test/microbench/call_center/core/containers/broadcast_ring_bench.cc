@@ -0,0 +1,55 @@
+#include "core/containers/broadcast_ring.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+namespace call_center::core::containers::microbench {
+
+namespace {
+
+/// Элемент размером с событие обработки вызова.
+struct Item {
+  std::array<uint64_t, 6> words;
+};
+
+constexpr size_t kCapacity = 4096;
+
+/**
+ * @brief Запись из state.threads() потоков в общий буфер: стоимость вызова при конкурирующих
+ * писателях.
+ */
+void BM_BroadcastRing_Publish(benchmark::State &state) {
+  static BroadcastRing<Item> ring(kCapacity);
+  Item item{};
+  for (auto _ : state) {
+    ++item.words[0];
+    ring.Publish(item);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief Чтение пакетами по state.range(0) элементов из заполненного буфера.
+ */
+void BM_BroadcastRing_Read(benchmark::State &state) {
+  BroadcastRing<Item> ring(kCapacity);
+  for (size_t i = 0; i < kCapacity; ++i) {
+    ring.Publish(Item{});
+  }
+  const auto batch_size = static_cast<size_t>(state.range(0));
+  BroadcastRing<Item>::Sequence cursor = 0;
+  for (auto _ : state) {
+    auto result = ring.Read(cursor, batch_size);
+    cursor = result.next == ring.GetHead() ? 0 : result.next;
+    benchmark::DoNotOptimize(result.items.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_BroadcastRing_Publish)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_BroadcastRing_Read)->ArgName("batch")->Arg(1)->Arg(64)->Arg(1000);
+
+}  // namespace call_center::core::containers::microbench
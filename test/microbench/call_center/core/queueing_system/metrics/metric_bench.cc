@@ -0,0 +1,60 @@
+#include "core/queueing_system/metrics/metric.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+#include "core/queueing_system/metrics/atomic_metric.h"
+#include "microbench_utils.h"
+
+namespace call_center::core::qs::metrics::microbench {
+
+namespace {
+
+using namespace call_center::microbench;
+using Duration = std::chrono::milliseconds;
+
+std::unique_ptr<AtomicMetric<Duration>> atomic_metric;
+
+void SetUpAtomicMetric(const benchmark::State &) {
+  atomic_metric = std::make_unique<AtomicMetric<Duration>>(Duration::zero());
+}
+
+void TearDownAtomicMetric(const benchmark::State &) {
+  atomic_metric.reset();
+}
+
+/**
+ * @brief Добавление значений в собственную метрику каждого потока.
+ */
+void BM_Metric_AddValue(benchmark::State &state) {
+  Metric<Duration> metric(Duration::zero());
+  int64_t value = 0;
+  for (auto _ : state) {
+    metric.AddValue(Duration(++value % 1000));
+  }
+  benchmark::DoNotOptimize(metric.GetAvg());
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief Добавление значений в общую для всех потоков метрику.
+ */
+void BM_AtomicMetric_AddValue(benchmark::State &state) {
+  int64_t value = 0;
+  for (auto _ : state) {
+    atomic_metric->AddValue(Duration(++value % 1000));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Metric_AddValue)->ThreadRange(1, GetMaxThreadCount())->UseRealTime();
+BENCHMARK(BM_AtomicMetric_AddValue)
+    ->Setup(SetUpAtomicMetric)
+    ->Teardown(TearDownAtomicMetric)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+
+}  // namespace call_center::core::qs::metrics::microbench
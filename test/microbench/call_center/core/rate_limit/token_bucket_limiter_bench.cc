@@ -0,0 +1,52 @@
+#include "core/rate_limit/token_bucket_limiter.h"
+
+#include <benchmark/benchmark.h>
+
+#include "microbench_utils.h"
+
+namespace call_center::core::rate_limit::microbench {
+
+namespace {
+
+using namespace call_center::microbench;
+
+std::unique_ptr<TokenBucketLimiter> limiter;
+const TokenBucketLimiter::Settings settings{.rate = 10, .burst = 20};
+
+void SetUpTokenBucketLimiter(const benchmark::State &) {
+  limiter = std::make_unique<TokenBucketLimiter>();
+}
+
+void TearDownTokenBucketLimiter(const benchmark::State &) {
+  limiter.reset();
+}
+
+/**
+ * @brief Обращения к state.range(0) ключам по кругу, каждый поток - к своему набору ключей.
+ */
+void BM_TokenBucketLimiter_TryAcquire(benchmark::State &state) {
+  const auto key_count = static_cast<uint64_t>(state.range(0));
+  const auto first_key = static_cast<uint64_t>(state.thread_index()) * key_count;
+  uint64_t index = 0;
+  for (auto _ : state) {
+    const auto key = first_key + index++ % key_count;
+    benchmark::DoNotOptimize(
+        limiter->TryAcquire(key, settings, TokenBucketLimiter::Clock::now())
+    );
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_TokenBucketLimiter_TryAcquire)
+    ->Setup(SetUpTokenBucketLimiter)
+    ->Teardown(TearDownTokenBucketLimiter)
+    ->ArgName("keys")
+    ->Arg(1)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+
+}  // namespace call_center::core::rate_limit::microbench
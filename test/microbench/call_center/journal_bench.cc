@@ -0,0 +1,47 @@
+#include "journal.h"
+
+#include <benchmark/benchmark.h>
+
+#include <boost/uuid/uuid_generators.hpp>
+
+#include "microbench_utils.h"
+
+namespace call_center::microbench {
+
+namespace {
+
+std::shared_ptr<config::Configuration> configuration;
+
+void SetUpJournal(const benchmark::State &) {
+  configuration = CreateConfiguration("journal", {});
+}
+
+void TearDownJournal(const benchmark::State &) {
+  configuration.reset();
+}
+
+void BM_Journal_FormatCallDetailedRecord(benchmark::State &state) {
+  CallDetailedRecord call(
+      PhoneNumber(70'000'000'000 + state.thread_index()),
+      configuration,
+      [](const CallDetailedRecord &) {}
+  );
+  call.SetArrivalTime();
+  call.StartService(boost::uuids::random_generator()());
+  call.CompleteService(CallStatus::kOk);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Journal::FormatCallDetailedRecord(call));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Journal_FormatCallDetailedRecord)
+    ->Setup(SetUpJournal)
+    ->Teardown(TearDownJournal)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+
+}  // namespace call_center::microbench
@@ -0,0 +1,55 @@
+#include "log/logger.h"
+
+#include <benchmark/benchmark.h>
+
+#include "microbench_utils.h"
+
+namespace call_center::log::microbench {
+
+namespace {
+
+using namespace call_center::microbench;
+
+std::unique_ptr<Logger> logger;
+
+/**
+ * @brief Создать логер, приемник которого пропускает только предупреждения и более важные записи.
+ */
+void SetUpLogger(const benchmark::State &) {
+  logger = std::make_unique<Logger>("microbench", CreateNullSink(SeverityLevel::kWarning));
+}
+
+void TearDownLogger(const benchmark::State &) {
+  logger.reset();
+}
+
+void BM_Logger_Filtered(benchmark::State &state) {
+  int64_t value = 0;
+  for (auto _ : state) {
+    logger->Debug() << "Filtered record " << ++value;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Logger_Emitted(benchmark::State &state) {
+  int64_t value = 0;
+  for (auto _ : state) {
+    logger->Warning() << "Emitted record " << ++value;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Logger_Filtered)
+    ->Setup(SetUpLogger)
+    ->Teardown(TearDownLogger)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+BENCHMARK(BM_Logger_Emitted)
+    ->Setup(SetUpLogger)
+    ->Teardown(TearDownLogger)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+
+}  // namespace call_center::log::microbench
@@ -0,0 +1,64 @@
+#include "microbench_utils.h"
+
+#include <algorithm>
+#include <boost/log/expressions.hpp>
+#include <filesystem>
+#include <fstream>
+#include <streambuf>
+#include <thread>
+
+namespace call_center::microbench {
+
+namespace {
+
+constexpr auto kConfigsDir = "microbench/configs";
+
+/**
+ * @brief Буфер потока, отбрасывающий все записанные символы.
+ */
+class NullBuffer : public std::streambuf {
+ protected:
+  int_type overflow(const int_type ch) override {
+    return traits_type::not_eof(ch);
+  }
+
+  std::streamsize xsputn(const char_type *, const std::streamsize count) override {
+    return count;
+  }
+};
+
+}  // namespace
+
+int GetMaxThreadCount() {
+  return static_cast<int>(std::max(std::thread::hardware_concurrency(), 1U));
+}
+
+std::shared_ptr<log::Sink> CreateNullSink(const log::SeverityLevel level) {
+  static NullBuffer buffer;
+  return std::make_shared<log::Sink>(
+      boost::make_shared<std::ostream>(&buffer),
+      level,
+      [](const boost::log::record_view &rec, boost::log::formatting_ostream &out) {
+        out << rec[boost::log::expressions::smessage];
+      }
+  );
+}
+
+const log::LoggerProvider &GetLoggerProvider() {
+  static const log::LoggerProvider logger_provider(CreateNullSink(log::SeverityLevel::kWarning));
+  return logger_provider;
+}
+
+std::shared_ptr<config::Configuration> CreateConfiguration(
+    const std::string &name, const boost::json::object &properties
+) {
+  std::filesystem::create_directories(kConfigsDir);
+  const auto file_name = std::string(kConfigsDir) + "/" + name + ".json";
+  {
+    std::ofstream config_file(file_name);
+    config_file << serialize(properties);
+  }
+  return config::Configuration::Create(GetLoggerProvider(), file_name);
+}
+
+}  // namespace call_center::microbench
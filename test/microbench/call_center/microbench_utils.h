@@ -0,0 +1,37 @@
+#ifndef CALL_CENTER_TEST_MICROBENCH_CALL_CENTER_MICROBENCH_UTILS_H_
+#define CALL_CENTER_TEST_MICROBENCH_CALL_CENTER_MICROBENCH_UTILS_H_
+
+#include <boost/json.hpp>
+#include <memory>
+#include <string>
+
+#include "configuration/configuration.h"
+#include "log/logger_provider.h"
+#include "log/sink.h"
+
+/// Микробенчмарки основных операций центра обработки вызовов.
+namespace call_center::microbench {
+
+/**
+ * @brief Максимальное количество потоков в бенчмарках: количество потоков в системе.
+ */
+int GetMaxThreadCount();
+/**
+ * @brief Приемник логов, который форматирует записи, но отбрасывает результат.
+ */
+std::shared_ptr<log::Sink> CreateNullSink(log::SeverityLevel level);
+/**
+ * @brief Провайдер логеров, записи которых ниже уровня предупреждения отфильтровываются.
+ */
+const log::LoggerProvider &GetLoggerProvider();
+/**
+ * @brief Создать конфигурацию с заданными свойствами.
+ * @param name имя файла конфигурации в каталоге бенчмарков
+ */
+std::shared_ptr<config::Configuration> CreateConfiguration(
+    const std::string &name, const boost::json::object &properties
+);
+
+}  // namespace call_center::microbench
+
+#endif  // CALL_CENTER_TEST_MICROBENCH_CALL_CENTER_MICROBENCH_UTILS_H_
@@ -0,0 +1,63 @@
+#include "operator_set.h"
+
+#include <benchmark/benchmark.h>
+
+#include "core/tasks/task_manager_impl.h"
+#include "microbench_utils.h"
+
+namespace call_center::microbench {
+
+namespace {
+
+using namespace core::qs::metrics;
+
+std::shared_ptr<config::Configuration> configuration;
+std::shared_ptr<core::tasks::TaskManagerImpl> task_manager;
+std::unique_ptr<OperatorSet> operator_set;
+
+/**
+ * @brief Создать множество из state.range(0) операторов.
+ *
+ * Менеджер задач не запускается: операторы только берутся из множества и возвращаются в него.
+ */
+void SetUpOperatorSet(const benchmark::State &state) {
+  configuration =
+      CreateConfiguration("operator_set", {{OperatorSet::kOperatorCountKey, state.range(0)}});
+  task_manager = core::tasks::TaskManagerImpl::Create(configuration, GetLoggerProvider());
+  operator_set = std::make_unique<OperatorSet>(
+      configuration,
+      [] {
+        return Operator::Create(task_manager, configuration, GetLoggerProvider());
+      },
+      GetLoggerProvider(),
+      QueueingSystemMetrics::Create(task_manager, configuration, GetLoggerProvider())
+  );
+}
+
+void TearDownOperatorSet(const benchmark::State &) {
+  operator_set.reset();
+  task_manager.reset();
+  configuration.reset();
+}
+
+void BM_OperatorSet_EraseInsertFree(benchmark::State &state) {
+  for (auto _ : state) {
+    if (const auto op = operator_set->EraseFree()) {
+      operator_set->InsertFree(op);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_OperatorSet_EraseInsertFree)
+    ->Setup(SetUpOperatorSet)
+    ->Teardown(TearDownOperatorSet)
+    ->ArgName("operator_count")
+    ->Arg(10)
+    ->Arg(1000)
+    ->ThreadRange(1, GetMaxThreadCount())
+    ->UseRealTime();
+
+}  // namespace call_center::microbench
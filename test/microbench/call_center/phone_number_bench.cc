@@ -0,0 +1,42 @@
+#include "phone_number.h"
+
+#include <benchmark/benchmark.h>
+
+#include "microbench_utils.h"
+
+namespace call_center::microbench {
+
+namespace {
+
+constexpr auto kPhoneNumber = "+7 (912) 345-67-89";
+
+void BM_PhoneNumber_Parse(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(PhoneNumber::Parse(kPhoneNumber));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PhoneNumber_Hash(benchmark::State &state) {
+  const auto phone_number = *PhoneNumber::Parse(kPhoneNumber);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::hash<PhoneNumber>()(phone_number));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PhoneNumber_Format(benchmark::State &state) {
+  const auto phone_number = *PhoneNumber::Parse(kPhoneNumber);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(phone_number.Format());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_PhoneNumber_Parse)->ThreadRange(1, GetMaxThreadCount())->UseRealTime();
+BENCHMARK(BM_PhoneNumber_Hash)->ThreadRange(1, GetMaxThreadCount())->UseRealTime();
+BENCHMARK(BM_PhoneNumber_Format)->ThreadRange(1, GetMaxThreadCount())->UseRealTime();
+
+}  // namespace call_center::microbench
@@ -2,6 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_awaitable.hpp>
+
 #include "configuration_adapter.h"
 #include "fake/fake_call_detailed_record.h"
 #include "fake/fake_task_manager.h"
@@ -47,7 +52,7 @@ class CallCenterTest : public testing::Test {
   OperatorSet *operators_;
   CallQueue *call_queue_;
   std::shared_ptr<CallCenter> call_center_;
-  int next_call_index_;
+  uint64_t next_call_index_;
 };
 
 CallCenterTest::CallCenterTest()
@@ -106,7 +111,7 @@ void CallCenterTest::PushCalls(const CallsVector &calls) const {
 
 CallPtr CallCenterTest::CreateUniqueCall() {
   return FakeCallDetailedRecord::Create(
-      clock_, std::to_string(next_call_index_++), configuration_, [](const auto &call) {}
+      clock_, PhoneNumber(next_call_index_++), configuration_, [](const auto &call) {}
   );
 }
 
@@ -247,6 +252,30 @@ TEST_F(CallCenterTest, FullQueue_CallRejectedWithOverload) {
   VerifyCallsResult(overloaded_calls, CallStatus::kOverload, 0s);
 }
 
+TEST_F(CallCenterTest, FullSystem_OverloadedUntilCallsFinished) {
+  const auto operator_delay = 3s;
+  const auto call_max_wait = 10s;
+  constexpr auto operator_count = 2;
+  constexpr auto queue_capacity = 3;
+
+  configuration_adapter_.SetOperatorCount(operator_count);
+  configuration_adapter_.SetOperatorDelay(operator_delay);
+  configuration_adapter_.SetCallMaxWait(call_max_wait);
+  configuration_adapter_.SetCallQueueCapacity(queue_capacity);
+  configuration_adapter_.UpdateConfiguration();
+
+  ASSERT_FALSE(call_center_->IsOverloaded());
+  PushCalls(CreateUniqueCalls(operator_count + queue_capacity - 1));
+  ASSERT_FALSE(call_center_->IsOverloaded());
+  PushCall(CreateUniqueCall());
+  ASSERT_TRUE(call_center_->IsOverloaded());
+
+  task_manager_->AdvanceTime(operator_delay);
+  ASSERT_FALSE(call_center_->IsOverloaded());
+  task_manager_->AdvanceTime(2 * operator_delay);
+  task_manager_->Stop();
+}
+
 TEST_F(CallCenterTest, HasFreeOperators_CallsProcessed) {
   const auto operator_delay = 3s;
   const auto call_max_wait = 10s;
@@ -379,4 +408,164 @@ TEST_F(CallCenterTest, ZeroCallMaxWait_HasFreeOperators_CallsAreOk) {
   VerifyCallsResult(calls, CallStatus::kOk, operator_delay);
 }
 
+TEST_F(CallCenterTest, Submit_ReturnsIdOfFinishedCall) {
+  const auto operator_delay = 3s;
+  configuration_adapter_.SetOperatorCount(1);
+  configuration_adapter_.SetOperatorDelay(operator_delay);
+  configuration_adapter_.UpdateConfiguration();
+
+  std::optional<CallDetailedRecord::Id> finished_id;
+  const auto id = call_center_->Submit(PhoneNumber(1), [&finished_id](const auto &cdr) {
+    finished_id = cdr.GetId();
+  });
+  EXPECT_FALSE(finished_id);
+  task_manager_->AdvanceTime(operator_delay);
+  task_manager_->Stop();
+
+  EXPECT_EQ(id, finished_id);
+}
+
+TEST_F(CallCenterTest, PushCalls_BatchSplitBetweenOperatorsQueueAndRejections) {
+  const auto operator_delay = 3s;
+  const auto call_max_wait = 1s;
+  constexpr auto operator_count = 2;
+  constexpr auto queue_capacity = 2;
+
+  configuration_adapter_.SetOperatorCount(operator_count);
+  configuration_adapter_.SetOperatorDelay(operator_delay);
+  configuration_adapter_.SetCallMaxWait(call_max_wait);
+  configuration_adapter_.SetCallQueueCapacity(queue_capacity);
+  configuration_adapter_.UpdateConfiguration();
+
+  const auto processed_calls = CreateUniqueCalls(operator_count);
+  const auto processed_call_clone = DuplicateCall(processed_calls.front());
+  const auto queued_calls = CreateUniqueCalls(queue_capacity);
+  const auto overloaded_call = CreateUniqueCall();
+
+  CallsVector batch = processed_calls;
+  batch.push_back(processed_call_clone);
+  batch.insert(batch.end(), queued_calls.begin(), queued_calls.end());
+  batch.push_back(overloaded_call);
+  call_center_->PushCalls(batch);
+  EXPECT_EQ(queue_capacity, call_queue_->GetSize());
+  EXPECT_EQ(operator_count, operators_->GetBusyOperatorCount());
+
+  task_manager_->AdvanceTime(operator_delay);
+  task_manager_->Stop();
+
+  VerifyCallsResult(processed_calls, CallStatus::kOk, operator_delay);
+  VerifyCallResult(*processed_call_clone, CallStatus::kAlreadyInQueue, 0s);
+  VerifyCallsResult(queued_calls, CallStatus::kTimeout, call_max_wait);
+  VerifyCallResult(*overloaded_call, CallStatus::kOverload, 0s);
+}
+
+TEST_F(CallCenterTest, ProcessBatch_CallbackToken_CompletedWithRecordsInRequestOrder) {
+  const auto operator_delay = 3s;
+  configuration_adapter_.SetOperatorCount(2);
+  configuration_adapter_.SetOperatorDelay(operator_delay);
+  configuration_adapter_.SetCallMaxWait(10s);
+  configuration_adapter_.UpdateConfiguration();
+
+  std::vector<std::shared_ptr<const CallDetailedRecord>> result;
+  call_center_->ProcessBatch(
+      {PhoneNumber(1), PhoneNumber(2), PhoneNumber(1)},
+      [&result](std::vector<std::shared_ptr<const CallDetailedRecord>> cdrs) {
+        result = std::move(cdrs);
+      }
+  );
+  task_manager_->AdvanceTime(operator_delay);
+  task_manager_->Stop();
+
+  ASSERT_EQ(3, result.size());
+  EXPECT_EQ(PhoneNumber(1), result[0]->GetCallerPhoneNumber());
+  EXPECT_EQ(CallStatus::kOk, result[0]->GetStatus());
+  EXPECT_EQ(PhoneNumber(2), result[1]->GetCallerPhoneNumber());
+  EXPECT_EQ(CallStatus::kOk, result[1]->GetStatus());
+  EXPECT_EQ(PhoneNumber(1), result[2]->GetCallerPhoneNumber());
+  EXPECT_EQ(CallStatus::kAlreadyInQueue, result[2]->GetStatus());
+}
+
+TEST_F(CallCenterTest, ProcessBatch_EmptyBatch_CompletedImmediately) {
+  bool completed = false;
+  call_center_->ProcessBatch({}, [&completed](const auto &cdrs) { completed = cdrs.empty(); });
+  task_manager_->Stop();
+
+  EXPECT_TRUE(completed);
+}
+
+TEST_F(CallCenterTest, Events_LifecycleOfProcessedAndRejectedCalls) {
+  const auto operator_delay = 3s;
+  configuration_adapter_.SetOperatorCount(1);
+  configuration_adapter_.SetOperatorDelay(operator_delay);
+  configuration_adapter_.SetCallQueueCapacity(0);
+  configuration_adapter_.UpdateConfiguration();
+
+  const auto cursor = call_center_->GetEvents().GetHead();
+  const auto processed_call = CreateUniqueCall();
+  const auto rejected_call = CreateUniqueCall();
+  PushCall(processed_call);
+  PushCall(rejected_call);
+  task_manager_->AdvanceTime(operator_delay);
+  task_manager_->Stop();
+
+  const auto result = call_center_->GetEvents().Read(cursor, SIZE_MAX);
+  EXPECT_EQ(0, result.dropped);
+  const std::vector<std::pair<CallEventType, CallPtr>> expected = {
+      {CallEventType::kArrived, processed_call},
+      {CallEventType::kStarted, processed_call},
+      {CallEventType::kArrived, rejected_call},
+      {CallEventType::kRejected, rejected_call},
+      {CallEventType::kFinished, processed_call},
+  };
+  ASSERT_EQ(expected.size(), result.items.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i].first, result.items[i].type) << "Event index: " << i;
+    EXPECT_EQ(expected[i].second->GetId(), result.items[i].call_id) << "Event index: " << i;
+  }
+  EXPECT_EQ(CallStatus::kOverload, result.items[3].status);
+  EXPECT_EQ(CallStatus::kOk, result.items[4].status);
+}
+
+TEST_F(CallCenterTest, Process_CallbackToken_CompletedWithProcessedCall) {
+  const auto operator_delay = 3s;
+  configuration_adapter_.SetOperatorCount(1);
+  configuration_adapter_.SetOperatorDelay(operator_delay);
+  configuration_adapter_.UpdateConfiguration();
+
+  std::shared_ptr<const CallDetailedRecord> result;
+  call_center_->Process(PhoneNumber(1), [&result](std::shared_ptr<const CallDetailedRecord> cdr) {
+    result = std::move(cdr);
+  });
+  task_manager_->AdvanceTime(operator_delay);
+  task_manager_->Stop();
+
+  ASSERT_TRUE(result);
+  EXPECT_EQ(PhoneNumber(1), result->GetCallerPhoneNumber());
+  EXPECT_EQ(CallStatus::kOk, result->GetStatus());
+}
+
+TEST_F(CallCenterTest, Process_Awaitable_CoroutineResumedInItsExecutor) {
+  namespace net = boost::asio;
+  const auto operator_delay = 3s;
+  configuration_adapter_.SetOperatorCount(1);
+  configuration_adapter_.SetOperatorDelay(operator_delay);
+  configuration_adapter_.UpdateConfiguration();
+
+  net::io_context context;
+  std::optional<CallStatus> result;
+  auto process = [this, &result]() -> net::awaitable<void> {
+    const auto cdr = co_await call_center_->Process(PhoneNumber(1), net::use_awaitable);
+    result = cdr->GetStatus();
+  };
+  net::co_spawn(context, process, net::detached);
+  context.poll();
+  task_manager_->AdvanceTime(operator_delay);
+  task_manager_->Stop();
+  ASSERT_FALSE(result) << "The coroutine must be resumed in its own executor.";
+
+  context.restart();
+  context.poll();
+  EXPECT_EQ(CallStatus::kOk, result);
+}
+
 }  // namespace call_center::test
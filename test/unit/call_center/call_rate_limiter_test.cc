@@ -0,0 +1,112 @@
+#include "call_rate_limiter.h"
+
+#include <gtest/gtest.h>
+
+#include "configuration_adapter.h"
+#include "utils.h"
+
+namespace call_center::test {
+
+using namespace call_center::log;
+using namespace call_center::config;
+using namespace call_center::config::test;
+using namespace std::chrono_literals;
+namespace ip = boost::asio::ip;
+
+class CallRateLimiterTest : public testing::Test {
+ public:
+  CallRateLimiterTest();
+
+  const std::string test_name_;
+  const std::string test_group_name_;
+  const LoggerProvider logger_provider_;
+  const std::shared_ptr<Configuration> configuration_;
+  ConfigurationAdapter configuration_adapter_;
+  CallRateLimiter rate_limiter_;
+  const CallRateLimiter::Clock::time_point now_ = CallRateLimiter::Clock::now();
+};
+
+CallRateLimiterTest::CallRateLimiterTest()
+    : test_name_(testing::UnitTest::GetInstance()->current_test_info()->name()),
+      test_group_name_("CallRateLimiterTest"),
+      logger_provider_(std::make_shared<Sink>(
+          test_group_name_ + "/logs/" + test_name_ + ".log", SeverityLevel::kTrace, SIZE_MAX
+      )),
+      configuration_(Configuration::Create(
+          logger_provider_, test_group_name_ + "/configs/" + test_name_ + ".json"
+      )),
+      configuration_adapter_(configuration_),
+      rate_limiter_(configuration_, logger_provider_) {
+  CreateDirForLogs(test_group_name_);
+  CreateDirForConfigs(test_group_name_);
+}
+
+TEST_F(CallRateLimiterTest, Disabled_AllCallsAdmitted) {
+  configuration_adapter_.SetRateLimitEnabled(false);
+  configuration_adapter_.SetClientRateLimit(1, 1);
+  configuration_adapter_.UpdateConfiguration();
+
+  const auto client = ip::make_address("10.0.0.1");
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(rate_limiter_.AdmitClient(client, now_));
+  }
+}
+
+TEST_F(CallRateLimiterTest, ClientRateExceeded_CallsRejectedUntilRefill) {
+  configuration_adapter_.SetRateLimitEnabled(true);
+  configuration_adapter_.SetClientRateLimit(1, 2);
+  configuration_adapter_.UpdateConfiguration();
+
+  const auto client = ip::make_address("10.0.0.1");
+  ASSERT_TRUE(rate_limiter_.AdmitClient(client, now_));
+  ASSERT_TRUE(rate_limiter_.AdmitClient(client, now_));
+  ASSERT_FALSE(rate_limiter_.AdmitClient(client, now_));
+  ASSERT_TRUE(rate_limiter_.AdmitClient(ip::make_address("10.0.0.2"), now_));
+  ASSERT_TRUE(rate_limiter_.AdmitClient(client, now_ + 1s));
+}
+
+TEST_F(CallRateLimiterTest, BatchBiggerThanClientBurst_PartlyAdmitted) {
+  configuration_adapter_.SetRateLimitEnabled(true);
+  configuration_adapter_.SetClientRateLimit(1, 3);
+  configuration_adapter_.UpdateConfiguration();
+
+  const auto client = ip::make_address("10.0.0.1");
+  ASSERT_TRUE(rate_limiter_.AdmitClient(client, now_));
+  ASSERT_EQ(2, rate_limiter_.AdmitClient(client, 5, now_));
+  ASSERT_EQ(0, rate_limiter_.AdmitClient(client, 5, now_));
+  ASSERT_FALSE(rate_limiter_.AdmitClient(client, now_));
+  ASSERT_EQ(1, rate_limiter_.AdmitClient(client, 5, now_ + 1s));
+}
+
+TEST_F(CallRateLimiterTest, CallerPrefixRateExceeded_SamePrefixRejected) {
+  configuration_adapter_.SetRateLimitEnabled(true);
+  configuration_adapter_.SetCallerRateLimit(8, 1, 2);
+  configuration_adapter_.UpdateConfiguration();
+
+  ASSERT_TRUE(rate_limiter_.AdmitCaller(PhoneNumber(79123450001), now_));
+  ASSERT_TRUE(rate_limiter_.AdmitCaller(PhoneNumber(79123450002), now_));
+  ASSERT_FALSE(rate_limiter_.AdmitCaller(PhoneNumber(79123450003), now_));
+  ASSERT_TRUE(rate_limiter_.AdmitCaller(PhoneNumber(79133450001), now_));
+}
+
+TEST_F(CallRateLimiterTest, MakeClientKey_Ipv6SameNetwork_SameKey) {
+  ASSERT_EQ(
+      CallRateLimiter::MakeClientKey(ip::make_address("2001:db8:1:2::1")),
+      CallRateLimiter::MakeClientKey(ip::make_address("2001:db8:1:2:ffff::2"))
+  );
+  ASSERT_NE(
+      CallRateLimiter::MakeClientKey(ip::make_address("2001:db8:1:2::1")),
+      CallRateLimiter::MakeClientKey(ip::make_address("2001:db8:1:3::1"))
+  );
+  ASSERT_NE(
+      CallRateLimiter::MakeClientKey(ip::make_address("10.0.0.1")),
+      CallRateLimiter::MakeClientKey(ip::make_address("10.0.0.2"))
+  );
+}
+
+TEST_F(CallRateLimiterTest, MakeCallerKey_FirstDigits) {
+  ASSERT_EQ(7912, CallRateLimiter::MakeCallerKey(PhoneNumber(79123456789), 4));
+  ASSERT_EQ(79123456789, CallRateLimiter::MakeCallerKey(PhoneNumber(79123456789), 15));
+}
+
+}  // namespace call_center::test
@@ -0,0 +1,91 @@
+#include "call_result_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <boost/uuid/random_generator.hpp>
+
+#include "configuration_adapter.h"
+#include "utils.h"
+
+namespace call_center::test {
+
+using namespace call_center::log;
+using namespace call_center::config;
+using namespace call_center::config::test;
+
+class CallResultCacheTest : public testing::Test {
+ public:
+  CallResultCacheTest();
+
+  const std::string test_name_;
+  const std::string test_group_name_;
+  const LoggerProvider logger_provider_;
+  const std::shared_ptr<Configuration> configuration_;
+  ConfigurationAdapter configuration_adapter_;
+  CallResultCache cache_;
+  boost::uuids::random_generator generate_id_;
+};
+
+CallResultCacheTest::CallResultCacheTest()
+    : test_name_(testing::UnitTest::GetInstance()->current_test_info()->name()),
+      test_group_name_("CallResultCacheTest"),
+      logger_provider_(std::make_shared<Sink>(
+          test_group_name_ + "/logs/" + test_name_ + ".log", SeverityLevel::kTrace, SIZE_MAX
+      )),
+      configuration_(Configuration::Create(
+          logger_provider_, test_group_name_ + "/configs/" + test_name_ + ".json"
+      )),
+      configuration_adapter_(configuration_),
+      cache_(configuration_) {
+  CreateDirForLogs(test_group_name_);
+  CreateDirForConfigs(test_group_name_);
+}
+
+TEST_F(CallResultCacheTest, PendingCall_CompletedWithStatus) {
+  const auto id = generate_id_();
+  cache_.AddPending(id, PhoneNumber(1));
+
+  auto result = cache_.Find(id);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(PhoneNumber(1), result->phone);
+  EXPECT_FALSE(result->status);
+
+  cache_.Complete(id, PhoneNumber(1), CallStatus::kOk);
+  result = cache_.Find(id);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(CallStatus::kOk, result->status);
+  EXPECT_EQ(1, cache_.GetSize());
+}
+
+TEST_F(CallResultCacheTest, CompletedBeforeAdded_StatusIsNotReset) {
+  const auto id = generate_id_();
+  cache_.Complete(id, PhoneNumber(1), CallStatus::kOverload);
+  cache_.AddPending(id, PhoneNumber(1));
+
+  const auto result = cache_.Find(id);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(CallStatus::kOverload, result->status);
+}
+
+TEST_F(CallResultCacheTest, UnknownCall_NotFound) {
+  EXPECT_FALSE(cache_.Find(generate_id_()));
+}
+
+TEST_F(CallResultCacheTest, CapacityExceeded_OldestResultsEvicted) {
+  constexpr size_t capacity = 3;
+  configuration_adapter_.SetCallResultCacheCapacity(capacity);
+  configuration_adapter_.UpdateConfiguration();
+
+  std::vector<CallResultCache::Id> ids;
+  for (uint64_t i = 1; i <= 2 * capacity; ++i) {
+    ids.push_back(generate_id_());
+    cache_.AddPending(ids.back(), PhoneNumber(i));
+  }
+
+  EXPECT_EQ(capacity, cache_.GetSize());
+  for (size_t i = 0; i < ids.size(); ++i) {
+    EXPECT_EQ(i >= capacity, cache_.Find(ids[i]).has_value()) << "Call index: " << i;
+  }
+}
+
+}  // namespace call_center::test
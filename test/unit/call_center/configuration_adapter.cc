@@ -2,7 +2,11 @@
 
 #include <fstream>
 
+#include "call_center.h"
 #include "call_queue.h"
+#include "call_rate_limiter.h"
+#include "call_result_cache.h"
+#include "repository/call/call_webhook.h"
 
 namespace call_center::config::test {
 
@@ -55,4 +59,34 @@ void ConfigurationAdapter::SetMetricsUpdateTime(
   config_json[metrics::QueueingSystemMetrics::kMetricsUpdateTimeKey] = delay.count();
 }
 
+void ConfigurationAdapter::SetRateLimitEnabled(const bool enabled) {
+  config_json[CallRateLimiter::kEnabledKey] = enabled;
+}
+
+void ConfigurationAdapter::SetClientRateLimit(const double rate, const double burst) {
+  config_json[CallRateLimiter::kClientRateKey] = rate;
+  config_json[CallRateLimiter::kClientBurstKey] = burst;
+}
+
+void ConfigurationAdapter::SetCallerRateLimit(
+    const size_t prefix_length, const double rate, const double burst
+) {
+  config_json[CallRateLimiter::kCallerPrefixLengthKey] = prefix_length;
+  config_json[CallRateLimiter::kCallerRateKey] = rate;
+  config_json[CallRateLimiter::kCallerBurstKey] = burst;
+}
+
+void ConfigurationAdapter::SetCallResultCacheCapacity(const size_t capacity) {
+  config_json[CallResultCache::kCapacityKey] = capacity;
+}
+
+void ConfigurationAdapter::SetCallWebhook(const uint16_t port, const size_t max_in_flight) {
+  config_json[repository::CallWebhook::kPortKey] = port;
+  config_json[repository::CallWebhook::kMaxInFlightKey] = max_in_flight;
+}
+
+void ConfigurationAdapter::SetEventsBufferSize(const size_t size) {
+  config_json[CallCenter::kEventsBufferSizeKey] = size;
+}
+
 }  // namespace call_center::config::test
@@ -30,6 +30,12 @@ class ConfigurationAdapter {
   void SetOperatorDelay(Operator::DelayDuration delay);
   void SetCallMaxWait(CallDetailedRecord::WaitingDuration max_wait);
   void SetMetricsUpdateTime(metrics::QueueingSystemMetrics::MetricsUpdateDuration delay);
+  void SetRateLimitEnabled(bool enabled);
+  void SetClientRateLimit(double rate, double burst);
+  void SetCallerRateLimit(size_t prefix_length, double rate, double burst);
+  void SetCallResultCacheCapacity(size_t capacity);
+  void SetCallWebhook(uint16_t port, size_t max_in_flight);
+  void SetEventsBufferSize(size_t size);
 
  private:
   const std::shared_ptr<Configuration> configuration_;
@@ -0,0 +1,206 @@
+#include "core/containers/broadcast_ring.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace call_center::core::containers::test {
+
+/// Элемент больше одного слова, чтобы разорванное чтение было заметно.
+struct Item {
+  uint64_t value;
+  uint64_t check;
+  uint32_t tail;
+
+  static Item Make(uint64_t value) {
+    return {.value = value, .check = ~value, .tail = static_cast<uint32_t>(value)};
+  }
+  [[nodiscard]] bool IsConsistent() const {
+    return check == ~value && tail == static_cast<uint32_t>(value);
+  }
+};
+
+TEST(BroadcastRingTest, Capacity_RoundedUpToPowerOfTwo) {
+  EXPECT_EQ(8, BroadcastRing<Item>(5).GetCapacity());
+  EXPECT_EQ(1, BroadcastRing<Item>(0).GetCapacity());
+}
+
+TEST(BroadcastRingTest, ReaderKeepsUp_AllItemsInOrder) {
+  BroadcastRing<Item> ring(8);
+  for (uint64_t i = 0; i < 5; ++i) {
+    ring.Publish(Item::Make(i));
+  }
+
+  const auto result = ring.Read(0, 100);
+  ASSERT_EQ(5, result.items.size());
+  for (uint64_t i = 0; i < 5; ++i) {
+    EXPECT_EQ(i, result.items[i].value);
+  }
+  EXPECT_EQ(5, result.next);
+  EXPECT_EQ(0, result.dropped);
+  EXPECT_TRUE(ring.Read(result.next, 100).items.empty());
+}
+
+TEST(BroadcastRingTest, MaxCount_ReadContinuesFromCursor) {
+  BroadcastRing<Item> ring(8);
+  for (uint64_t i = 0; i < 5; ++i) {
+    ring.Publish(Item::Make(i));
+  }
+
+  const auto first = ring.Read(0, 3);
+  ASSERT_EQ(3, first.items.size());
+  EXPECT_EQ(3, first.next);
+  const auto second = ring.Read(first.next, 3);
+  ASSERT_EQ(2, second.items.size());
+  EXPECT_EQ(3, second.items.front().value);
+  EXPECT_EQ(5, second.next);
+}
+
+TEST(BroadcastRingTest, ReaderLagsBehind_OverwrittenItemsDropped) {
+  BroadcastRing<Item> ring(4);
+  for (uint64_t i = 0; i < 10; ++i) {
+    ring.Publish(Item::Make(i));
+  }
+
+  const auto result = ring.Read(0, 100);
+  EXPECT_EQ(6, result.dropped);
+  ASSERT_EQ(4, result.items.size());
+  EXPECT_EQ(6, result.items.front().value);
+  EXPECT_EQ(10, result.next);
+}
+
+TEST(BroadcastRingTest, CursorAheadOfHead_MovedToHead) {
+  BroadcastRing<Item> ring(4);
+  ring.Publish(Item::Make(0));
+
+  const auto result = ring.Read(100, 100);
+  EXPECT_TRUE(result.items.empty());
+  EXPECT_EQ(1, result.next);
+}
+
+TEST(BroadcastRingTest, ConcurrentReaders_NoTornItems) {
+  constexpr uint64_t kItemCount = 200'000;
+  constexpr size_t kReaderCount = 4;
+  BroadcastRing<Item> ring(64);
+  std::atomic_bool done = false;
+  std::atomic_size_t torn = 0;
+  std::atomic_size_t out_of_order = 0;
+
+  std::vector<std::thread> readers;
+  for (size_t i = 0; i < kReaderCount; ++i) {
+    readers.emplace_back([&]() {
+      BroadcastRing<Item>::Sequence cursor = 0;
+      uint64_t last = 0;
+      bool first = true;
+      while (!done.load() || cursor < ring.GetHead()) {
+        const auto result = ring.Read(cursor, 16);
+        for (const auto &item : result.items) {
+          if (!item.IsConsistent()) {
+            ++torn;
+          }
+          if (!first && item.value <= last) {
+            ++out_of_order;
+          }
+          last = item.value;
+          first = false;
+        }
+        cursor = result.next;
+      }
+    });
+  }
+  for (uint64_t i = 0; i < kItemCount; ++i) {
+    ring.Publish(Item::Make(i));
+  }
+  done = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(0, torn);
+  EXPECT_EQ(0, out_of_order);
+}
+
+TEST(BroadcastRingTest, ConcurrentWriters_AllItemsReadInWriterOrder) {
+  constexpr uint64_t kItemsPerWriter = 50'000;
+  constexpr size_t kWriterCount = 4;
+  BroadcastRing<Item> ring(kItemsPerWriter * kWriterCount);
+  std::atomic_size_t finished_writers = 0;
+  std::vector<Item> read;
+
+  std::thread reader([&]() {
+    BroadcastRing<Item>::Sequence cursor = 0;
+    while (finished_writers.load() < kWriterCount || cursor < ring.GetHead()) {
+      const auto result = ring.Read(cursor, 64);
+      EXPECT_EQ(0, result.dropped);
+      read.insert(read.end(), result.items.begin(), result.items.end());
+      cursor = result.next;
+    }
+  });
+  std::vector<std::thread> writers;
+  for (size_t writer = 0; writer < kWriterCount; ++writer) {
+    writers.emplace_back([&ring, &finished_writers, writer]() {
+      for (uint64_t i = 0; i < kItemsPerWriter; ++i) {
+        ring.Publish(Item::Make(writer * kItemsPerWriter + i));
+      }
+      ++finished_writers;
+    });
+  }
+  for (auto &writer : writers) {
+    writer.join();
+  }
+  reader.join();
+
+  ASSERT_EQ(kItemsPerWriter * kWriterCount, read.size());
+  std::vector<uint64_t> next(kWriterCount, 0);
+  for (const auto &item : read) {
+    ASSERT_TRUE(item.IsConsistent());
+    const auto writer = item.value / kItemsPerWriter;
+    ASSERT_EQ(next[writer], item.value % kItemsPerWriter) << "Items of one writer out of order.";
+    ++next[writer];
+  }
+}
+
+TEST(BroadcastRingTest, ConcurrentWritersOverwrite_NoTornItems) {
+  constexpr uint64_t kItemsPerWriter = 100'000;
+  constexpr size_t kWriterCount = 4;
+  BroadcastRing<Item> ring(16);
+  std::atomic_size_t finished_writers = 0;
+  std::atomic_size_t torn = 0;
+  uint64_t read_count = 0;
+  uint64_t dropped_count = 0;
+
+  std::thread reader([&]() {
+    BroadcastRing<Item>::Sequence cursor = 0;
+    while (finished_writers.load() < kWriterCount || cursor < ring.GetHead()) {
+      const auto result = ring.Read(cursor, 8);
+      for (const auto &item : result.items) {
+        if (!item.IsConsistent()) {
+          ++torn;
+        }
+      }
+      read_count += result.items.size();
+      dropped_count += result.dropped;
+      cursor = result.next;
+    }
+  });
+  std::vector<std::thread> writers;
+  for (size_t writer = 0; writer < kWriterCount; ++writer) {
+    writers.emplace_back([&ring, &finished_writers, writer]() {
+      for (uint64_t i = 0; i < kItemsPerWriter; ++i) {
+        ring.Publish(Item::Make(writer * kItemsPerWriter + i));
+      }
+      ++finished_writers;
+    });
+  }
+  for (auto &writer : writers) {
+    writer.join();
+  }
+  reader.join();
+
+  EXPECT_EQ(0, torn);
+  EXPECT_EQ(kItemsPerWriter * kWriterCount, read_count + dropped_count);
+}
+
+}  // namespace call_center::core::containers::test
@@ -0,0 +1,45 @@
+#include "core/instrumentation/allocation_stats.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+
+#include "core/instrumentation/instrumented_mutex.h"
+
+namespace call_center::core::instrumentation::test {
+
+TEST(AllocationStatsTest, Record_CountsAndBytes) {
+  const auto before = AllocationStats::GetSnapshot();
+  AllocationStats::RecordAllocation(100);
+  AllocationStats::RecordAllocation(28);
+  AllocationStats::RecordDeallocation();
+  const auto after = AllocationStats::GetSnapshot();
+
+  ASSERT_EQ(before.allocation_count + 2, after.allocation_count);
+  ASSERT_EQ(before.deallocation_count + 1, after.deallocation_count);
+  ASSERT_EQ(before.allocated_bytes + 128, after.allocated_bytes);
+}
+
+TEST(AllocationStatsTest, GetLiveCount_NotBelowZero) {
+  const AllocationStats::Snapshot live{.allocation_count = 5, .deallocation_count = 3};
+  ASSERT_EQ(2, live.GetLiveCount());
+  const AllocationStats::Snapshot overfreed{.allocation_count = 1, .deallocation_count = 3};
+  ASSERT_EQ(0, overfreed.GetLiveCount());
+}
+
+TEST(AllocationStatsTest, New_CountedWhenInstrumentationEnabled) {
+  if (!kEnabled) {
+    GTEST_SKIP() << "Global operator new is replaced only with CALL_CENTER_INSTRUMENTATION";
+  }
+  const auto before = AllocationStats::GetSnapshot();
+  auto buffer = std::make_unique<std::array<char, 1000>>();
+  buffer.reset();
+  const auto after = AllocationStats::GetSnapshot();
+
+  ASSERT_LE(before.allocation_count + 1, after.allocation_count);
+  ASSERT_LE(before.deallocation_count + 1, after.deallocation_count);
+  ASSERT_LE(before.allocated_bytes + 1000, after.allocated_bytes);
+}
+
+}  // namespace call_center::core::instrumentation::test
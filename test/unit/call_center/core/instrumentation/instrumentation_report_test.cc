@@ -0,0 +1,65 @@
+#include "core/instrumentation/instrumentation_report.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "core/instrumentation/instrumented_mutex.h"
+
+namespace call_center::core::instrumentation::test {
+
+using namespace std::chrono_literals;
+
+InstrumentationReport MakeReport() {
+  return {
+      .enabled = true,
+      .call_count = 4,
+      .allocations = {.allocation_count = 8, .deallocation_count = 6, .allocated_bytes = 400},
+      .locks = {
+          {.name = "CallQueue",
+           .acquire_count = 10,
+           .contended_count = 2,
+           .wait_time = 3us,
+           .max_wait_time = 2us,
+           .hold_time = 7us,
+           .max_hold_time = 4us}
+      }
+  };
+}
+
+TEST(InstrumentationReportTest, Collect_EnabledAndCallCount) {
+  const auto report = InstrumentationReport::Collect(42);
+  ASSERT_EQ(kEnabled, report.enabled);
+  ASSERT_EQ(42, report.call_count);
+}
+
+TEST(InstrumentationReportTest, PerCall_DividedByCallCount) {
+  auto report = MakeReport();
+  ASSERT_DOUBLE_EQ(2, report.GetAllocationsPerCall());
+  ASSERT_DOUBLE_EQ(100, report.GetAllocatedBytesPerCall());
+
+  report.call_count = 0;
+  ASSERT_DOUBLE_EQ(0, report.GetAllocationsPerCall());
+  ASSERT_DOUBLE_EQ(0, report.GetAllocatedBytesPerCall());
+}
+
+TEST(InstrumentationReportTest, Output_AllocationsAndLocks) {
+  std::ostringstream out;
+  out << MakeReport();
+  ASSERT_EQ(
+      "calls: 4, allocations: 8 (live: 2, bytes: 400), allocations per call: 2, bytes per call: "
+      "100; lock CallQueue: acquired 10, contended 2, wait 3 us, max wait 2 us, hold 7 us, max "
+      "hold 4 us",
+      out.str()
+  );
+}
+
+TEST(InstrumentationReportTest, Output_Disabled) {
+  auto report = MakeReport();
+  report.enabled = false;
+  std::ostringstream out;
+  out << report;
+  ASSERT_EQ("instrumentation is disabled", out.str());
+}
+
+}  // namespace call_center::core::instrumentation::test
@@ -0,0 +1,71 @@
+#include "core/instrumentation/instrumented_mutex.h"
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <thread>
+
+namespace call_center::core::instrumentation::test {
+
+using namespace std::chrono_literals;
+
+TEST(InstrumentedMutexTest, Uncontended_AcquireWithoutWait) {
+  static constexpr auto kName = "InstrumentedMutexTest.Uncontended";
+  InstrumentedMutex<std::mutex> mutex(kName);
+  {
+    std::lock_guard lock(mutex);
+  }
+  const auto stats = LockRegistry::Get(kName).GetSnapshot();
+  ASSERT_EQ(1, stats.acquire_count);
+  ASSERT_EQ(0, stats.contended_count);
+  ASSERT_EQ(0ns, stats.wait_time);
+}
+
+TEST(InstrumentedMutexTest, Contended_WaitAndHoldRecorded) {
+  static constexpr auto kName = "InstrumentedMutexTest.Contended";
+  static constexpr auto kHoldTime = 50ms;
+  InstrumentedMutex<std::mutex> mutex(kName);
+  std::promise<void> locked;
+  std::thread holder([&mutex, &locked] {
+    std::lock_guard lock(mutex);
+    locked.set_value();
+    std::this_thread::sleep_for(kHoldTime);
+  });
+  locked.get_future().wait();
+  {
+    std::lock_guard lock(mutex);
+  }
+  holder.join();
+
+  const auto stats = LockRegistry::Get(kName).GetSnapshot();
+  ASSERT_EQ(2, stats.acquire_count);
+  ASSERT_EQ(1, stats.contended_count);
+  ASSERT_LT(0ns, stats.wait_time);
+  ASSERT_EQ(stats.wait_time, stats.max_wait_time);
+  ASSERT_LE(kHoldTime, stats.hold_time);
+  ASSERT_LE(kHoldTime, stats.max_hold_time);
+}
+
+TEST(InstrumentedMutexTest, TryLockFailed_NotRecorded) {
+  static constexpr auto kName = "InstrumentedMutexTest.TryLockFailed";
+  InstrumentedMutex<std::mutex> mutex(kName);
+  std::lock_guard lock(mutex);
+  std::thread([&mutex] { ASSERT_FALSE(mutex.try_lock()); }).join();
+
+  const auto stats = LockRegistry::Get(kName).GetSnapshot();
+  ASSERT_EQ(1, stats.acquire_count);
+  ASSERT_EQ(0, stats.contended_count);
+}
+
+TEST(InstrumentedMutexTest, SharedLock_AcquireRecordedWithoutHold) {
+  static constexpr auto kName = "InstrumentedMutexTest.SharedLock";
+  InstrumentedMutex<std::shared_mutex> mutex(kName);
+  {
+    std::shared_lock lock(mutex);
+  }
+  const auto stats = LockRegistry::Get(kName).GetSnapshot();
+  ASSERT_EQ(1, stats.acquire_count);
+  ASSERT_EQ(0ns, stats.hold_time);
+}
+
+}  // namespace call_center::core::instrumentation::test
@@ -0,0 +1,56 @@
+#include "core/instrumentation/lock_stats.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "core/instrumentation/instrumented_mutex.h"
+
+namespace call_center::core::instrumentation::test {
+
+using namespace std::chrono_literals;
+
+TEST(LockStatsTest, RecordAcquireAndRelease_SumsAndMaximums) {
+  LockStats stats("LockStatsTest.Record");
+  stats.RecordAcquire();
+  stats.RecordContendedAcquire(3us);
+  stats.RecordContendedAcquire(1us);
+  stats.RecordRelease(5us);
+  stats.RecordRelease(2us);
+
+  const auto snapshot = stats.GetSnapshot();
+  ASSERT_EQ("LockStatsTest.Record", snapshot.name);
+  ASSERT_EQ(3, snapshot.acquire_count);
+  ASSERT_EQ(2, snapshot.contended_count);
+  ASSERT_EQ(4us, snapshot.wait_time);
+  ASSERT_EQ(3us, snapshot.max_wait_time);
+  ASSERT_EQ(7us, snapshot.hold_time);
+  ASSERT_EQ(5us, snapshot.max_hold_time);
+}
+
+TEST(LockRegistryTest, Get_SameNameSameStats) {
+  ASSERT_EQ(&LockRegistry::Get("LockRegistryTest.A"), &LockRegistry::Get("LockRegistryTest.A"));
+  ASSERT_NE(&LockRegistry::Get("LockRegistryTest.A"), &LockRegistry::Get("LockRegistryTest.B"));
+}
+
+TEST(LockRegistryTest, MutexesWithSameName_StatsMerged) {
+  static constexpr auto kName = "LockRegistryTest.Merged";
+  InstrumentedMutex<std::mutex> first(kName);
+  InstrumentedMutex<std::mutex> second(kName);
+  {
+    std::lock_guard first_lock(first);
+    std::lock_guard second_lock(second);
+  }
+  {
+    std::lock_guard lock(second);
+  }
+
+  const auto snapshot = LockRegistry::GetSnapshot();
+  ASSERT_TRUE(std::ranges::is_sorted(snapshot, {}, &LockStats::Snapshot::name));
+  const auto merged = std::ranges::find(snapshot, kName, &LockStats::Snapshot::name);
+  ASSERT_NE(snapshot.end(), merged);
+  ASSERT_EQ(3, merged->acquire_count);
+  ASSERT_EQ(1, std::ranges::count(snapshot, kName, &LockStats::Snapshot::name));
+}
+
+}  // namespace call_center::core::instrumentation::test
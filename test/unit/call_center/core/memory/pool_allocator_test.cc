@@ -0,0 +1,78 @@
+#include "core/memory/pool_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace call_center::core::memory::test {
+
+TEST(PoolAllocatorTest, FreedBlock_ReusedInSameThread) {
+  PoolAllocator<int64_t> allocator;
+  auto *first = allocator.allocate(1);
+  allocator.deallocate(first, 1);
+  auto *second = allocator.allocate(1);
+  ASSERT_EQ(first, second);
+  allocator.deallocate(second, 1);
+}
+
+TEST(PoolAllocatorTest, AllocateShared_ObjectConstructedAndDestroyed) {
+  auto value = std::make_shared<int>(0);
+  {
+    const auto shared = std::allocate_shared<std::shared_ptr<int>>(PoolAllocator<int>(), value);
+    ASSERT_EQ(2, value.use_count());
+  }
+  ASSERT_EQ(1, value.use_count());
+}
+
+TEST(PoolAllocatorTest, StandardContainers_WorkWithPool) {
+  std::multiset<int, std::less<>, PoolAllocator<int>> multiset;
+  std::unordered_set<int, std::hash<int>, std::equal_to<>, PoolAllocator<int>> set;
+  for (int i = 0; i < 1000; ++i) {
+    multiset.insert(i % 10);
+    set.insert(i);
+  }
+  ASSERT_EQ(100, multiset.count(5));
+  ASSERT_EQ(1000, set.size());
+  for (int i = 0; i < 1000; i += 2) {
+    set.erase(i);
+  }
+  ASSERT_EQ(500, set.size());
+}
+
+TEST(PoolAllocatorTest, BlocksFreedInOtherThread_ReturnedThroughDepot) {
+  using Pool = BlockPool<64>;
+  constexpr size_t kCount = Pool::kMaxCachedBlocks * 4;
+
+  std::vector<void *> blocks;
+  std::thread producer([&blocks]() {
+    for (size_t i = 0; i < kCount; ++i) {
+      blocks.push_back(Pool::Allocate());
+    }
+  });
+  producer.join();
+
+  std::thread consumer([&blocks]() {
+    for (auto *block : blocks) {
+      Pool::Deallocate(block);
+    }
+  });
+  consumer.join();
+
+  const std::set<void *> freed(blocks.begin(), blocks.end());
+  std::thread reuser([&freed]() {
+    std::vector<void *> reused;
+    for (size_t i = 0; i < Pool::kMaxCachedBlocks / 2; ++i) {
+      reused.push_back(Pool::Allocate());
+      ASSERT_TRUE(freed.contains(reused.back()));
+    }
+    for (auto *block : reused) {
+      Pool::Deallocate(block);
+    }
+  });
+  reuser.join();
+}
+
+}  // namespace call_center::core::memory::test
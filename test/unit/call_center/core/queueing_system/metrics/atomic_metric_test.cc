@@ -0,0 +1,75 @@
+#include "core/queueing_system/metrics/atomic_metric.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+namespace call_center::core::qs::metrics::test {
+
+using namespace std::chrono_literals;
+using Duration = std::chrono::milliseconds;
+
+TEST(MetricTest, Merge_SameAsSequentialAdding) {
+  Metric<size_t, double> sequential(0);
+  Metric<size_t, double> first(0);
+  Metric<size_t, double> second(0);
+  for (size_t value = 1; value <= 10; ++value) {
+    sequential.AddValue(value);
+    (value % 3 == 0 ? first : second).AddValue(value);
+  }
+
+  first.Merge(second);
+  EXPECT_EQ(sequential.GetCount(), first.GetCount());
+  EXPECT_EQ(sequential.GetMin(), first.GetMin());
+  EXPECT_EQ(sequential.GetMax(), first.GetMax());
+  EXPECT_DOUBLE_EQ(sequential.GetAvg(), first.GetAvg());
+}
+
+TEST(MetricTest, Merge_EmptyMetric_Unchanged) {
+  Metric<Duration> metric(0ms);
+  metric.AddValue(5ms);
+  metric.Merge(Metric<Duration>(0ms));
+  EXPECT_EQ(1, metric.GetCount());
+  EXPECT_EQ(5ms, metric.GetAvg());
+}
+
+TEST(AtomicMetricTest, Load_SameAsMetric) {
+  AtomicMetric<Duration> atomic_metric(0ms);
+  Metric<Duration> metric(0ms);
+  for (const auto value : {10ms, 30ms, 20ms}) {
+    atomic_metric.AddValue(value);
+    metric.AddValue(value);
+  }
+
+  const auto loaded = atomic_metric.Load();
+  EXPECT_EQ(metric.GetCount(), loaded.GetCount());
+  EXPECT_EQ(metric.GetMin(), loaded.GetMin());
+  EXPECT_EQ(metric.GetMax(), loaded.GetMax());
+  EXPECT_EQ(metric.GetAvg(), loaded.GetAvg());
+  EXPECT_EQ(60ms, atomic_metric.GetSum());
+}
+
+TEST(AtomicMetricTest, AddValue_ConcurrentThreads_NoValuesLost) {
+  constexpr size_t kThreadCount = 8;
+  constexpr size_t kValueCount = 10'000;
+  AtomicMetric<size_t, double> metric(0);
+
+  std::vector<std::jthread> threads;
+  for (size_t i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([&metric, i] {
+      for (size_t value = 1; value <= kValueCount; ++value) {
+        metric.AddValue(value + i);
+      }
+    });
+  }
+  threads.clear();
+
+  const auto loaded = metric.Load();
+  EXPECT_EQ(kThreadCount * kValueCount, loaded.GetCount());
+  EXPECT_EQ(0, loaded.GetMin());
+  EXPECT_EQ(kValueCount + kThreadCount - 1, loaded.GetMax());
+  EXPECT_DOUBLE_EQ((kValueCount + 1) / 2.0 + (kThreadCount - 1) / 2.0, loaded.GetAvg());
+}
+
+}  // namespace call_center::core::qs::metrics::test
@@ -0,0 +1,69 @@
+#include "core/queueing_system/metrics/erlang.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace call_center::core::qs::metrics::erlang::test {
+
+using namespace std::chrono_literals;
+
+TEST(ErlangTest, ErlangBAndC_KnownValues) {
+  EXPECT_NEAR(4.0 / 19, ErlangB(3, 2), 1e-12);
+  EXPECT_NEAR(4.0 / 9, ErlangC(3, 2), 1e-12);
+  EXPECT_DOUBLE_EQ(1, ErlangC(2, 2));
+  EXPECT_DOUBLE_EQ(0, ErlangC(2, 0));
+}
+
+TEST(ErlangTest, PredictErlangC_ServiceLevelAndAverageWait) {
+  const auto prediction = PredictErlangC(3, 2, 180s, 20s);
+  EXPECT_NEAR(4.0 / 9, prediction.wait_probability, 1e-12);
+  EXPECT_NEAR(1 - 4.0 / 9 * std::exp(-20.0 / 180), prediction.service_level, 1e-12);
+  EXPECT_NEAR(4.0 / 9 * 180, prediction.average_wait.count(), 1e-9);
+}
+
+TEST(ErlangTest, PredictErlangC_Overloaded_AllCallsWait) {
+  const auto prediction = PredictErlangC(2, 3, 180s, 20s);
+  EXPECT_DOUBLE_EQ(1, prediction.wait_probability);
+  EXPECT_DOUBLE_EQ(0, prediction.service_level);
+  EXPECT_TRUE(std::isinf(prediction.average_wait.count()));
+}
+
+TEST(ErlangTest, GetRequiredServerCount_MinimalCountReachingTarget) {
+  const auto required = GetRequiredServerCount(10, 180s, 20s, 0.8, 1000);
+  ASSERT_TRUE(required);
+  EXPECT_GE(PredictErlangC(*required, 10, 180s, 20s).service_level, 0.8);
+  EXPECT_LT(PredictErlangC(*required - 1, 10, 180s, 20s).service_level, 0.8);
+  EXPECT_FALSE(GetRequiredServerCount(10, 180s, 20s, 0.8, 10));
+}
+
+TEST(ErlangTest, PredictErlangA_LongPatience_ApproachesErlangC) {
+  const auto prediction = PredictErlangA(3, 2.0 / 180, 180s, 1e9s);
+  EXPECT_NEAR(4.0 / 9, prediction.wait_probability, 1e-6);
+  EXPECT_NEAR(0, prediction.abandonment_probability, 1e-6);
+  EXPECT_NEAR(4.0 / 9 * 180, prediction.average_wait.count(), 1e-2);
+}
+
+TEST(ErlangTest, PredictErlangA_NoPatience_ErlangB) {
+  const auto prediction = PredictErlangA(3, 2.0 / 180, 180s, 0s);
+  EXPECT_NEAR(4.0 / 19, prediction.wait_probability, 1e-12);
+  EXPECT_NEAR(4.0 / 19, prediction.abandonment_probability, 1e-12);
+}
+
+TEST(ErlangTest, PredictErlangA_Overloaded_StableWithAbandonment) {
+  const auto prediction = PredictErlangA(10'000, 12'000.0 / 180, 180s, 30s);
+  EXPECT_NEAR(1, prediction.wait_probability, 1e-6);
+  EXPECT_NEAR(1.0 / 6, prediction.abandonment_probability, 1e-2);
+}
+
+TEST(ErlangTest, LargePool_Stable) {
+  const auto prediction = PredictErlangC(10'000, 9'900, 180s, 20s);
+  EXPECT_GT(prediction.wait_probability, 0);
+  EXPECT_LT(prediction.wait_probability, 1);
+  const auto required = GetRequiredServerCount(9'900, 180s, 20s, 0.8, 20'000);
+  ASSERT_TRUE(required);
+  EXPECT_GT(*required, 9'900);
+  EXPECT_LT(*required, 10'100);
+}
+
+}  // namespace call_center::core::qs::metrics::erlang::test
@@ -0,0 +1,45 @@
+#include "core/queueing_system/metrics/ewma_gauge.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace call_center::core::qs::metrics::test {
+
+using namespace std::chrono_literals;
+
+TEST(EwmaGaugeTest, FirstUpdate_ValueSet) {
+  EwmaGauge gauge;
+  gauge.Update(5, 10s);
+  for (const auto average : gauge.Get()) {
+    EXPECT_DOUBLE_EQ(5, average);
+  }
+}
+
+TEST(EwmaGaugeTest, Update_ConvergesWithTimeConstant) {
+  EwmaGauge gauge;
+  gauge.Update(0, 1s);
+  gauge.Update(10, 60s);
+
+  const auto averages = gauge.Get();
+  EXPECT_NEAR(10 * (1 - std::exp(-1.0)), averages[0], 1e-9);
+  EXPECT_NEAR(10 * (1 - std::exp(-1.0 / 5)), averages[1], 1e-9);
+  EXPECT_NEAR(10 * (1 - std::exp(-1.0 / 15)), averages[2], 1e-9);
+}
+
+TEST(EwmaGaugeTest, Update_IndependentOfUpdatePeriod) {
+  EwmaGauge rare;
+  EwmaGauge frequent;
+  rare.Update(0, 1s);
+  frequent.Update(0, 1s);
+
+  rare.Update(10, 60s);
+  for (int i = 0; i < 60; ++i) {
+    frequent.Update(10, 1s);
+  }
+  for (size_t i = 0; i < EwmaGauge::kTimeConstants.size(); ++i) {
+    EXPECT_NEAR(rare.Get()[i], frequent.Get()[i], 1e-9);
+  }
+}
+
+}  // namespace call_center::core::qs::metrics::test
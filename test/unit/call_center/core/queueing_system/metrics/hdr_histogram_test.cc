@@ -0,0 +1,119 @@
+#include "core/queueing_system/metrics/hdr_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+namespace call_center::core::qs::metrics::test {
+
+using namespace std::chrono_literals;
+
+TEST(HdrHistogramTest, BucketBounds_ContainValue) {
+  for (const uint64_t value : {0UL, 1UL, 63UL, 64UL, 65UL, 127UL, 128UL, 1000UL, 123456789UL}) {
+    const auto bucket = HdrHistogram::GetBucketIndex(value);
+    EXPECT_LE(HdrHistogram::GetBucketLowerBound(bucket), value);
+    EXPECT_GE(HdrHistogram::GetBucketUpperBound(bucket), value);
+  }
+  EXPECT_EQ(HdrHistogram::kBucketCount - 1, HdrHistogram::GetBucketIndex(UINT64_MAX));
+}
+
+TEST(HdrHistogramTest, BucketBounds_RelativeErrorBounded) {
+  for (size_t bucket = HdrHistogram::kSubBucketCount; bucket < HdrHistogram::kBucketCount;
+       ++bucket) {
+    const auto lower = HdrHistogram::GetBucketLowerBound(bucket);
+    const auto upper = HdrHistogram::GetBucketUpperBound(bucket);
+    ASSERT_EQ(lower, HdrHistogram::GetBucketUpperBound(bucket - 1) + 1);
+    ASSERT_LE(
+        static_cast<double>(upper - lower) / static_cast<double>(lower),
+        2.0 / HdrHistogram::kSubBucketCount
+    );
+  }
+}
+
+TEST(HdrHistogramTest, GetPercentile_UniformValues) {
+  HdrHistogram histogram;
+  for (int64_t value = 1; value <= 10'000; ++value) {
+    histogram.Record(HdrHistogram::Duration(value));
+  }
+
+  const auto snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(10'000, snapshot.count);
+  EXPECT_EQ(1ms, snapshot.GetMin());
+  EXPECT_EQ(10'000ms, snapshot.max);
+  for (const auto percentile : {0.5, 0.9, 0.99, 0.999}) {
+    const auto expected = percentile * 10'000;
+    EXPECT_NEAR(expected, snapshot.GetPercentile(percentile).count(), expected * 0.035)
+        << "percentile: " << percentile;
+  }
+  EXPECT_EQ(10'000ms, snapshot.GetPercentile(1.0));
+}
+
+TEST(HdrHistogramTest, GetPercentileUpperBound_BucketOfRank) {
+  std::array<uint64_t, HdrHistogram::kBucketCount> buckets{};
+  buckets[HdrHistogram::GetBucketIndex(10)] = 90;
+  buckets[HdrHistogram::GetBucketIndex(1000)] = 10;
+
+  EXPECT_EQ(10, HdrHistogram::GetPercentileUpperBound(buckets, 100, 0.0));
+  EXPECT_EQ(10, HdrHistogram::GetPercentileUpperBound(buckets, 100, 0.9));
+  const auto upper_bound = HdrHistogram::GetPercentileUpperBound(buckets, 100, 0.91);
+  EXPECT_LE(1000, upper_bound);
+  EXPECT_EQ(HdrHistogram::GetBucketIndex(1000), HdrHistogram::GetBucketIndex(upper_bound));
+}
+
+TEST(HdrHistogramTest, Merge_SameAsSingleHistogram) {
+  HdrHistogram single;
+  HdrHistogram first;
+  HdrHistogram second;
+  for (int64_t value = 0; value < 1000; ++value) {
+    single.Record(HdrHistogram::Duration(value * 7));
+    (value % 2 == 0 ? first : second).Record(HdrHistogram::Duration(value * 7));
+  }
+
+  auto merged = first.GetSnapshot();
+  merged.Merge(second.GetSnapshot());
+  const auto expected = single.GetSnapshot();
+  EXPECT_EQ(expected.buckets, merged.buckets);
+  EXPECT_EQ(expected.count, merged.count);
+  EXPECT_EQ(expected.sum, merged.sum);
+  EXPECT_EQ(expected.GetMin(), merged.GetMin());
+  EXPECT_EQ(expected.max, merged.max);
+}
+
+TEST(HdrHistogramTest, Subtract_OnlyNewValuesLeft) {
+  HdrHistogram histogram;
+  for (int64_t value = 0; value < 100; ++value) {
+    histogram.Record(HdrHistogram::Duration(value));
+  }
+  const auto previous = histogram.GetSnapshot();
+  for (int64_t value = 1000; value < 1100; ++value) {
+    histogram.Record(HdrHistogram::Duration(value));
+  }
+
+  auto snapshot = histogram.GetSnapshot();
+  snapshot.Subtract(previous);
+  EXPECT_EQ(100, snapshot.count);
+  EXPECT_NEAR(1050, snapshot.GetPercentile(0.5).count(), 1050 * 0.035);
+  EXPECT_EQ(104'950, snapshot.sum.count());
+}
+
+TEST(HdrHistogramTest, Record_ConcurrentThreads_NoValuesLost) {
+  constexpr size_t kThreadCount = 8;
+  constexpr size_t kValueCount = 10'000;
+  HdrHistogram histogram;
+
+  std::vector<std::jthread> threads;
+  for (size_t i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([&histogram] {
+      for (size_t value = 0; value < kValueCount; ++value) {
+        histogram.Record(HdrHistogram::Duration(value));
+      }
+    });
+  }
+  threads.clear();
+
+  EXPECT_EQ(kThreadCount * kValueCount, histogram.GetSnapshot().count);
+}
+
+}  // namespace call_center::core::qs::metrics::test
@@ -43,7 +43,7 @@ class QueueingSystemMetricsTest : public testing::Test {
   const std::shared_ptr<QueueingSystemMetrics> metrics_;
   std::shared_ptr<CallCenter> call_center_;
   std::shared_ptr<FakeServiceLoader> service_loader_;
-  int next_call_index_;
+  uint64_t next_call_index_;
 };
 
 QueueingSystemMetricsTest::QueueingSystemMetricsTest()
@@ -98,7 +98,7 @@ QueueingSystemMetricsTest::~QueueingSystemMetricsTest() {
 
 CallPtr QueueingSystemMetricsTest::CreateUniqueCall() {
   return FakeCallDetailedRecord::Create(
-      clock_, std::to_string(next_call_index_++), configuration_, [](const auto &call) {}
+      clock_, PhoneNumber(next_call_index_++), configuration_, [](const auto &call) {}
   );
 }
 
@@ -127,6 +127,25 @@ double ExpectedInSystemCount(const double lambda, const int b) {
   return lambda * (ExpectedWaitTime(lambda, b) + b);
 }
 
+TEST_F(QueueingSystemMetricsTest, RemoveServer_IndexReusedAndMetricsRetired) {
+  const auto first = Operator::Create(task_manager_, configuration_, logger_provider_);
+  const auto second = Operator::Create(task_manager_, configuration_, logger_provider_);
+  metrics_->AddServer(first);
+  metrics_->AddServer(second);
+  const auto first_index = first->GetIndex();
+  const auto server_count = metrics_->GetServersMetrics().servers.size();
+  const auto retired_count = metrics_->GetServersMetrics().retired_count;
+
+  metrics_->RemoveServer(first);
+  const auto third = Operator::Create(task_manager_, configuration_, logger_provider_);
+  metrics_->AddServer(third);
+
+  EXPECT_EQ(first_index, third->GetIndex());
+  const auto servers_metrics = metrics_->GetServersMetrics();
+  EXPECT_EQ(server_count, servers_metrics.servers.size());
+  EXPECT_EQ(retired_count + 1, servers_metrics.retired_count);
+}
+
 TEST_F(QueueingSystemMetricsTest, SystemUtilization) {
   constexpr auto call_max_wait = 1000s;
   constexpr auto operator_count = 1;
@@ -175,6 +194,65 @@ TEST_F(QueueingSystemMetricsTest, AverageServiceTime) {
   EXPECT_EQ(service_time.count(), floor<seconds>(metrics_->GetAverageServiceTime()).count());
 }
 
+TEST_F(QueueingSystemMetricsTest, AverageServiceTime_SeveralOperators_NotSummed) {
+  constexpr auto call_max_wait = 1000s;
+  constexpr auto operator_count = 3;
+  constexpr auto queue_capacity = SIZE_MAX;
+  constexpr auto call_count = 100;
+  constexpr auto service_time = 15s;
+  constexpr auto arrival_rate = 0.1;
+  constexpr auto test_time = seconds(static_cast<uint64_t>(call_count / arrival_rate));
+  constexpr auto metrics_update_time = 15s;
+
+  configuration_adapter_.SetOperatorCount(operator_count);
+  configuration_adapter_.SetOperatorDelay(service_time);
+  configuration_adapter_.SetCallMaxWait(call_max_wait);
+  configuration_adapter_.SetCallQueueCapacity(queue_capacity);
+  configuration_adapter_.SetMetricsUpdateTime(metrics_update_time);
+  configuration_adapter_.UpdateConfiguration();
+
+  service_loader_->StartLoading(arrival_rate);
+  task_manager_->AdvanceTime(test_time);
+
+  EXPECT_EQ(service_time.count(), floor<seconds>(metrics_->GetAverageServiceTime()).count());
+  EXPECT_EQ(
+      service_time.count(), floor<seconds>(metrics_->GetSnapshot().service_time.GetAvg()).count()
+  );
+}
+
+TEST_F(QueueingSystemMetricsTest, ProbabilityOfLoss_RefusedFraction) {
+  constexpr auto call_max_wait = 1000s;
+  constexpr auto operator_count = 1;
+  constexpr auto queue_capacity = 1;
+  constexpr size_t call_count = 10;
+  constexpr auto service_time = 15s;
+  constexpr auto metrics_update_time = 15s;
+  // один вызов обслуживается, один ждет в очереди, остальные отклоняются при поступлении
+  constexpr size_t serviced_count = operator_count + queue_capacity;
+  constexpr size_t refused_count = call_count - serviced_count;
+  constexpr auto expected_loss = static_cast<double>(refused_count) / call_count;
+
+  configuration_adapter_.SetOperatorCount(operator_count);
+  configuration_adapter_.SetOperatorDelay(service_time);
+  configuration_adapter_.SetCallMaxWait(call_max_wait);
+  configuration_adapter_.SetCallQueueCapacity(queue_capacity);
+  configuration_adapter_.SetMetricsUpdateTime(metrics_update_time);
+  configuration_adapter_.UpdateConfiguration();
+
+  for (size_t i = 0; i < call_count; ++i) {
+    call_center_->PushCall(CreateUniqueCall());
+  }
+  task_manager_->AdvanceTime(service_time * serviced_count + 1s);
+
+  const auto snapshot = metrics_->GetSnapshot();
+  ASSERT_EQ(call_count, snapshot.arrival_count);
+  ASSERT_EQ(refused_count, snapshot.dropout_count);
+  ASSERT_EQ(serviced_count, snapshot.serviced_count);
+  EXPECT_DOUBLE_EQ(expected_loss, snapshot.probability_of_loss);
+  EXPECT_DOUBLE_EQ(expected_loss, metrics_->GetProbabilityOfLoss());
+  EXPECT_EQ(serviced_count, metrics_->GetServicedCount());
+}
+
 TEST_F(QueueingSystemMetricsTest, AverageRequestsCountInSystem) {
   constexpr auto call_max_wait = 1000s;
   constexpr auto operator_count = 1;
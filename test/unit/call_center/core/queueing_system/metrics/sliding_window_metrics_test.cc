@@ -0,0 +1,62 @@
+#include "core/queueing_system/metrics/sliding_window_metrics.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace call_center::core::qs::metrics::test {
+
+using namespace std::chrono_literals;
+using namespace std::chrono;
+using TimePoint = SlidingWindowMetrics::TimePoint;
+
+class SlidingWindowMetricsTest : public testing::Test {
+ public:
+  const std::unique_ptr<SlidingWindowMetrics> metrics_ = std::make_unique<SlidingWindowMetrics>();
+  const TimePoint start_{hours(1000)};
+};
+
+TEST_F(SlidingWindowMetricsTest, GetSnapshot_OnlyEventsInWindowCounted) {
+  metrics_->RecordArrival(start_);
+  metrics_->RecordArrival(start_ + 30s);
+  metrics_->RecordArrival(start_ + 59s);
+  metrics_->RecordServiceStart(start_ + 59s, 2s);
+  metrics_->RecordServiceStart(start_ + 59s, 4s);
+
+  const auto last_minute = metrics_->GetSnapshot(start_ + 59s, 60s);
+  EXPECT_EQ(3, last_minute.arrival_count);
+  EXPECT_EQ(3s, last_minute.GetAvgWaitTime());
+  EXPECT_EQ(4s, last_minute.max_wait_time);
+  EXPECT_DOUBLE_EQ(3.0 / 60, last_minute.GetArrivalRate());
+
+  const auto last_half_minute = metrics_->GetSnapshot(start_ + 59s, 30s);
+  EXPECT_EQ(2, last_half_minute.arrival_count);
+}
+
+TEST_F(SlidingWindowMetricsTest, GetSnapshot_ServiceLoadInErlang) {
+  for (auto second = 0s; second < 10s; ++second) {
+    metrics_->RecordServiceComplete(start_ + second, 2s);
+  }
+  EXPECT_DOUBLE_EQ(2.0, metrics_->GetSnapshot(start_ + 9s, 10s).GetServiceLoadInErlang());
+}
+
+TEST_F(SlidingWindowMetricsTest, RecordAfterWrap_OldBucketReset) {
+  metrics_->RecordDropout(start_);
+  const auto wrapped = start_ + SlidingWindowMetrics::kMaxWindow;
+  metrics_->RecordDropout(wrapped);
+
+  EXPECT_EQ(1, metrics_->GetSnapshot(wrapped, SlidingWindowMetrics::kMaxWindow).dropout_count);
+  metrics_->RecordDropout(start_);
+  EXPECT_EQ(1, metrics_->GetSnapshot(wrapped, SlidingWindowMetrics::kMaxWindow).dropout_count)
+      << "Events older than the buffer must be ignored.";
+}
+
+TEST_F(SlidingWindowMetricsTest, GetSnapshot_WindowClamped) {
+  EXPECT_EQ(
+      SlidingWindowMetrics::kMaxWindow,
+      metrics_->GetSnapshot(start_, SlidingWindowMetrics::kMaxWindow * 2).window
+  );
+  EXPECT_EQ(SlidingWindowMetrics::kBucketDuration, metrics_->GetSnapshot(start_, 0s).window);
+}
+
+}  // namespace call_center::core::qs::metrics::test
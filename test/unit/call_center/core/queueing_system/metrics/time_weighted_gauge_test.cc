@@ -0,0 +1,49 @@
+#include "core/queueing_system/metrics/time_weighted_gauge.h"
+
+#include <gtest/gtest.h>
+
+namespace call_center::core::qs::metrics::test {
+
+using namespace std::chrono_literals;
+using Duration = TimeWeightedGauge::Duration;
+using TimePoint = TimeWeightedGauge::TimePoint;
+
+TEST(TimeWeightedGaugeTest, GetSnapshot_IntegralOfStepFunction) {
+  const TimePoint start{1000s};
+  TimeWeightedGauge gauge;
+  gauge.Add(start, 2);
+  gauge.Add(start + 10s, -1);
+  gauge.Add(start + 15s, 3);
+
+  const auto snapshot = gauge.GetSnapshot(start + 20s);
+  ASSERT_EQ(4, snapshot.value);
+  ASSERT_EQ(Duration(2 * 10s + 1 * 5s + 4 * 5s).count(), snapshot.integral);
+}
+
+TEST(TimeWeightedGaugeTest, GetAverageSince_ExactTimeAverage) {
+  const TimePoint start{1000s};
+  TimeWeightedGauge gauge;
+  const auto begin = gauge.GetSnapshot(start);
+  gauge.Add(start, 1);
+  gauge.Add(start + 3s, -1);
+
+  const auto end = gauge.GetSnapshot(start + 4s);
+  ASSERT_DOUBLE_EQ(0.75, end.GetAverageSince(begin));
+  ASSERT_DOUBLE_EQ(0, end.GetAverageSince(end));
+}
+
+TEST(TimeWeightedGaugeTest, Merge_SumOfGauges) {
+  const TimePoint start{1000s};
+  TimeWeightedGauge first;
+  TimeWeightedGauge second;
+  first.Add(start, 1);
+  second.Add(start + 1s, 1);
+  second.Add(start + 2s, -1);
+
+  auto snapshot = first.GetSnapshot(start + 2s);
+  snapshot.Merge(second.GetSnapshot(start + 2s));
+  ASSERT_EQ(1, snapshot.value);
+  ASSERT_EQ(Duration(2s + 1s).count(), snapshot.integral);
+}
+
+}  // namespace call_center::core::qs::metrics::test
@@ -0,0 +1,93 @@
+#include "core/rate_limit/token_bucket_limiter.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace call_center::core::rate_limit::test {
+
+using namespace std::chrono_literals;
+using Clock = TokenBucketLimiter::Clock;
+
+class TokenBucketLimiterTest : public ::testing::Test {
+ protected:
+  TokenBucketLimiter limiter_;
+  TokenBucketLimiter::Settings settings_{.rate = 2, .burst = 3, .idle_timeout = 10s};
+  Clock::time_point now_ = Clock::now();
+};
+
+TEST_F(TokenBucketLimiterTest, NewKey_BurstAllowed) {
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(limiter_.TryAcquire(1, settings_, now_)) << i;
+  }
+  ASSERT_FALSE(limiter_.TryAcquire(1, settings_, now_));
+  ASSERT_TRUE(limiter_.TryAcquire(2, settings_, now_)) << "Keys must have separate buckets.";
+}
+
+TEST_F(TokenBucketLimiterTest, EmptyBucket_RefilledWithRate) {
+  for (int i = 0; i < 3; ++i) {
+    limiter_.TryAcquire(1, settings_, now_);
+  }
+  ASSERT_FALSE(limiter_.TryAcquire(1, settings_, now_ + 400ms));
+  ASSERT_TRUE(limiter_.TryAcquire(1, settings_, now_ + 500ms));
+  ASSERT_FALSE(limiter_.TryAcquire(1, settings_, now_ + 500ms));
+  ASSERT_TRUE(limiter_.TryAcquire(1, settings_, now_ + 1s));
+}
+
+TEST_F(TokenBucketLimiterTest, LongPause_RefilledUpToBurst) {
+  for (int i = 0; i < 3; ++i) {
+    limiter_.TryAcquire(1, settings_, now_);
+  }
+  const auto later = now_ + 5s;
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(limiter_.TryAcquire(1, settings_, later)) << i;
+  }
+  ASSERT_FALSE(limiter_.TryAcquire(1, settings_, later));
+}
+
+TEST_F(TokenBucketLimiterTest, AcquireCount_LimitedByTokens) {
+  ASSERT_EQ(2, limiter_.TryAcquire(1, 2, settings_, now_));
+  ASSERT_EQ(1, limiter_.TryAcquire(1, 5, settings_, now_));
+  ASSERT_EQ(0, limiter_.TryAcquire(1, 5, settings_, now_));
+  ASSERT_FALSE(limiter_.TryAcquire(1, settings_, now_));
+  ASSERT_EQ(1, limiter_.TryAcquire(1, 5, settings_, now_ + 500ms));
+}
+
+TEST_F(TokenBucketLimiterTest, IdleBuckets_Evicted) {
+  TokenBucketLimiter limiter(1);
+  constexpr uint64_t kKeyCount = 100;
+  for (uint64_t key = 0; key < kKeyCount; ++key) {
+    limiter.TryAcquire(key, settings_, now_);
+  }
+  ASSERT_EQ(kKeyCount, limiter.GetSize());
+
+  const auto later = now_ + settings_.idle_timeout;
+  for (uint64_t i = 0; i < kKeyCount; ++i) {
+    limiter.TryAcquire(kKeyCount, settings_, later);
+  }
+  ASSERT_EQ(1, limiter.GetSize());
+}
+
+TEST_F(TokenBucketLimiterTest, ConcurrentAcquire_BurstNotExceeded) {
+  constexpr size_t kThreadCount = 8;
+  settings_.burst = 1000;
+  std::atomic_size_t acquired = 0;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreadCount; ++i) {
+    threads.emplace_back([this, &acquired]() {
+      for (int j = 0; j < 1000; ++j) {
+        if (limiter_.TryAcquire(42, settings_, now_)) {
+          ++acquired;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(1000, acquired);
+}
+
+}  // namespace call_center::core::rate_limit::test
@@ -0,0 +1,77 @@
+#include "core/tasks/scheduler_metrics.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace call_center::core::tasks::test {
+
+using namespace std::chrono_literals;
+using namespace std::chrono;
+
+using TaskCategory = SchedulerMetrics::TaskCategory;
+
+TEST(LatencyHistogramTest, Empty_ZeroValues) {
+  const LatencyHistogram histogram;
+  const auto snapshot = histogram.GetSnapshot();
+  ASSERT_EQ(0, snapshot.count);
+  ASSERT_EQ(0ns, snapshot.GetAvg());
+  ASSERT_EQ(0ns, snapshot.GetPercentile(0.99));
+}
+
+TEST(LatencyHistogramTest, Record_PercentilesBoundedByBuckets) {
+  LatencyHistogram histogram;
+  for (int i = 0; i < 90; ++i) {
+    histogram.Record(10us);
+  }
+  for (int i = 0; i < 10; ++i) {
+    histogram.Record(10ms);
+  }
+  const auto snapshot = histogram.GetSnapshot();
+
+  ASSERT_EQ(100, snapshot.count);
+  ASSERT_EQ(10ms, snapshot.max);
+  ASSERT_EQ((90 * 10us + 10 * 10ms) / 100, snapshot.GetAvg());
+  ASSERT_LE(10us, snapshot.GetPercentile(0.5));
+  ASSERT_GT(20us, snapshot.GetPercentile(0.5));
+  ASSERT_GT(20us, snapshot.GetPercentile(0.9));
+  ASSERT_EQ(10ms, snapshot.GetPercentile(0.99));
+}
+
+TEST(SchedulerMetricsTest, RecordTask_CountedInItsCategory) {
+  const auto metrics = SchedulerMetrics::Create();
+  metrics->RecordTask(TaskCategory::kImmediate, 1ms, 2ms);
+  metrics->RecordTask(TaskCategory::kImmediate, 1ms, 2ms);
+  metrics->RecordTask(TaskCategory::kDeferred, 5ms, 1ms);
+
+  const auto snapshot = metrics->GetSnapshot();
+  ASSERT_EQ(SchedulerMetrics::kTaskCategoryCount, snapshot.categories.size());
+  const auto &immediate = snapshot.categories[static_cast<size_t>(TaskCategory::kImmediate)];
+  const auto &delayed = snapshot.categories[static_cast<size_t>(TaskCategory::kDelayed)];
+  const auto &deferred = snapshot.categories[static_cast<size_t>(TaskCategory::kDeferred)];
+  ASSERT_EQ(2, immediate.run_time.count);
+  ASSERT_EQ(2ms, immediate.run_time.max);
+  ASSERT_EQ(0, delayed.run_time.count);
+  ASSERT_EQ(1, deferred.wait_time.count);
+  ASSERT_EQ(5ms, deferred.wait_time.max);
+}
+
+TEST(SchedulerMetricsTest, RegisteredThread_BusyTimeAccounted) {
+  const auto metrics = SchedulerMetrics::Create();
+  std::thread worker([&metrics] {
+    metrics->RegisterCurrentThread();
+    metrics->RecordTask(TaskCategory::kImmediate, 0ms, 300ms);
+    metrics->RecordTask(TaskCategory::kImmediate, 0ms, 200ms);
+    metrics->UnregisterCurrentThread();
+  });
+  worker.join();
+  metrics->RecordTask(TaskCategory::kImmediate, 0ms, 1s);
+
+  const auto snapshot = metrics->GetSnapshot();
+  ASSERT_EQ(1, snapshot.threads.size());
+  ASSERT_EQ(0, snapshot.active_thread_count);
+  ASSERT_FALSE(snapshot.threads[0].active);
+  ASSERT_EQ(500ms, snapshot.threads[0].busy_time);
+}
+
+}  // namespace call_center::core::tasks::test
@@ -0,0 +1,171 @@
+#include "core/tasks/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <future>
+
+#include "log/logger_provider.h"
+#include "log/sink.h"
+#include "utils.h"
+
+namespace call_center::core::tasks::test {
+
+using namespace std::chrono_literals;
+using namespace std::chrono;
+using namespace call_center::test;
+using namespace log;
+
+class ThreadPoolTest : public testing::Test {
+ public:
+  ThreadPoolTest();
+  ~ThreadPoolTest() override;
+
+  /**
+   * @brief Дождаться, пока количество работающих потоков станет равным ожидаемому.
+   */
+  bool WaitRunningThreadCount(size_t expected, milliseconds timeout = 1s) const;
+  /**
+   * @brief Дождаться, пока количество зарегистрированных в метриках потоков станет равным
+   * ожидаемому.
+   */
+  bool WaitActiveThreadCount(size_t expected, milliseconds timeout = 1s) const;
+
+  const std::string test_name_;
+  const std::string test_group_name_;
+  const log::LoggerProvider logger_provider_;
+  boost::asio::io_context context_;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_;
+  const std::shared_ptr<SchedulerMetrics> metrics_;
+  ThreadPool thread_pool_;
+};
+
+ThreadPoolTest::ThreadPoolTest()
+    : test_name_(testing::UnitTest::GetInstance()->current_test_info()->name()),
+      test_group_name_("ThreadPoolTest"),
+      logger_provider_(std::make_shared<Sink>(
+          test_group_name_ + "/logs/" + test_name_ + ".log", SeverityLevel::kTrace, SIZE_MAX
+      )),
+      work_guard_(make_work_guard(context_)),
+      metrics_(SchedulerMetrics::Create()),
+      thread_pool_(context_, metrics_, logger_provider_.Get(test_group_name_)) {
+  CreateDirForLogs(test_group_name_);
+}
+
+ThreadPoolTest::~ThreadPoolTest() {
+  work_guard_.reset();
+  context_.stop();
+  thread_pool_.Join();
+}
+
+bool ThreadPoolTest::WaitRunningThreadCount(const size_t expected, const milliseconds timeout)
+    const {
+  const auto deadline = steady_clock::now() + timeout;
+  while (thread_pool_.GetRunningThreadCount() != expected) {
+    if (steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(5ms);
+  }
+  return true;
+}
+
+bool ThreadPoolTest::WaitActiveThreadCount(const size_t expected, const milliseconds timeout)
+    const {
+  const auto deadline = steady_clock::now() + timeout;
+  while (metrics_->GetSnapshot().active_thread_count != expected) {
+    if (steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(5ms);
+  }
+  return true;
+}
+
+TEST_F(ThreadPoolTest, Resize_ThreadsStartedAndRetired) {
+  thread_pool_.Resize(4);
+  ASSERT_EQ(4, thread_pool_.GetThreadCount());
+  ASSERT_TRUE(WaitRunningThreadCount(4));
+
+  thread_pool_.Resize(1);
+  ASSERT_EQ(1, thread_pool_.GetThreadCount());
+  ASSERT_TRUE(WaitRunningThreadCount(1)) << "Retired threads must finish.";
+  ASSERT_EQ(1, metrics_->GetSnapshot().active_thread_count);
+
+  std::promise<bool> promise;
+  auto result = promise.get_future();
+  boost::asio::post(context_, [&promise] {
+    promise.set_value(true);
+  });
+  ASSERT_EQ(std::future_status::ready, result.wait_for(500ms))
+      << "Remaining thread must execute tasks.";
+}
+
+TEST_F(ThreadPoolTest, Resize_RetiredMetricsReused) {
+  thread_pool_.Resize(2);
+  ASSERT_TRUE(WaitRunningThreadCount(2));
+  thread_pool_.Resize(0);
+  ASSERT_TRUE(WaitRunningThreadCount(0));
+  thread_pool_.Resize(2);
+  ASSERT_TRUE(WaitRunningThreadCount(2));
+  ASSERT_TRUE(WaitActiveThreadCount(2));
+
+  ASSERT_EQ(2, metrics_->GetSnapshot().threads.size());
+}
+
+TEST_F(ThreadPoolTest, ShrinkThenGrow_PendingRetirementsCancelled) {
+  thread_pool_.Resize(4);
+  ASSERT_TRUE(WaitRunningThreadCount(4));
+  // занятые потоки не успевают завершиться до увеличения пула
+  std::promise<void> release;
+  const auto released = release.get_future().share();
+  for (int i = 0; i < 4; ++i) {
+    boost::asio::post(context_, [released] {
+      released.wait();
+    });
+  }
+  thread_pool_.Resize(2);
+  thread_pool_.Resize(4);
+  release.set_value();
+
+  ASSERT_FALSE(WaitRunningThreadCount(3, 200ms)) << "No thread must retire.";
+  ASSERT_EQ(4, thread_pool_.GetRunningThreadCount());
+  ASSERT_EQ(4, thread_pool_.GetThreadCount());
+}
+
+TEST_F(ThreadPoolTest, Join_RetiredThreadsJoined) {
+  thread_pool_.Resize(4);
+  ASSERT_TRUE(WaitActiveThreadCount(4));
+  thread_pool_.Resize(0);
+
+  thread_pool_.Join();
+  ASSERT_EQ(0, thread_pool_.GetRunningThreadCount());
+  ASSERT_EQ(0, metrics_->GetSnapshot().active_thread_count)
+      << "Join must wait for retired threads to finish.";
+}
+
+TEST(ThreadPoolCalculateThreadCountTest, HighQueueDelay_PoolGrows) {
+  ASSERT_EQ(10, ThreadPool::CalculateThreadCount(8, 1, 16, 20ms, 5ms, 0.5));
+  ASSERT_EQ(2, ThreadPool::CalculateThreadCount(1, 1, 16, 20ms, 5ms, std::nullopt));
+  ASSERT_EQ(16, ThreadPool::CalculateThreadCount(16, 1, 16, 20ms, 5ms, 1.0));
+}
+
+TEST(ThreadPoolCalculateThreadCountTest, HighUtilization_PoolGrows) {
+  ASSERT_EQ(9, ThreadPool::CalculateThreadCount(8, 1, 16, 2ms, 5ms, 0.95));
+}
+
+TEST(ThreadPoolCalculateThreadCountTest, Idle_PoolShrinks) {
+  ASSERT_EQ(7, ThreadPool::CalculateThreadCount(8, 1, 16, 0ms, 5ms, 0.1));
+  ASSERT_EQ(7, ThreadPool::CalculateThreadCount(8, 1, 16, 0ms, 5ms, std::nullopt));
+  ASSERT_EQ(4, ThreadPool::CalculateThreadCount(4, 4, 16, 0ms, 5ms, 0.0));
+}
+
+TEST(ThreadPoolCalculateThreadCountTest, RemainingThreadsOverloaded_PoolNotShrinks) {
+  ASSERT_EQ(4, ThreadPool::CalculateThreadCount(4, 1, 16, 0ms, 5ms, 0.6));
+}
+
+TEST(ThreadPoolCalculateThreadCountTest, OutOfLimits_Clamped) {
+  ASSERT_EQ(8, ThreadPool::CalculateThreadCount(20, 1, 8, 0ms, 5ms, 0.9));
+  ASSERT_EQ(4, ThreadPool::CalculateThreadCount(1, 4, 8, 2ms, 5ms, 0.5));
+}
+
+}  // namespace call_center::core::tasks::test
@@ -0,0 +1,55 @@
+#include "core/utils/affinity.h"
+
+#include <gtest/gtest.h>
+
+#include <sched.h>
+
+#include <thread>
+
+namespace call_center::core::utils::affinity::test {
+
+TEST(AffinityTest, ParseCpuSet_SingleCpusAndRanges) {
+  const auto cpu_set = ParseCpuSet("8,0-3,10-11");
+  ASSERT_TRUE(cpu_set);
+  ASSERT_EQ((CpuSet{0, 1, 2, 3, 8, 10, 11}), *cpu_set);
+}
+
+TEST(AffinityTest, ParseCpuSet_DuplicatesRemoved) {
+  const auto cpu_set = ParseCpuSet("0-2,1,2");
+  ASSERT_TRUE(cpu_set);
+  ASSERT_EQ((CpuSet{0, 1, 2}), *cpu_set);
+}
+
+TEST(AffinityTest, ParseCpuSet_InvalidFormat_Nullopt) {
+  ASSERT_FALSE(ParseCpuSet(""));
+  ASSERT_FALSE(ParseCpuSet("a"));
+  ASSERT_FALSE(ParseCpuSet("3-1"));
+  ASSERT_FALSE(ParseCpuSet("0,,1"));
+  ASSERT_FALSE(ParseCpuSet("0-"));
+}
+
+TEST(AffinityTest, ParseCpuSet_CpuOutOfRange_Nullopt) {
+  ASSERT_FALSE(ParseCpuSet(std::to_string(kMaxCpuCount)));
+  ASSERT_FALSE(ParseCpuSet("0-" + std::to_string(kMaxCpuCount)));
+  ASSERT_FALSE(ParseCpuSet("0-18446744073709551615"));
+  const auto cpu_set = ParseCpuSet(std::to_string(kMaxCpuCount - 1));
+  ASSERT_TRUE(cpu_set);
+  ASSERT_EQ((CpuSet{kMaxCpuCount - 1}), *cpu_set);
+}
+
+TEST(AffinityTest, ToString_RangesCollapsed) {
+  ASSERT_EQ("0-3,8,10-11", ToString({0, 1, 2, 3, 8, 10, 11}));
+  ASSERT_EQ("5", ToString({5}));
+  ASSERT_EQ("", ToString({}));
+}
+
+TEST(AffinityTest, SetCurrentThreadAffinity_CurrentCpu_Success) {
+  bool result = false;
+  std::thread thread([&result] {
+    result = SetCurrentThreadAffinity({static_cast<size_t>(sched_getcpu())});
+  });
+  thread.join();
+  ASSERT_TRUE(result);
+}
+
+}  // namespace call_center::core::utils::affinity::test
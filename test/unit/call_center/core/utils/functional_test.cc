@@ -0,0 +1,85 @@
+#include "core/utils/functional.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+
+namespace call_center::core::utils::functional::test {
+
+TEST(UniqueFunctionTest, DefaultConstructed_IsEmpty) {
+  const UniqueFunction<int()> function;
+  ASSERT_FALSE(function);
+  ASSERT_THROW(function(), std::bad_function_call);
+}
+
+TEST(UniqueFunctionTest, EmptyStdFunction_IsEmpty) {
+  const UniqueFunction<int()> function = std::function<int()>();
+  ASSERT_FALSE(function);
+}
+
+TEST(UniqueFunctionTest, SmallLambda_StoredInline) {
+  const int value = 42;
+  const UniqueFunction<int(int)> function = [value](int arg) { return value + arg; };
+  ASSERT_TRUE(function);
+  ASSERT_TRUE(function.IsInline());
+  ASSERT_EQ(43, function(1));
+}
+
+TEST(UniqueFunctionTest, MoveOnlyLambda_Invoked) {
+  auto value = std::make_unique<int>(42);
+  const UniqueFunction<int()> function = [value = std::move(value)]() { return *value; };
+  ASSERT_TRUE(function.IsInline());
+  ASSERT_EQ(42, function());
+}
+
+TEST(UniqueFunctionTest, LargeLambda_StoredOnHeap) {
+  std::array<char, 128> data{};
+  data[0] = 'a';
+  const UniqueFunction<char()> function = [data]() { return data[0]; };
+  ASSERT_FALSE(function.IsInline());
+  ASSERT_EQ('a', function());
+}
+
+TEST(UniqueFunctionTest, MutableLambda_StateKeptBetweenCalls) {
+  const UniqueFunction<int()> function = [counter = 0]() mutable { return ++counter; };
+  ASSERT_EQ(1, function());
+  ASSERT_EQ(2, function());
+}
+
+TEST(UniqueFunctionTest, Move_SourceBecomesEmpty) {
+  const auto value = std::make_shared<int>(42);
+  UniqueFunction<int()> source = [value]() { return *value; };
+  UniqueFunction<int()> destination = std::move(source);
+  ASSERT_FALSE(source);  // NOLINT(bugprone-use-after-move)
+  ASSERT_TRUE(destination);
+  ASSERT_EQ(42, destination());
+  ASSERT_EQ(2, value.use_count());
+}
+
+TEST(UniqueFunctionTest, MoveAssignment_PreviousFunctionDestroyed) {
+  const auto first_value = std::make_shared<int>(1);
+  const auto second_value = std::make_shared<int>(2);
+  UniqueFunction<int()> function = [first_value]() { return *first_value; };
+  function = [second_value]() { return *second_value; };
+  ASSERT_EQ(1, first_value.use_count());
+  ASSERT_EQ(2, second_value.use_count());
+  ASSERT_EQ(2, function());
+}
+
+TEST(UniqueFunctionTest, Destruction_CapturedObjectsReleased) {
+  const auto inline_value = std::make_shared<int>(1);
+  const auto heap_value = std::make_shared<int>(2);
+  {
+    const UniqueFunction<int()> inline_function = [inline_value]() { return *inline_value; };
+    const UniqueFunction<int()> heap_function = [heap_value, data = std::array<char, 128>{}]() {
+      return *heap_value + data[0];
+    };
+    ASSERT_EQ(2, inline_value.use_count());
+    ASSERT_EQ(2, heap_value.use_count());
+  }
+  ASSERT_EQ(1, inline_value.use_count());
+  ASSERT_EQ(1, heap_value.use_count());
+}
+
+}  // namespace call_center::core::utils::functional::test
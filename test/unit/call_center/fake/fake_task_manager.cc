@@ -16,7 +16,9 @@ std::shared_ptr<FakeTaskManager> FakeTaskManager::Create(const log::LoggerProvid
 }
 
 FakeTaskManager::FakeTaskManager(const log::LoggerProvider &logger_provider)
-    : clock_(std::make_shared<FakeClock>()), logger_(logger_provider.Get("TaskManagerImpl")) {
+    : clock_(std::make_shared<FakeClock>()),
+      logger_(logger_provider.Get("TaskManagerImpl")),
+      scheduler_metrics_(SchedulerMetrics::Create()) {
 }
 
 void FakeTaskManager::Start() {
@@ -56,32 +58,35 @@ asio::io_context &FakeTaskManager::IoContext() {
   throw std::runtime_error("Not implemented!");
 }
 
-void FakeTaskManager::PostTask(std::function<Task> task) {
+void FakeTaskManager::PostTask(TaskFunction task) {
   if (IsStopped()) {
     return;
   }
-  AddTask(clock_->Now(), std::move(task));
+  AddTask(clock_->Now(), std::move(task), SchedulerMetrics::TaskCategory::kImmediate);
 }
 
-void FakeTaskManager::PostTaskDelayedImpl(const Duration_t delay, std::function<Task> task) {
+void FakeTaskManager::PostTaskDelayedImpl(const Duration_t delay, TaskFunction task) {
   if (IsStopped()) {
     return;
   }
-  AddTask(clock_->Now() + delay, std::move(task));
+  AddTask(clock_->Now() + delay, std::move(task), SchedulerMetrics::TaskCategory::kDelayed);
 }
 
-void FakeTaskManager::PostTaskAtImpl(const TimePoint_t time_point, std::function<Task> task) {
+void FakeTaskManager::PostTaskAtImpl(const TimePoint_t time_point, TaskFunction task) {
   if (IsStopped()) {
     return;
   }
   AddTask(
       std::chrono::time_point_cast<FakeClock::Duration, FakeClock::Clock>(time_point),
-      std::move(task)
+      std::move(task),
+      SchedulerMetrics::TaskCategory::kDeferred
   );
 }
 
-TaskWrapped<TaskManager::Task> FakeTaskManager::MakeTaskWrapped(std::function<Task> task) const {
-  return {std::move(task), *logger_};
+TaskWrapped<TaskManager::Task> FakeTaskManager::MakeTaskWrapped(
+    TaskFunction task, const SchedulerMetrics::TaskCategory category
+) const {
+  return {std::move(task), category, *scheduler_metrics_, *logger_};
 }
 
 void FakeTaskManager::AdvanceTime(const Duration_t duration) {
@@ -108,9 +113,13 @@ void FakeTaskManager::ClearTasks() {
   has_tasks_.notify_all();
 }
 
-void FakeTaskManager::AddTask(FakeClock::TimePoint time_point, std::function<Task> task) {
+void FakeTaskManager::AddTask(
+    const FakeClock::TimePoint time_point,
+    TaskFunction task,
+    const SchedulerMetrics::TaskCategory category
+) {
   std::lock_guard lock(tasks_mutex_);
-  tasks_.emplace(time_point, MakeTaskWrapped(std::move(task)));
+  tasks_.emplace(time_point, MakeTaskWrapped(std::move(task), category));
   if (time_point == clock_->Now()) {
     has_tasks_.notify_one();
   }
@@ -143,11 +152,10 @@ void FakeTaskManager::HandleFirstTask() {
     return;
   }
   ++handle_count_;
-  auto [time_point, task] = *tasks_.begin();
-  tasks_.erase(tasks_.begin());
+  auto task = tasks_.extract(tasks_.begin());
   tasks_lock.unlock();
 
-  task();
+  task.mapped()();
   --handle_count_;
 }
 
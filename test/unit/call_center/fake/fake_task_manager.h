@@ -5,6 +5,7 @@
 #include <map>
 
 #include "core/clock_adapter.h"
+#include "core/tasks/scheduler_metrics.h"
 #include "core/tasks/task_manager.h"
 #include "core/tasks/tasks.h"
 #include "fake_clock.h"
@@ -29,9 +30,9 @@ class FakeTaskManager : public TaskManager {
   void Stop() override;
   void Join() override;
   boost::asio::io_context &IoContext() override;
-  void PostTask(std::function<Task> task) override;
-  void PostTaskDelayedImpl(Duration_t delay, std::function<Task> task) override;
-  void PostTaskAtImpl(TimePoint_t time_point, std::function<Task> task) override;
+  void PostTask(TaskFunction task) override;
+  void PostTaskDelayedImpl(Duration_t delay, TaskFunction task) override;
+  void PostTaskAtImpl(TimePoint_t time_point, TaskFunction task) override;
   /**
    * @brief Продвинуть время вперед и выполнить запланированные раннее задачи.
    */
@@ -45,6 +46,7 @@ class FakeTaskManager : public TaskManager {
   std::shared_ptr<FakeClock> clock_;
   boost::thread_group threads_;
   const std::unique_ptr<log::Logger> logger_;
+  const std::shared_ptr<SchedulerMetrics> scheduler_metrics_;
   bool started_ = false;
   bool stopped_ = false;
   mutable std::shared_mutex start_mutex_;
@@ -56,8 +58,11 @@ class FakeTaskManager : public TaskManager {
 
   explicit FakeTaskManager(const log::LoggerProvider &logger_provider);
 
-  TaskWrapped<Task> MakeTaskWrapped(std::function<Task> task) const;
-  void AddTask(FakeClock::TimePoint time_point, std::function<Task> task);
+  TaskWrapped<Task> MakeTaskWrapped(TaskFunction task, SchedulerMetrics::TaskCategory category)
+      const;
+  void AddTask(
+      FakeClock::TimePoint time_point, TaskFunction task, SchedulerMetrics::TaskCategory category
+  );
   bool HasTasks() const;
   void HandleTasks();
   void HandleFirstTask();
@@ -15,7 +15,7 @@ MockOperator::MockOperator(
 }
 
 void MockOperator::HandleCall(
-    const std::shared_ptr<CallDetailedRecord>& call, const OnFinishHandle& on_finish
+    const std::shared_ptr<CallDetailedRecord>& call, OnFinishHandle on_finish
 ) {
   // Empty
 }
@@ -17,7 +17,7 @@ class MockOperator : public Operator {
       const log::LoggerProvider &logger_provider
   );
 
-  void HandleCall(const std::shared_ptr<CallDetailedRecord> &call, const OnFinishHandle &on_finish)
+  void HandleCall(const std::shared_ptr<CallDetailedRecord> &call, OnFinishHandle on_finish)
       override;
 
  private:
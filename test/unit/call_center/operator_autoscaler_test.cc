@@ -0,0 +1,73 @@
+#include "operator_autoscaler.h"
+
+#include <gtest/gtest.h>
+
+#include "core/queueing_system/metrics/erlang.h"
+
+namespace call_center::test {
+
+using namespace std::chrono_literals;
+using namespace core::qs::metrics;
+
+class OperatorAutoscalerTest : public ::testing::Test {
+ protected:
+  using Measurements = OperatorAutoscaler::Measurements;
+  using Settings = OperatorAutoscaler::Settings;
+
+  Settings settings_{
+      .min_count = 1,
+      .max_count = 100,
+      .target_answer_time = 20s,
+      .target_service_level = 0.8,
+      .max_loss_probability = 0.01};
+};
+
+TEST_F(OperatorAutoscalerTest, CalculateDesiredOperatorCount_NoLoad_MinCount) {
+  const Measurements measurements{.arrival_rate = 0, .service_time = 10s};
+  ASSERT_EQ(1, OperatorAutoscaler::CalculateDesiredOperatorCount(10, measurements, settings_));
+  settings_.min_count = 3;
+  ASSERT_EQ(3, OperatorAutoscaler::CalculateDesiredOperatorCount(10, measurements, settings_));
+}
+
+TEST_F(OperatorAutoscalerTest, CalculateDesiredOperatorCount_Load_ErlangCCount) {
+  const Measurements measurements{.arrival_rate = 1, .service_time = 10s};
+  const auto expected = erlang::GetRequiredServerCount(10, 10s, 20s, 0.8, 100);
+  ASSERT_TRUE(expected);
+  ASSERT_LT(10, *expected);
+  ASSERT_EQ(
+      *expected, OperatorAutoscaler::CalculateDesiredOperatorCount(5, measurements, settings_)
+  );
+}
+
+TEST_F(OperatorAutoscalerTest, CalculateDesiredOperatorCount_TargetsMissed_AtLeastOneMore) {
+  Measurements measurements{.arrival_rate = 0, .service_time = 10s, .wait_time = 30s};
+  ASSERT_EQ(6, OperatorAutoscaler::CalculateDesiredOperatorCount(5, measurements, settings_));
+  measurements.wait_time = 0s;
+  measurements.loss_probability = 0.05;
+  ASSERT_EQ(6, OperatorAutoscaler::CalculateDesiredOperatorCount(5, measurements, settings_));
+}
+
+TEST_F(OperatorAutoscalerTest, CalculateDesiredOperatorCount_Overload_MaxCount) {
+  const Measurements measurements{.arrival_rate = 100, .service_time = 10s};
+  ASSERT_EQ(100, OperatorAutoscaler::CalculateDesiredOperatorCount(50, measurements, settings_));
+}
+
+TEST_F(OperatorAutoscalerTest, CalculateOperatorCount_ScaleUp_StepLimited) {
+  ASSERT_EQ(15, OperatorAutoscaler::CalculateOperatorCount(10, 30, 0));
+  ASSERT_EQ(12, OperatorAutoscaler::CalculateOperatorCount(10, 12, 0));
+  ASSERT_EQ(2, OperatorAutoscaler::CalculateOperatorCount(1, 5, 0));
+}
+
+TEST_F(OperatorAutoscalerTest, CalculateOperatorCount_ScaleDown_AfterSeveralPeriods) {
+  ASSERT_EQ(10, OperatorAutoscaler::CalculateOperatorCount(10, 5, 2));
+  ASSERT_EQ(9, OperatorAutoscaler::CalculateOperatorCount(10, 5, 3));
+  ASSERT_EQ(90, OperatorAutoscaler::CalculateOperatorCount(100, 50, 3));
+  ASSERT_EQ(1, OperatorAutoscaler::CalculateOperatorCount(2, 1, 3));
+}
+
+TEST_F(OperatorAutoscalerTest, CalculateOperatorCount_WithinThreshold_NotChanged) {
+  ASSERT_EQ(10, OperatorAutoscaler::CalculateOperatorCount(10, 9, 5));
+  ASSERT_EQ(10, OperatorAutoscaler::CalculateOperatorCount(10, 10, 5));
+}
+
+}  // namespace call_center::test
@@ -155,6 +155,26 @@ TEST_F(OperatorSetTest, SetOperatorCountInConfig) {
   EXPECT_EQ(1, operator_set_.GetBusyOperatorCount());
 }
 
+TEST_F(OperatorSetTest, SetOperatorCountInConfig_BusyOperatorsKeepMetrics) {
+  const auto operator_count = operator_set_.GetSize();
+  const auto busy_operator = operator_set_.EraseFree();
+
+  configuration_adapter_.SetOperatorCount(operator_count * 2);
+  configuration_adapter_.UpdateConfiguration();
+  const auto another_busy_operator = operator_set_.EraseFree();
+  auto servers_metrics = metrics_->GetServersMetrics();
+  ASSERT_EQ(operator_count * 2, servers_metrics.servers.size());
+  EXPECT_EQ(busy_operator->GetId(), servers_metrics.servers[busy_operator->GetIndex()].id);
+
+  configuration_adapter_.SetOperatorCount(1);
+  configuration_adapter_.UpdateConfiguration();
+  operator_set_.InsertFree(another_busy_operator);
+  servers_metrics = metrics_->GetServersMetrics();
+  ASSERT_EQ(1, servers_metrics.servers.size());
+  EXPECT_EQ(busy_operator->GetId(), servers_metrics.servers.front().id);
+  EXPECT_EQ(operator_count * 2 - 1, servers_metrics.retired_count);
+}
+
 TEST_F(OperatorSetTest, TryEraseWithFreeCount_GetNullptr) {
   const auto operator_count = operator_set_.GetSize();
   EraseOperators(operator_count);
@@ -0,0 +1,58 @@
+#include "phone_number.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <unordered_set>
+
+namespace call_center::test {
+
+static_assert(sizeof(PhoneNumber) == sizeof(uint64_t));
+static_assert(PhoneNumber::Parse("+7 (912) 345-67-89")->Format().View() == "+79123456789");
+
+TEST(PhoneNumberTest, Parse_NumberWithSeparators_Normalized) {
+  const auto phone_number = PhoneNumber::Parse("+7 (912) 345-67.89");
+  ASSERT_TRUE(phone_number);
+  ASSERT_EQ(79123456789, phone_number->GetDigits());
+  ASSERT_EQ(11, phone_number->GetDigitCount());
+  ASSERT_EQ("+79123456789", phone_number->ToString());
+  ASSERT_EQ(phone_number, PhoneNumber::Parse("79123456789"));
+}
+
+TEST(PhoneNumberTest, Parse_MaxDigitCount_Parsed) {
+  const auto phone_number = PhoneNumber::Parse("+999999999999999");
+  ASSERT_TRUE(phone_number);
+  ASSERT_EQ(PhoneNumber::kMaxDigitCount, phone_number->GetDigitCount());
+  ASSERT_EQ("+999999999999999", phone_number->ToString());
+}
+
+TEST(PhoneNumberTest, Parse_InvalidNumber_Nullopt) {
+  for (const auto *str :
+       {"", "+", "  -", "0123", "+0", "1234567890123456", "+7912abc", "++79123456789", "7+9"}) {
+    ASSERT_FALSE(PhoneNumber::Parse(str)) << str;
+  }
+}
+
+TEST(PhoneNumberTest, Constructor_InvalidDigits_Throws) {
+  ASSERT_THROW(PhoneNumber(0), std::invalid_argument);
+  ASSERT_THROW(PhoneNumber(1'000'000'000'000'000), std::invalid_argument);
+  ASSERT_EQ("+1", PhoneNumber(1).ToString());
+}
+
+TEST(PhoneNumberTest, Ostream_WritesFormattedNumber) {
+  std::ostringstream out;
+  out << PhoneNumber(74951234567);
+  ASSERT_EQ("+74951234567", out.str());
+}
+
+TEST(PhoneNumberTest, Hash_SequentialNumbers_Distinct) {
+  constexpr uint64_t kFirst = 79'000'000'000;
+  constexpr size_t kCount = 100000;
+  std::unordered_set<size_t> hashes;
+  for (size_t i = 0; i < kCount; ++i) {
+    hashes.insert(std::hash<PhoneNumber>()(PhoneNumber(kFirst + i)));
+  }
+  ASSERT_EQ(kCount, hashes.size());
+}
+
+}  // namespace call_center::test
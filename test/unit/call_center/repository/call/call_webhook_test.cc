@@ -0,0 +1,126 @@
+#include "repository/call/call_webhook.h"
+
+#include <gtest/gtest.h>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <thread>
+
+#include "configuration_adapter.h"
+#include "core/tasks/task_manager_impl.h"
+#include "utils.h"
+
+namespace call_center::repository::test {
+
+using namespace log;
+using namespace config;
+using namespace config::test;
+using namespace std::chrono_literals;
+using namespace call_center::test;
+using core::tasks::TaskManagerImpl;
+
+class CallWebhookTest : public testing::Test {
+ public:
+  CallWebhookTest();
+  ~CallWebhookTest() override;
+
+  void Notify(size_t count);
+  /**
+   * @brief Дождаться завершения всех отправок, но не дольше timeout.
+   */
+  [[nodiscard]] bool WaitNoneInFlight(std::chrono::milliseconds timeout) const;
+
+  const std::string test_name_;
+  const std::string test_group_name_;
+  const LoggerProvider logger_provider_;
+  const std::shared_ptr<Configuration> configuration_;
+  ConfigurationAdapter configuration_adapter_;
+  const std::shared_ptr<TaskManagerImpl> task_manager_;
+  const std::shared_ptr<CallWebhook> webhook_;
+  /// Принимает соединения, но не отвечает: уведомления остаются в процессе отправки.
+  core::http::tcp::acceptor acceptor_;
+};
+
+CallWebhookTest::CallWebhookTest()
+    : test_name_(testing::UnitTest::GetInstance()->current_test_info()->name()),
+      test_group_name_("CallWebhookTest"),
+      logger_provider_(std::make_shared<Sink>(
+          test_group_name_ + "/logs/" + test_name_ + ".log", SeverityLevel::kTrace, SIZE_MAX
+      )),
+      configuration_(Configuration::Create(
+          logger_provider_, test_group_name_ + "/configs/" + test_name_ + ".json"
+      )),
+      configuration_adapter_(configuration_),
+      task_manager_(TaskManagerImpl::Create(configuration_, logger_provider_)),
+      webhook_(CallWebhook::Create(task_manager_, configuration_, logger_provider_)),
+      acceptor_(
+          task_manager_->IoContext(),
+          core::http::tcp::endpoint(core::http::net::ip::address_v4::loopback(), 0)
+      ) {
+  CreateDirForLogs(test_group_name_);
+  CreateDirForConfigs(test_group_name_);
+  configuration_adapter_.SetConfigurationCaching(false);
+  task_manager_->Start();
+}
+
+CallWebhookTest::~CallWebhookTest() {
+  // незавершенные отправки удерживают уведомитель и менеджер задач
+  acceptor_.close();
+  EXPECT_TRUE(WaitNoneInFlight(5s));
+  task_manager_->Stop();
+}
+
+void CallWebhookTest::Notify(const size_t count) {
+  boost::uuids::random_generator generator;
+  for (size_t i = 0; i < count; ++i) {
+    webhook_->Notify(CallResultDto(generator(), {PhoneNumber(79123456789), CallStatus::kOk}));
+  }
+}
+
+bool CallWebhookTest::WaitNoneInFlight(const std::chrono::milliseconds timeout) const {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (webhook_->GetInFlightCount() > 0) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(1ms);
+  }
+  return true;
+}
+
+TEST_F(CallWebhookTest, PortNotSet_NothingSent) {
+  configuration_adapter_.SetCallWebhook(0, 1);
+  configuration_adapter_.UpdateConfiguration();
+
+  Notify(10);
+
+  ASSERT_EQ(0, webhook_->GetInFlightCount());
+  ASSERT_EQ(0, webhook_->GetDroppedCount());
+}
+
+TEST_F(CallWebhookTest, ReceiverNotResponding_ExcessDropped) {
+  configuration_adapter_.SetCallWebhook(acceptor_.local_endpoint().port(), 4);
+  configuration_adapter_.UpdateConfiguration();
+
+  Notify(10);
+
+  ASSERT_EQ(4, webhook_->GetInFlightCount());
+  ASSERT_EQ(6, webhook_->GetDroppedCount());
+}
+
+TEST_F(CallWebhookTest, SendingCompleted_SlotsReleased) {
+  configuration_adapter_.SetCallWebhook(acceptor_.local_endpoint().port(), 4);
+  configuration_adapter_.UpdateConfiguration();
+  Notify(4);
+  ASSERT_EQ(4, webhook_->GetInFlightCount());
+
+  // неотвеченные соединения сбрасываются, и отправки завершаются с ошибкой
+  acceptor_.close();
+  ASSERT_TRUE(WaitNoneInFlight(5s));
+  Notify(4);
+
+  ASSERT_EQ(0, webhook_->GetDroppedCount());
+  ASSERT_TRUE(WaitNoneInFlight(5s));
+}
+
+}  // namespace call_center::repository::test
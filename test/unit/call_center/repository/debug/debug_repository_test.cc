@@ -0,0 +1,136 @@
+#include "repository/debug/debug_repository.h"
+
+#include <gtest/gtest.h>
+
+#include <boost/json.hpp>
+#include <optional>
+
+#include "configuration_adapter.h"
+#include "core/instrumentation/instrumented_mutex.h"
+#include "fake/fake_task_manager.h"
+#include "repository/debug/instrumentation_response_dto.h"
+#include "utils.h"
+
+namespace call_center::repository::test {
+
+using namespace log;
+using namespace config;
+using namespace std::chrono_literals;
+using namespace call_center::test;
+using namespace call_center::core::tasks::test;
+using core::instrumentation::InstrumentationReport;
+using core::qs::metrics::QueueingSystemMetrics;
+
+class DebugRepositoryTest : public testing::Test {
+ public:
+  DebugRepositoryTest();
+
+  /**
+   * @brief Обработать запрос и вернуть ответ, отправленный обратным вызовом.
+   */
+  HttpRepository::Response Handle(b_http::verb method, std::string_view target);
+
+  const std::string test_name_;
+  const std::string test_group_name_;
+  const LoggerProvider logger_provider_;
+  const std::shared_ptr<Configuration> configuration_;
+  const std::shared_ptr<FakeTaskManager> task_manager_;
+  const std::shared_ptr<QueueingSystemMetrics> metrics_;
+  const std::shared_ptr<DebugRepository> repository_;
+};
+
+DebugRepositoryTest::DebugRepositoryTest()
+    : test_name_(testing::UnitTest::GetInstance()->current_test_info()->name()),
+      test_group_name_("DebugRepositoryTest"),
+      logger_provider_(std::make_shared<Sink>(
+          test_group_name_ + "/logs/" + test_name_ + ".log", SeverityLevel::kTrace, SIZE_MAX
+      )),
+      configuration_(Configuration::Create(
+          logger_provider_, test_group_name_ + "/configs/" + test_name_ + ".json"
+      )),
+      task_manager_(FakeTaskManager::Create(logger_provider_)),
+      metrics_(QueueingSystemMetrics::Create(task_manager_, configuration_, logger_provider_)),
+      repository_(DebugRepository::Create(metrics_, logger_provider_)) {
+  CreateDirForLogs(test_group_name_);
+  CreateDirForConfigs(test_group_name_);
+}
+
+HttpRepository::Response DebugRepositoryTest::Handle(
+    const b_http::verb method, const std::string_view target
+) {
+  const HttpRepository::Request request(method, target, 11);
+  std::optional<HttpRepository::Response> response;
+  repository_->HandleRequest(
+      request,
+      net::ip::address_v4::loopback(),
+      [&response](HttpRepository::Response &&handled) { response = std::move(handled); }
+  );
+  EXPECT_TRUE(response) << "Response must be sent synchronously.";
+  return response.value_or(HttpRepository::Response{});
+}
+
+TEST_F(DebugRepositoryTest, Instrumentation_ReportAsJson) {
+  const auto response = Handle(b_http::verb::get, "/debug/instrumentation");
+  ASSERT_EQ(b_http::status::ok, response.result());
+
+  const auto body = json::parse(response.body()).as_object();
+  ASSERT_EQ(core::instrumentation::kEnabled, body.at("enabled").as_bool());
+  ASSERT_EQ(0, body.at("call_count").to_number<uint64_t>());
+  const auto &allocations = body.at("allocations").as_object();
+  for (const auto *key : {"count", "live_count", "bytes", "count_per_call", "bytes_per_call"}) {
+    ASSERT_TRUE(allocations.contains(key)) << key;
+  }
+  ASSERT_TRUE(body.at("locks").is_array());
+}
+
+TEST_F(DebugRepositoryTest, UnknownPath_NotFound) {
+  ASSERT_EQ(b_http::status::not_found, Handle(b_http::verb::get, "/debug/unknown").result());
+}
+
+TEST_F(DebugRepositoryTest, IllegalMethod_MethodNotAllowed) {
+  ASSERT_EQ(
+      b_http::status::method_not_allowed,
+      Handle(b_http::verb::post, "/debug/instrumentation").result()
+  );
+}
+
+TEST(InstrumentationResponseDtoTest, ToJson_AllocationsAndLocksInMicroseconds) {
+  const InstrumentationReport report{
+      .enabled = true,
+      .call_count = 4,
+      .allocations = {.allocation_count = 8, .deallocation_count = 6, .allocated_bytes = 400},
+      .locks = {
+          {.name = "CallQueue",
+           .acquire_count = 10,
+           .contended_count = 2,
+           .wait_time = 3500ns,
+           .max_wait_time = 2us,
+           .hold_time = 7us,
+           .max_hold_time = 4us}
+      }
+  };
+
+  const auto expected = json::parse(R"({
+    "enabled": true,
+    "call_count": 4,
+    "allocations": {
+      "count": 8,
+      "live_count": 2,
+      "bytes": 400,
+      "count_per_call": 2.0,
+      "bytes_per_call": 100.0
+    },
+    "locks": [{
+      "name": "CallQueue",
+      "acquire_count": 10,
+      "contended_count": 2,
+      "wait_time": 3.5,
+      "max_wait_time": 2.0,
+      "hold_time": 7.0,
+      "max_hold_time": 4.0
+    }]
+  })");
+  ASSERT_EQ(expected, json::value_from(InstrumentationResponseDto(report)));
+}
+
+}  // namespace call_center::repository::test
@@ -0,0 +1,204 @@
+#include "repository/events/events_repository.h"
+
+#include <gtest/gtest.h>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/json.hpp>
+#include <optional>
+
+#include "configuration_adapter.h"
+#include "fake/fake_call_detailed_record.h"
+#include "fake/fake_task_manager.h"
+#include "utils.h"
+
+namespace call_center::repository::test {
+
+using namespace log;
+using namespace config;
+using namespace config::test;
+using namespace std::chrono_literals;
+using namespace call_center::test;
+using namespace call_center::core::tasks::test;
+using core::qs::metrics::QueueingSystemMetrics;
+
+namespace json = boost::json;
+
+class EventsRepositoryTest : public testing::Test {
+ public:
+  EventsRepositoryTest();
+  ~EventsRepositoryTest() override;
+
+  /**
+   * @brief Создать ЦОВ и репозиторий после записи конфигурации: размер буфера событий задается
+   * при создании ЦОВ.
+   */
+  void CreateRepository();
+  /**
+   * @brief Добавить вызов в ЦОВ, каждый вызов публикует события.
+   */
+  void PushCall();
+  /**
+   * @brief Обработать запрос и вернуть ответ, возвращенный сопрограммой.
+   */
+  HttpRepository::Response Handle(std::string_view target, b_http::verb method = b_http::verb::get);
+
+  const std::string test_name_;
+  const std::string test_group_name_;
+  const LoggerProvider logger_provider_;
+  const std::shared_ptr<Configuration> configuration_;
+  ConfigurationAdapter configuration_adapter_;
+  const std::shared_ptr<FakeTaskManager> task_manager_;
+  const std::shared_ptr<QueueingSystemMetrics> metrics_;
+  std::shared_ptr<CallCenter> call_center_;
+  std::shared_ptr<EventsRepository> repository_;
+  uint64_t next_call_index_ = 1;
+};
+
+EventsRepositoryTest::EventsRepositoryTest()
+    : test_name_(testing::UnitTest::GetInstance()->current_test_info()->name()),
+      test_group_name_("EventsRepositoryTest"),
+      logger_provider_(std::make_shared<Sink>(
+          test_group_name_ + "/logs/" + test_name_ + ".log", SeverityLevel::kTrace, SIZE_MAX
+      )),
+      configuration_(Configuration::Create(
+          logger_provider_, test_group_name_ + "/configs/" + test_name_ + ".json"
+      )),
+      configuration_adapter_(configuration_),
+      task_manager_(FakeTaskManager::Create(logger_provider_)),
+      metrics_(QueueingSystemMetrics::Create(task_manager_, configuration_, logger_provider_)) {
+  CreateDirForLogs(test_group_name_);
+  CreateDirForConfigs(test_group_name_);
+  // один оператор занят первым вызовом, остальные отклоняются: по два события на вызов
+  configuration_adapter_.SetConfigurationCaching(false);
+  configuration_adapter_.SetOperatorCount(1);
+  configuration_adapter_.SetOperatorDelay(1h);
+  configuration_adapter_.SetCallQueueCapacity(0);
+}
+
+EventsRepositoryTest::~EventsRepositoryTest() {
+  task_manager_->Stop();
+}
+
+void EventsRepositoryTest::CreateRepository() {
+  configuration_adapter_.UpdateConfiguration();
+  call_center_ = CallCenter::Create(
+      nullptr,
+      configuration_,
+      task_manager_,
+      logger_provider_,
+      std::make_unique<OperatorSet>(
+          configuration_,
+          [this]() {
+            return Operator::Create(task_manager_, configuration_, logger_provider_);
+          },
+          logger_provider_,
+          metrics_
+      ),
+      std::make_unique<CallQueue>(configuration_, logger_provider_),
+      metrics_
+  );
+  repository_ = EventsRepository::Create(call_center_, logger_provider_);
+  task_manager_->Start();
+}
+
+void EventsRepositoryTest::PushCall() {
+  call_center_->PushCall(FakeCallDetailedRecord::Create(
+      task_manager_->GetClock(),
+      PhoneNumber(next_call_index_++),
+      configuration_,
+      [](const auto &) {}
+  ));
+}
+
+HttpRepository::Response EventsRepositoryTest::Handle(
+    const std::string_view target, const b_http::verb method
+) {
+  net::io_context context;
+  const HttpRepository::Request request(method, target, 11);
+  std::optional<HttpRepository::Response> response;
+  net::co_spawn(
+      context,
+      repository_->HandleRequestAsync(request, net::ip::address_v4::loopback()),
+      [&response](const std::exception_ptr &exception, HttpRepository::Response handled) {
+        EXPECT_FALSE(exception);
+        response = std::move(handled);
+      }
+  );
+  context.run();
+  EXPECT_TRUE(response);
+  return response.value_or(HttpRepository::Response{});
+}
+
+TEST_F(EventsRepositoryTest, NoCursor_OnlyNewEventsWithoutWaiting) {
+  CreateRepository();
+  PushCall();
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto response = Handle("/events");
+  ASSERT_GT(1s, std::chrono::steady_clock::now() - start) << "Request must not wait by default.";
+  ASSERT_EQ(b_http::status::ok, response.result());
+  const auto body = json::parse(response.body()).as_object();
+  ASSERT_EQ(call_center_->GetEvents().GetHead(), body.at("cursor").to_number<uint64_t>());
+  ASSERT_EQ(0, body.at("dropped").to_number<uint64_t>());
+  ASSERT_TRUE(body.at("events").as_array().empty());
+}
+
+TEST_F(EventsRepositoryTest, Cursor_EventsFromCursor) {
+  CreateRepository();
+  PushCall();
+  PushCall();
+
+  const auto response = Handle("/events?cursor=1");
+  ASSERT_EQ(b_http::status::ok, response.result());
+  const auto body = json::parse(response.body()).as_object();
+  ASSERT_EQ(4, body.at("cursor").to_number<uint64_t>());
+  const auto &events = body.at("events").as_array();
+  ASSERT_EQ(3, events.size());
+  EXPECT_EQ("started", events[0].at("type").as_string());
+  EXPECT_EQ("arrived", events[1].at("type").as_string());
+  EXPECT_EQ("rejected", events[2].at("type").as_string());
+  EXPECT_EQ("overload", events[2].at("call_status").as_string());
+}
+
+TEST_F(EventsRepositoryTest, LaggedSubscriber_DroppedCount) {
+  configuration_adapter_.SetEventsBufferSize(4);
+  CreateRepository();
+  for (int i = 0; i < 4; ++i) {
+    PushCall();
+  }
+
+  const auto response = Handle("/events?cursor=0");
+  const auto body = json::parse(response.body()).as_object();
+  ASSERT_EQ(8, body.at("cursor").to_number<uint64_t>());
+  ASSERT_EQ(4, body.at("dropped").to_number<uint64_t>());
+  ASSERT_EQ(4, body.at("events").as_array().size());
+}
+
+TEST_F(EventsRepositoryTest, Wait_NoEvents_EmptyResponseAfterWait) {
+  CreateRepository();
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto response = Handle("/events?wait=1");
+  ASSERT_LE(1s, std::chrono::steady_clock::now() - start);
+  ASSERT_EQ(b_http::status::ok, response.result());
+  ASSERT_TRUE(json::parse(response.body()).at("events").as_array().empty());
+}
+
+TEST_F(EventsRepositoryTest, InvalidQuery_BadRequestOrNotFound) {
+  CreateRepository();
+
+  for (const auto *target :
+       {"/events?cursor=abc", "/events?cursor=-1", "/events?cursor=", "/events?wait=1s"}) {
+    EXPECT_EQ(b_http::status::bad_request, Handle(target).result()) << "Target: " << target;
+  }
+  EXPECT_EQ(b_http::status::not_found, Handle("/events/unknown").result());
+}
+
+TEST_F(EventsRepositoryTest, IllegalMethod_MethodNotAllowed) {
+  CreateRepository();
+
+  ASSERT_EQ(b_http::status::method_not_allowed, Handle("/events", b_http::verb::post).result());
+}
+
+}  // namespace call_center::repository::test
@@ -0,0 +1,122 @@
+#include "repository/metrics/prometheus_writer.h"
+
+#include <gtest/gtest.h>
+
+namespace call_center::repository::test {
+
+using namespace std::chrono_literals;
+using core::qs::metrics::HdrHistogram;
+using core::qs::metrics::Metric;
+using core::qs::metrics::SlidingWindowMetrics;
+
+TEST(PrometheusWriterTest, WriteCounterAndGauge_HeaderAndSample) {
+  std::string buffer;
+  PrometheusWriter writer(buffer);
+  writer.WriteCounter("calls_total", "Calls.", 42);
+  writer.WriteGauge("load", "Load.", 0.25);
+
+  ASSERT_EQ(
+      "# HELP calls_total Calls.\n"
+      "# TYPE calls_total counter\n"
+      "calls_total 42\n"
+      "# HELP load Load.\n"
+      "# TYPE load gauge\n"
+      "load 0.25\n",
+      buffer
+  );
+}
+
+TEST(PrometheusWriterTest, WriteMetric_StatLabelsAndCount) {
+  std::string buffer;
+  PrometheusWriter writer(buffer);
+  writer.WriteMetric("wait_seconds", "Wait.", Metric<std::chrono::milliseconds>(1s, 3s, 2s, 5));
+
+  ASSERT_EQ(
+      "# HELP wait_seconds Wait.\n"
+      "# TYPE wait_seconds gauge\n"
+      "wait_seconds{stat=\"min\"} 1\n"
+      "wait_seconds{stat=\"max\"} 3\n"
+      "wait_seconds{stat=\"avg\"} 2\n"
+      "# HELP wait_seconds_count Wait.\n"
+      "# TYPE wait_seconds_count counter\n"
+      "wait_seconds_count 5\n",
+      buffer
+  );
+}
+
+TEST(PrometheusWriterTest, WriteMetricWithHistogram_WaitTimeStatsAndPercentiles) {
+  HdrHistogram histogram;
+  for (int i = 1; i <= 100; ++i) {
+    histogram.Record(std::chrono::milliseconds(i * 10));
+  }
+  const Metric<std::chrono::milliseconds> wait_time(10ms, 1s, 505ms, 100);
+
+  std::string buffer;
+  PrometheusWriter writer(buffer);
+  writer.WriteMetric("wait_time_stats_seconds", "Wait.", wait_time, histogram.GetSnapshot());
+
+  EXPECT_TRUE(buffer.starts_with(
+      "# HELP wait_time_stats_seconds Wait.\n"
+      "# TYPE wait_time_stats_seconds gauge\n"
+      "wait_time_stats_seconds{stat=\"min\"} 0.01\n"
+      "wait_time_stats_seconds{stat=\"max\"} 1\n"
+      "wait_time_stats_seconds{stat=\"avg\"} 0.505\n"
+      "wait_time_stats_seconds{stat=\"p50\"} "
+  )) << buffer;
+  EXPECT_NE(std::string::npos, buffer.find("wait_time_stats_seconds{stat=\"p90\"} "));
+  EXPECT_NE(std::string::npos, buffer.find("wait_time_stats_seconds{stat=\"p99\"} "));
+  EXPECT_NE(std::string::npos, buffer.find("wait_time_stats_seconds{stat=\"p99.9\"} "));
+  EXPECT_NE(std::string::npos, buffer.find("wait_time_stats_seconds_count 100\n"));
+}
+
+TEST(PrometheusWriterTest, WriteWindowMetrics_SeriesPerWindow) {
+  SlidingWindowMetrics::Snapshot minute;
+  minute.window = 1min;
+  minute.arrival_count = 120;
+  minute.serviced_count = 100;
+  minute.dropout_count = 20;
+  minute.service_start_count = 4;
+  minute.wait_time_sum = 2s;
+  minute.max_wait_time = 1500ms;
+  SlidingWindowMetrics::Snapshot seconds;
+  seconds.window = 90s;
+  const SlidingWindowMetrics::Snapshot windows[] = {minute, seconds};
+
+  std::string buffer;
+  PrometheusWriter writer(buffer);
+  writer.WriteWindowMetrics("window", windows);
+
+  EXPECT_NE(std::string::npos, buffer.find("# TYPE window_arrivals gauge\n"));
+  EXPECT_NE(std::string::npos, buffer.find("window_arrivals{window=\"1m\"} 120\n"));
+  EXPECT_NE(std::string::npos, buffer.find("window_arrivals{window=\"90s\"} 0\n"));
+  EXPECT_NE(std::string::npos, buffer.find("window_serviced{window=\"1m\"} 100\n"));
+  EXPECT_NE(std::string::npos, buffer.find("window_dropouts{window=\"1m\"} 20\n"));
+  EXPECT_NE(std::string::npos, buffer.find("window_arrival_rate{window=\"1m\"} 2\n"));
+  EXPECT_NE(
+      std::string::npos, buffer.find("window_wait_time_seconds{window=\"1m\",stat=\"avg\"} 0.5\n")
+  );
+  EXPECT_NE(
+      std::string::npos, buffer.find("window_wait_time_seconds{window=\"1m\",stat=\"max\"} 1.5\n")
+  );
+  EXPECT_NE(std::string::npos, buffer.find("window_service_load_erlang{window=\"1m\"} "));
+}
+
+TEST(PrometheusWriterTest, WriteHistogram_CumulativeBuckets) {
+  HdrHistogram histogram;
+  histogram.Record(3ms);
+  histogram.Record(7ms);
+  histogram.Record(20min);
+
+  std::string buffer;
+  PrometheusWriter writer(buffer);
+  writer.WriteHistogram("time_seconds", "Time.", histogram.GetSnapshot());
+
+  EXPECT_NE(std::string::npos, buffer.find("time_seconds_bucket{le=\"0.005\"} 1\n"));
+  EXPECT_NE(std::string::npos, buffer.find("time_seconds_bucket{le=\"0.01\"} 2\n"));
+  EXPECT_NE(std::string::npos, buffer.find("time_seconds_bucket{le=\"600\"} 2\n"));
+  EXPECT_NE(std::string::npos, buffer.find("time_seconds_bucket{le=\"+Inf\"} 3\n"));
+  EXPECT_NE(std::string::npos, buffer.find("time_seconds_sum 1200.01\n"));
+  EXPECT_NE(std::string::npos, buffer.find("time_seconds_count 3\n"));
+}
+
+}  // namespace call_center::repository::test
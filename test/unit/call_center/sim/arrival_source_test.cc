@@ -0,0 +1,72 @@
+#include "sim/arrival_source.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <unordered_set>
+
+namespace call_center::sim::test {
+
+using namespace std::chrono_literals;
+
+TEST(ArrivalSourceTest, PoissonArrivalSource_ManyArrivals_MeanIntervalMatchesRate) {
+  constexpr size_t kCount = 100000;
+  constexpr double kRate = 20;
+  PoissonArrivalSource source(kRate, kCount, 1);
+
+  std::unordered_set<PhoneNumber> phone_numbers;
+  Arrival::Duration last_time{0};
+  size_t count = 0;
+  while (const auto arrival = source.Next()) {
+    ASSERT_LE(last_time, arrival->time);
+    last_time = arrival->time;
+    phone_numbers.insert(arrival->caller_phone_number);
+    ++count;
+  }
+
+  ASSERT_EQ(kCount, count);
+  ASSERT_EQ(kCount, phone_numbers.size());
+  const auto mean_interval = std::chrono::duration<double>(last_time).count() / kCount;
+  ASSERT_NEAR(1 / kRate, mean_interval, 0.01 / kRate);
+}
+
+TEST(ArrivalSourceTest, PoissonArrivalSource_SameSeed_SameArrivals) {
+  PoissonArrivalSource first(5, 100, 42);
+  PoissonArrivalSource second(5, 100, 42);
+  while (const auto arrival = first.Next()) {
+    ASSERT_EQ(arrival->time, second.Next()->time);
+  }
+}
+
+TEST(ArrivalSourceTest, TraceArrivalSource_ValidTrace_ReadsArrivals) {
+  std::istringstream trace("# time;phone\n0.5;+7 (123) 456-78-90\n\n1.25\n1.25;+70000000000\n");
+  TraceArrivalSource source(trace);
+
+  const auto first = source.Next();
+  ASSERT_TRUE(first);
+  ASSERT_EQ(500ms, first->time);
+  ASSERT_EQ("+71234567890", first->caller_phone_number.ToString());
+  const auto second = source.Next();
+  ASSERT_TRUE(second);
+  ASSERT_EQ(1250ms, second->time);
+  ASSERT_NE(first->caller_phone_number, second->caller_phone_number);
+  const auto third = source.Next();
+  ASSERT_TRUE(third);
+  ASSERT_EQ("+70000000000", third->caller_phone_number.ToString());
+  ASSERT_FALSE(source.Next());
+}
+
+TEST(ArrivalSourceTest, TraceArrivalSource_InvalidTrace_Throws) {
+  std::istringstream invalid_time("abc;+71234567890\n");
+  ASSERT_THROW(TraceArrivalSource(invalid_time).Next(), std::invalid_argument);
+
+  std::istringstream decreasing_time("2\n1\n");
+  TraceArrivalSource source(decreasing_time);
+  ASSERT_TRUE(source.Next());
+  ASSERT_THROW(source.Next(), std::invalid_argument);
+
+  std::istringstream invalid_phone("1;+7-abc\n");
+  ASSERT_THROW(TraceArrivalSource(invalid_phone).Next(), std::invalid_argument);
+}
+
+}  // namespace call_center::sim::test
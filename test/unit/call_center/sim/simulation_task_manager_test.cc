@@ -0,0 +1,128 @@
+#include "sim/simulation_task_manager.h"
+
+#include <gtest/gtest.h>
+
+#include "utils.h"
+
+namespace call_center::sim::test {
+
+using namespace log;
+using namespace std::chrono_literals;
+using namespace call_center::test;
+
+class SimulationTaskManagerTest : public testing::Test {
+ public:
+  SimulationTaskManagerTest();
+
+  const std::string test_name_;
+  const std::string test_group_name_;
+  const log::LoggerProvider logger_provider_;
+  const std::shared_ptr<VirtualClock> clock_;
+  const std::shared_ptr<SimulationTaskManager> task_manager_;
+  const VirtualClock::TimePoint start_;
+};
+
+SimulationTaskManagerTest::SimulationTaskManagerTest()
+    : test_name_(testing::UnitTest::GetInstance()->current_test_info()->name()),
+      test_group_name_("SimulationTaskManagerTest"),
+      logger_provider_(std::make_shared<Sink>(
+          test_group_name_ + "/logs/" + test_name_ + ".log", SeverityLevel::kTrace, SIZE_MAX
+      )),
+      clock_(std::make_shared<VirtualClock>()),
+      task_manager_(SimulationTaskManager::Create(clock_, logger_provider_)),
+      start_(clock_->Now()) {
+  CreateDirForLogs(test_group_name_);
+}
+
+TEST_F(SimulationTaskManagerTest, RunWhile_DelayedTasks_RunInTimeOrderAndAdvanceClock) {
+  std::vector<std::pair<int, VirtualClock::Duration>> runs;
+  const auto post = [this, &runs](const int id, const std::chrono::milliseconds delay) {
+    task_manager_->PostTaskDelayed(delay, [this, &runs, id]() {
+      runs.emplace_back(id, clock_->Now() - start_);
+    });
+  };
+  post(3, 3s);
+  post(1, 1s);
+  post(2, 2s);
+
+  ASSERT_EQ(3, task_manager_->RunWhile([]() {
+    return true;
+  }));
+
+  const std::vector<std::pair<int, VirtualClock::Duration>> expected{{1, 1s}, {2, 2s}, {3, 3s}};
+  ASSERT_EQ(expected, runs);
+  ASSERT_EQ(3s, clock_->GetElapsedTime());
+  ASSERT_EQ(0, task_manager_->GetPendingTaskCount());
+}
+
+TEST_F(SimulationTaskManagerTest, RunWhile_SameTime_RunInPostOrder) {
+  std::vector<int> runs;
+  for (int id = 0; id < 5; ++id) {
+    task_manager_->PostTaskAt(start_ + 1s, [&runs, id]() {
+      runs.push_back(id);
+    });
+  }
+  task_manager_->PostTask([&runs]() {
+    runs.push_back(-1);
+  });
+
+  task_manager_->RunWhile([]() {
+    return true;
+  });
+
+  ASSERT_EQ(std::vector<int>({-1, 0, 1, 2, 3, 4}), runs);
+}
+
+TEST_F(SimulationTaskManagerTest, RunWhile_TaskPostsTasks_RunsNewTasks) {
+  size_t count = 0;
+  std::function<void()> task = [this, &count, &task]() {
+    if (++count < 10) {
+      task_manager_->PostTaskDelayed(1min, [&task]() {
+        task();
+      });
+    }
+  };
+  task_manager_->PostTask([&task]() {
+    task();
+  });
+
+  ASSERT_EQ(5, task_manager_->RunWhile([&count]() {
+    return count < 5;
+  }));
+  ASSERT_EQ(4min, clock_->GetElapsedTime());
+
+  task_manager_->RunWhile([]() {
+    return true;
+  });
+  ASSERT_EQ(10, count);
+  ASSERT_EQ(9min, clock_->GetElapsedTime());
+}
+
+TEST_F(SimulationTaskManagerTest, RunUntil_LaterTasks_NotRun) {
+  size_t count = 0;
+  task_manager_->PostTaskDelayed(1s, [&count]() {
+    ++count;
+  });
+  task_manager_->PostTaskDelayed(3s, [&count]() {
+    ++count;
+  });
+
+  ASSERT_EQ(1, task_manager_->RunUntil(start_ + 2s));
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(2s, clock_->GetElapsedTime());
+  ASSERT_EQ(1, task_manager_->GetPendingTaskCount());
+}
+
+TEST_F(SimulationTaskManagerTest, PostTaskAt_PastTime_RunsAtCurrentTime) {
+  task_manager_->RunUntil(start_ + 5s);
+  VirtualClock::Duration run_time{0};
+  task_manager_->PostTaskAt(start_ + 1s, [this, &run_time]() {
+    run_time = clock_->GetElapsedTime();
+  });
+
+  task_manager_->RunNextEvent();
+
+  ASSERT_EQ(5s, run_time);
+}
+
+}  // namespace call_center::sim::test